@@ -601,6 +601,10 @@ int main(int argc, char** argv)
         const auto averageMsgRate =
             std::make_pair(numberMessages / averageDuration.first, numberMessages * sigmaDurOverDurSqr);
 
+        // Simulation step rate mean and error
+        const auto averageStepRate = std::make_pair(numberSimulationSteps / averageDuration.first,
+                                                    numberSimulationSteps * sigmaDurOverDurSqr);
+
         // Speedup mean and error
         const auto averageSpeedup = std::make_pair(benchmark.simulationDuration.count() / averageDuration.first,
                                                    benchmark.simulationDuration.count() * sigmaDurOverDurSqr);
@@ -626,6 +630,9 @@ int main(int argc, char** argv)
         std::ostringstream averageMsgRateWithUnit;
         averageMsgRateWithUnit << static_cast<int>(averageMsgRate.first) << " 1/s";
 
+        std::ostringstream averageStepRateWithUnit;
+        averageStepRateWithUnit << static_cast<int>(averageStepRate.first) << " 1/s";
+
         std::cout << std::setw(39) << "- Realtime duration (runtime): " << std::setw(13)
                   << averageDurationWithUnit.str() << " +/- " << averageDuration.second << "s" << std::endl
 
@@ -639,6 +646,10 @@ int main(int argc, char** argv)
                   << averageMsgRateWithUnit.str() << " +/- " << static_cast<int>(averageMsgRate.second) << " 1/s"
                   << std::endl
 
+                  << std::setw(39) << "- Step rate (steps/runtime): " << std::setw(13)
+                  << averageStepRateWithUnit.str() << " +/- " << static_cast<int>(averageStepRate.second) << " 1/s"
+                  << std::endl
+
                   << std::left << std::setw(39) << "- Total number of messages: " << numberMessages << std::endl
 
                   << std::endl
@@ -0,0 +1,374 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+#include <fstream>
+#include <future>
+#include <mutex>
+
+#include "silkit/SilKit.hpp"
+#include "silkit/SilKitVersion.hpp"
+#include "silkit/services/orchestration/all.hpp"
+
+#include "silkit/vendor/CreateSilKitRegistry.hpp"
+#include "silkit/experimental/participant/ParticipantExtensions.hpp"
+
+using namespace SilKit::Services::Orchestration;
+using namespace std::chrono_literals;
+
+static void PrintUsage(const std::string& executableName)
+{
+    std::cout << "Usage:" << std::endl
+              << executableName << " [options]" << std::endl
+              << "If no arguments are given, default values will be used." << std::endl
+              << "\t--help\tshow this message." << std::endl
+              << "\t--registry-uri\tThe URI of the registry to start. Default: silkit://localhost:0" << std::endl
+              << "\t--number-participants\tMeasures only the startup of NUM participants. Default: 2, 20 and 100"
+              << std::endl
+              << "\t--number-simulation-runs\tSets the number of startups to measure per number of participants to "
+                 "NUM. Default: 4"
+              << std::endl
+              << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: "
+                 "empty"
+              << std::endl
+              << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl;
+}
+
+struct StartupBenchmarkConfig
+{
+    std::vector<uint32_t> numbersOfParticipants{2, 20, 100};
+    uint32_t numberOfSimulationRuns = 4;
+    std::string registryUri = "silkit://localhost:0";
+    std::string silKitConfigPath = "";
+    std::string writeCsv = "";
+};
+
+static bool Parse(int argc, char** argv, StartupBenchmarkConfig& config)
+{
+    // skip argv[0] and collect all arguments
+    std::vector<std::string> args;
+    std::copy((argv + 1), (argv + argc), std::back_inserter(args));
+
+    auto asNum = [](const auto& str) { return static_cast<uint32_t>(std::stoul(str)); };
+
+    if (std::find(args.begin(), args.end(), "--help") != args.end())
+    {
+        PrintUsage(argv[0]);
+        return false;
+    }
+
+    try
+    {
+        for (auto it = args.begin(); it != args.end(); ++it)
+        {
+            const auto& name = *it;
+            if (std::next(it) == args.end())
+            {
+                throw std::runtime_error{"Option \"" + name + "\" is missing an argument!"};
+            }
+            const auto& value = *(++it);
+
+            if (name == "--registry-uri")
+            {
+                config.registryUri = value;
+            }
+            else if (name == "--number-participants")
+            {
+                config.numbersOfParticipants = {asNum(value)};
+            }
+            else if (name == "--number-simulation-runs")
+            {
+                config.numberOfSimulationRuns = asNum(value);
+            }
+            else if (name == "--configuration")
+            {
+                config.silKitConfigPath = value;
+            }
+            else if (name == "--write-csv")
+            {
+                config.writeCsv = value;
+            }
+            else
+            {
+                std::cout << "Error: unknown argument \"" << name << "\"" << std::endl;
+                PrintUsage(argv[0]);
+                return false;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << "Error parsing arguments: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+static bool Validate(const StartupBenchmarkConfig& config)
+{
+    if (std::any_of(config.numbersOfParticipants.begin(), config.numbersOfParticipants.end(),
+                    [](auto numberOfParticipants) { return numberOfParticipants < 1; }))
+    {
+        std::cout << "Invalid argument: The Number of participants must be at least 1." << std::endl;
+        return false;
+    }
+
+    if (config.numberOfSimulationRuns < 1)
+    {
+        std::cout << "Invalid argument: The number of simulations runs must be at least 1." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+template <typename T>
+std::pair<T, T> mean_and_error(const std::vector<T>& vec)
+{
+    const size_t sz = vec.size();
+    if (sz == 1)
+    {
+        return std::make_pair(vec[0], 0.0);
+    }
+
+    const T mean = std::accumulate(vec.begin(), vec.end(), 0.0) / sz;
+    auto variance_func = [&mean, &sz](T accumulator, const T& val) {
+        return accumulator + ((val - mean) * (val - mean) / (sz - 1));
+    };
+
+    return std::make_pair(mean, std::sqrt(std::accumulate(vec.begin(), vec.end(), 0.0, variance_func)));
+}
+
+static double ToSeconds(std::chrono::nanoseconds duration)
+{
+    return static_cast<double>(duration.count() / 1e9);
+}
+
+struct StartupRunResult
+{
+    // From starting to create the participants until the system state is Running
+    std::chrono::nanoseconds timeToRunning{};
+    // Average duration of SilKit::CreateParticipant, i.e., of joining the simulation
+    std::chrono::nanoseconds createParticipantDuration{};
+};
+
+static void ParticipantsThread(std::shared_ptr<SilKit::Config::IParticipantConfiguration> config,
+                               const std::string& registryUri, const std::string& participantName,
+                               std::chrono::nanoseconds& createParticipantDuration)
+{
+    const auto createStart = std::chrono::steady_clock::now();
+    auto participant = SilKit::CreateParticipant(config, participantName, registryUri);
+    createParticipantDuration = std::chrono::steady_clock::now() - createStart;
+
+    auto* lifecycleService = participant->CreateLifecycleService({OperationMode::Coordinated});
+    auto* timeSyncService = lifecycleService->CreateTimeSyncService();
+    timeSyncService->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+
+    auto lifecycleFuture = lifecycleService->StartLifecycle();
+    lifecycleFuture.get();
+}
+
+static auto RunStartup(std::shared_ptr<SilKit::Config::IParticipantConfiguration> config,
+                       const std::string& registryUri, uint32_t numberOfParticipants) -> StartupRunResult
+{
+    const auto startTimestamp = std::chrono::steady_clock::now();
+
+    std::vector<std::string> participantNames;
+    std::vector<std::chrono::nanoseconds> createParticipantDurations(numberOfParticipants);
+    std::vector<std::thread> threads;
+    for (uint32_t participantIndex = 0; participantIndex < numberOfParticipants; participantIndex++)
+    {
+        std::string participantName = "Participant" + std::to_string(participantIndex);
+        participantNames.push_back(participantName);
+        threads.emplace_back(&ParticipantsThread, config, registryUri, participantName,
+                             std::ref(createParticipantDurations[participantIndex]));
+    }
+
+    const auto systemControllerName = "SystemController";
+    participantNames.push_back(systemControllerName);
+    auto systemControllerParticipant = SilKit::CreateParticipant(config, systemControllerName, registryUri);
+    auto systemController =
+        SilKit::Experimental::Participant::CreateSystemController(systemControllerParticipant.get());
+    systemController->SetWorkflowConfiguration({participantNames});
+
+    std::promise<std::chrono::steady_clock::time_point> runningPromise;
+    std::once_flag runningOnce;
+    auto* systemMonitor = systemControllerParticipant->CreateSystemMonitor();
+    systemMonitor->AddSystemStateHandler([&runningPromise, &runningOnce](SystemState state) {
+        if (state == SystemState::Running)
+        {
+            std::call_once(runningOnce,
+                           [&runningPromise] { runningPromise.set_value(std::chrono::steady_clock::now()); });
+        }
+    });
+
+    auto lifecycleService = systemControllerParticipant->CreateLifecycleService({OperationMode::Coordinated});
+    auto lifecycleFuture = lifecycleService->StartLifecycle();
+
+    const auto runningTimestamp = runningPromise.get_future().get();
+    lifecycleService->Stop("Startup measured");
+    lifecycleFuture.get();
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    systemControllerParticipant.reset();
+
+    StartupRunResult result;
+    result.timeToRunning = runningTimestamp - startTimestamp;
+    result.createParticipantDuration = std::accumulate(createParticipantDurations.begin(),
+                                                       createParticipantDurations.end(), std::chrono::nanoseconds{})
+                                       / numberOfParticipants;
+    return result;
+}
+
+static void WriteCsv(const std::string& path, uint32_t numberOfSimulationRuns, uint32_t numberOfParticipants,
+                     std::pair<double, double> timeToRunning, std::pair<double, double> createParticipantDuration)
+{
+    std::stringstream csvHeader;
+    csvHeader << "# SilKitStartupDemo, SIL Kit Version " << SilKit::Version::String();
+    const auto csvColumns = "numRuns; participants; timeToRunning(s); timeToRunning_err; createParticipant(s); "
+                            "createParticipant_err";
+    std::fstream csvFile;
+    csvFile.open(path, std::ios_base::in | std::ios_base::out); // Try to open
+    if (!csvFile.is_open())
+    {
+        // File doesn't exist, create new file and write header
+        csvFile.open(path, std::ios_base::in | std::ios_base::out | std::ios_base::trunc);
+        csvFile << csvHeader.str() << std::endl;
+        csvFile << csvColumns << std::endl;
+    }
+    else
+    {
+        // File is there, check if header is valid
+        std::string header;
+        std::getline(csvFile, header);
+        csvFile.clear();
+        if (header != csvHeader.str())
+        {
+            std::cerr << "Invalid header in file \"" << path << "\"." << std::endl;
+            return;
+        }
+    }
+
+    // Append data
+    csvFile.seekp(0, std::ios_base::end);
+    csvFile << numberOfSimulationRuns << ";" << numberOfParticipants << ";" << timeToRunning.first << ";"
+            << timeToRunning.second << ";" << createParticipantDuration.first << ";" << createParticipantDuration.second
+            << std::endl;
+}
+
+/**************************************************************************************************
+* Main Function
+**************************************************************************************************/
+int main(int argc, char** argv)
+{
+    std::cout.precision(3);
+    StartupBenchmarkConfig benchmark;
+    if (!Parse(argc, argv, benchmark) || !Validate(benchmark))
+    {
+        return -1;
+    }
+
+    std::cout << std::endl
+              << "This startup demo measures how long it takes until a simulation is running." << std::endl
+              << "<N> participants and a system controller are created concurrently and the time from creating"
+              << std::endl
+              << "them until the system state is Running is measured. Each startup is repeated <K> times." << std::endl
+              << std::endl;
+
+    try
+    {
+        std::shared_ptr<SilKit::Config::IParticipantConfiguration> config;
+        if (benchmark.silKitConfigPath == "")
+        {
+            config = SilKit::Config::ParticipantConfigurationFromString("{}");
+        }
+        else
+        {
+            config = SilKit::Config::ParticipantConfigurationFromFile(benchmark.silKitConfigPath);
+        }
+
+        std::unique_ptr<SilKit::Vendor::Vector::ISilKitRegistry> registry =
+            SilKit::Vendor::Vector::CreateSilKitRegistry(config);
+        const auto registryUri = registry->StartListening(benchmark.registryUri);
+
+        for (const auto numberOfParticipants : benchmark.numbersOfParticipants)
+        {
+            std::vector<double> timesToRunning;
+            std::vector<double> createParticipantDurations;
+
+            for (uint32_t simulationRun = 1; simulationRun <= benchmark.numberOfSimulationRuns; simulationRun++)
+            {
+                const auto result = RunStartup(config, registryUri, numberOfParticipants);
+                timesToRunning.push_back(ToSeconds(result.timeToRunning));
+                createParticipantDurations.push_back(ToSeconds(result.createParticipantDuration));
+
+                std::cout << "> " << numberOfParticipants << " participants, startup " << simulationRun << ": "
+                          << timesToRunning.back() << "s" << std::endl;
+            }
+
+            const auto averageTimeToRunning = mean_and_error(timesToRunning);
+            const auto averageCreateParticipantDuration = mean_and_error(createParticipantDurations);
+
+            std::cout << std::endl
+                      << std::left << std::setw(39) << "- Number of participants: " << numberOfParticipants << std::endl
+                      << std::left << std::setw(39) << "- Time to Running: " << averageTimeToRunning.first
+                      << "s +/- " << averageTimeToRunning.second << "s" << std::endl
+                      << std::left << std::setw(39) << "- CreateParticipant (per participant): "
+                      << averageCreateParticipantDuration.first << "s +/- " << averageCreateParticipantDuration.second
+                      << "s" << std::endl
+                      << std::endl;
+
+            if (benchmark.writeCsv != "")
+            {
+                WriteCsv(benchmark.writeCsv, benchmark.numberOfSimulationRuns, numberOfParticipants,
+                         averageTimeToRunning, averageCreateParticipantDuration);
+            }
+        }
+    }
+    catch (const SilKit::ConfigurationError& error)
+    {
+        std::cerr << "Invalid configuration: " << error.what() << std::endl;
+        std::cout << "Press enter to end the process..." << std::endl;
+        std::cin.ignore();
+        return -2;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "Something went wrong: " << error.what() << std::endl;
+        std::cout << "Press enter to end the process..." << std::endl;
+        std::cin.ignore();
+        return -3;
+    }
+
+    return 0;
+}
@@ -47,9 +47,13 @@ protected:
         PubFirst
     };
 
-    void ExecuteTest(std::vector<int> numberOfTopicsList, TopicMode topicModePub, LabelMode labelModePub,
-                     TopicMode topicModeSub, LabelMode labelModeSub, StartOrderMode startOrder)
+    // Returns the runtime per number of topics. If reference runtimes are given, e.g., of the same scenario without
+    // labels, the ratio to them is reported as well, which shows the cost of the label matching.
+    auto ExecuteTest(std::vector<int> numberOfTopicsList, TopicMode topicModePub, LabelMode labelModePub,
+                     TopicMode topicModeSub, LabelMode labelModeSub, StartOrderMode startOrder,
+                     const std::vector<double>& referenceRuntimes = {}) -> std::vector<double>
     {
+        std::vector<double> runtimes;
         for (auto numberOfTopics : numberOfTopicsList)
         {
             const std::chrono::seconds timeout = 100s;
@@ -183,7 +187,64 @@ protected:
             testHarness.Run(timeout);
 
             std::chrono::duration<double> duration = Now() - start;
-            std::cout << std::left << std::setw(16) << numberOfTopics << " " << duration.count() << std::endl;
+            std::cout << std::left << std::setw(16) << numberOfTopics << " " << std::setw(12) << duration.count();
+            if (runtimes.size() < referenceRuntimes.size())
+            {
+                std::cout << " " << duration.count() / referenceRuntimes[runtimes.size()];
+            }
+            std::cout << std::endl;
+            runtimes.push_back(duration.count());
+        }
+        return runtimes;
+    }
+
+    // Publishes the messages on a single topic in bursts per simulation step, so the runtime is dominated by the
+    // per-message cost of the send and receive paths, not by the matching of the controllers.
+    void ExecuteMessageRateTest(std::vector<int> numberOfMessagesList, int messagesPerStep)
+    {
+        for (auto numberOfMessages : numberOfMessagesList)
+        {
+            const std::chrono::seconds timeout = 100s;
+
+            std::vector<std::string> syncParticipantNames = {"Publisher", "Subscriber"};
+            SilKit::Tests::SimTestHarness testHarness(syncParticipantNames, "silkit://localhost:0", true);
+
+            SilKit::Services::PubSub::PubSubSpec dataSpec{"Topic", ""};
+
+            auto&& publisher = testHarness.GetParticipant("Publisher");
+            auto* dataPublisher = publisher->Participant()->CreateDataPublisher("Pub", dataSpec, 0);
+            std::vector<uint8_t> testData = {1, 1, 1};
+            int numberOfPublished = 0;
+            publisher->GetOrCreateTimeSyncService()->SetSimulationStepHandler(
+                [dataPublisher, testData, &numberOfPublished, numberOfMessages, messagesPerStep](auto, auto) {
+                for (int i = 0; i < messagesPerStep && numberOfPublished < numberOfMessages; ++i)
+                {
+                    dataPublisher->Publish(testData);
+                    ++numberOfPublished;
+                }
+            }, 1ms);
+
+            auto&& subscriber = testHarness.GetParticipant("Subscriber");
+            auto* subLifecycleService = subscriber->GetOrCreateLifecycleService();
+            int receptionCount = 0;
+            (void)subscriber->Participant()->CreateDataSubscriber(
+                "Sub", dataSpec,
+                [&receptionCount, numberOfMessages, subLifecycleService](
+                    SilKit::Services::PubSub::IDataSubscriber* /*subscriber*/,
+                    const SilKit::Services::PubSub::DataMessageEvent& /*data*/) {
+                receptionCount++;
+                if (receptionCount == numberOfMessages)
+                {
+                    subLifecycleService->Stop("Reception complete");
+                }
+            });
+
+            auto start = Now();
+            testHarness.Run(timeout);
+            std::chrono::duration<double> duration = Now() - start;
+
+            std::cout << std::left << std::setw(16) << numberOfMessages << " " << std::setw(12) << duration.count()
+                      << " " << static_cast<int>(numberOfMessages / duration.count()) << std::endl;
         }
     }
 };
@@ -213,7 +274,8 @@ TEST_F(FTest_PubSubPerf, test_pubsub_performance)
     topicModeSub = TopicMode::IndividualTopics;
     labelModeSub = LabelMode::NoLabels;
     startOrder = StartOrderMode::PubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    const auto noLabelsPubFirst =
+        ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
 
     std::cout << std::endl;
     std::cout << "# IndividualTopics + NoLabels + Sub first" << std::endl;
@@ -223,27 +285,30 @@ TEST_F(FTest_PubSubPerf, test_pubsub_performance)
     topicModeSub = TopicMode::IndividualTopics;
     labelModeSub = LabelMode::NoLabels;
     startOrder = StartOrderMode::SubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    const auto noLabelsSubFirst =
+        ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
 
     std::cout << std::endl;
     std::cout << "# IndividualTopics + IndividualLabels + Pub Mandatory + Sub Mandatory + Pub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::IndividualTopics;
     labelModePub = LabelMode::IndividualLabelsMandatory;
     topicModeSub = TopicMode::IndividualTopics;
     labelModeSub = LabelMode::IndividualLabelsMandatory;
     startOrder = StartOrderMode::PubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsPubFirst);
 
     std::cout << std::endl;
     std::cout << "# IndividualTopics + IndividualLabels + Pub Mandatory + Sub Mandatory + Sub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::IndividualTopics;
     labelModePub = LabelMode::IndividualLabelsMandatory;
     topicModeSub = TopicMode::IndividualTopics;
     labelModeSub = LabelMode::IndividualLabelsMandatory;
     startOrder = StartOrderMode::SubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsSubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + NoLabels + Pub first" << std::endl;
@@ -267,83 +332,102 @@ TEST_F(FTest_PubSubPerf, test_pubsub_performance)
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Optional + Sub Optional + Pub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsOptional;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsOptional;
     startOrder = StartOrderMode::PubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsPubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Optional + Sub Optional + Sub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsOptional;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsOptional;
     startOrder = StartOrderMode::SubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsSubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Mandatory + Sub Mandatory + Pub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsMandatory;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsMandatory;
     startOrder = StartOrderMode::PubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsPubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Mandatory + Sub Mandatory + Sub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsMandatory;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsMandatory;
     startOrder = StartOrderMode::SubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsSubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Mandatory + Sub Optional + Pub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsMandatory;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsOptional;
     startOrder = StartOrderMode::PubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsPubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Mandatory + Sub Optional + Sub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsMandatory;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsOptional;
     startOrder = StartOrderMode::SubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsSubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Optional + Sub Mandatory + Pub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsOptional;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsMandatory;
     startOrder = StartOrderMode::PubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsPubFirst);
 
     std::cout << std::endl;
     std::cout << "# CommonTopic + IndividualLabels + Pub Optional + Sub Mandatory + Sub first" << std::endl;
-    std::cout << "# NumberOfTopics Runtime(s)" << std::endl;
+    std::cout << "# NumberOfTopics Runtime(s) Runtime/NoLabels" << std::endl;
     topicModePub = TopicMode::CommonTopic;
     labelModePub = LabelMode::IndividualLabelsOptional;
     topicModeSub = TopicMode::CommonTopic;
     labelModeSub = LabelMode::IndividualLabelsMandatory;
     startOrder = StartOrderMode::SubFirst;
-    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder);
+    ExecuteTest(testSetGoodScaling, topicModePub, labelModePub, topicModeSub, labelModeSub, startOrder,
+                noLabelsSubFirst);
+}
+
+TEST_F(FTest_PubSubPerf, test_pubsub_message_rate)
+{
+    // For testing
+    std::vector<int> testSet{10000, 100000};
+
+    std::cout << std::endl;
+    std::cout << "# CommonTopic + NoLabels + 1000 messages per step" << std::endl;
+    std::cout << "# NumberOfMessages Runtime(s) Messages/s" << std::endl;
+    ExecuteMessageRateTest(testSet, 1000);
 }
 
 } // anonymous namespace
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/vendor/CreateSilKitRegistry.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Simulates a frame handler doing some work, e.g., feeding the frame into a model
+void BusyWait(std::chrono::microseconds duration)
+{
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+class FTest_ReceiveThreadsPerf : public testing::Test
+{
+protected:
+    void ExecuteTest(int receiveThreads, size_t numberOfBuses, size_t framesPerBus,
+                     std::chrono::microseconds handlerDuration)
+    {
+        auto registry =
+            SilKit::Vendor::Vector::CreateSilKitRegistry(SilKit::Config::ParticipantConfigurationFromString(""));
+        const auto registryUri = registry->StartListening("silkit://localhost:0");
+
+        const auto totalFrames = numberOfBuses * framesPerBus;
+        std::atomic<size_t> receivedFrames{0};
+        std::promise<void> allReceived;
+
+        const auto receiverConfig = "Middleware:\n  ReceiveThreads: " + std::to_string(receiveThreads);
+        auto receiver = SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(receiverConfig),
+                                                  "Receiver", registryUri);
+        for (size_t bus = 0; bus < numberOfBuses; ++bus)
+        {
+            const auto networkName = "CAN" + std::to_string(bus);
+            auto* controller = receiver->CreateCanController(networkName, networkName);
+            controller->AddFrameHandler([&](SilKit::Services::Can::ICanController*,
+                                            const SilKit::Services::Can::CanFrameEvent&) {
+                BusyWait(handlerDuration);
+                if (++receivedFrames == totalFrames)
+                {
+                    allReceived.set_value();
+                }
+            });
+            controller->Start();
+        }
+
+        auto sender = SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(""), "Sender",
+                                                registryUri);
+        std::vector<SilKit::Services::Can::ICanController*> controllers;
+        for (size_t bus = 0; bus < numberOfBuses; ++bus)
+        {
+            const auto networkName = "CAN" + std::to_string(bus);
+            controllers.push_back(sender->CreateCanController(networkName, networkName));
+            controllers.back()->Start();
+        }
+
+        std::array<uint8_t, 8> payload{};
+        SilKit::Services::Can::CanFrame frame{};
+        frame.dataField = SilKit::Util::MakeSpan(payload);
+        frame.dlc = static_cast<uint16_t>(payload.size());
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < framesPerBus; ++i)
+        {
+            for (auto* controller : controllers)
+            {
+                frame.canId = static_cast<uint32_t>(i);
+                controller->SendFrame(frame);
+            }
+        }
+
+        ASSERT_EQ(allReceived.get_future().wait_for(60s), std::future_status::ready);
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+        std::cout << std::left << std::setw(16) << receiveThreads << std::setw(12) << numberOfBuses
+                  << duration.count() << " ms" << std::endl;
+    }
+};
+
+// Measures how long the receiver needs to handle the frames of several busy buses, depending on the number of
+// receive threads (Middleware.ReceiveThreads)
+TEST_F(FTest_ReceiveThreadsPerf, test_parallel_bus_dispatch_performance)
+{
+    std::cout << std::left << std::setw(16) << "receiveThreads" << std::setw(12) << "buses" << "duration" << std::endl;
+    for (auto numberOfBuses : {1u, 4u, 8u})
+    {
+        for (auto receiveThreads : {0, 2, 4, 8})
+        {
+            ExecuteTest(receiveThreads, numberOfBuses, 1000, 50us);
+        }
+    }
+}
+
+} // anonymous namespace
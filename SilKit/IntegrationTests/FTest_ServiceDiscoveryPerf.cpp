@@ -86,6 +86,46 @@ protected:
         ASSERT_TRUE(ok) << " Expected a short startup time, not blocked by service discovery: timeout="
                         << timeout.count();
     }
+
+    // Measures how long it takes participants to join a simulation, which already has participants with controllers.
+    // Every CAN controller subscribes to several message types on its network.
+    void ExecuteJoinTest(int numberOfParticipants, int numberOfControllers, std::chrono::seconds timeout)
+    {
+        std::vector<std::string> syncParticipantNames;
+        for (auto i = 0; i < numberOfParticipants; i++)
+        {
+            syncParticipantNames.push_back("Participant" + std::to_string(i));
+        }
+
+        SilKit::Tests::SimTestHarness testHarness(syncParticipantNames, "silkit://localhost:0", true);
+
+        auto start = Now();
+
+        for (const auto& participantName : syncParticipantNames)
+        {
+            auto&& participant = testHarness.GetParticipant(participantName)->Participant();
+            for (auto i = 0; i < numberOfControllers; i++)
+            {
+                (void)participant->CreateCanController("CanCtrl" + std::to_string(i), "CAN" + std::to_string(i));
+            }
+        }
+
+        std::chrono::duration<double> duration = Now() - start;
+        std::cout << "Test with " << numberOfParticipants << " participants and " << numberOfControllers
+                  << " controllers join time: " << duration.count() << "sec" << std::endl;
+
+        ASSERT_LT(duration, timeout) << "Joining should not be slowed down by the subscriptions of the controllers"
+                                     << ": duration=" << duration.count();
+
+        auto&& firstParticipant = testHarness.GetParticipant(syncParticipantNames.front());
+        auto* lifecycleService = firstParticipant->GetOrCreateLifecycleService();
+        auto* timeSyncService = firstParticipant->GetOrCreateTimeSyncService();
+        timeSyncService->SetSimulationStepHandler(
+            [lifecycleService](auto, auto) { lifecycleService->Stop("Test complete"); }, 1ms);
+
+        auto ok = testHarness.Run(timeout);
+        ASSERT_TRUE(ok) << " Expected the simulation to run after joining: timeout=" << timeout.count();
+    }
 };
 
 
@@ -104,4 +144,9 @@ TEST_F(FTest_ServiceDiscoveryPerf, test_discovery_performance_200services)
 {
     ExecuteTest(200, 25s);
 }
+
+TEST_F(FTest_ServiceDiscoveryPerf, test_join_performance_10participants_10controllers)
+{
+    ExecuteJoinTest(10, 10, 10s);
+}
 } // anonymous namespace
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "services/logging/Logger.hpp"
+#include "services/orchestration/TimeConfiguration.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Orchestration;
+
+class FTest_TimeConfigurationPerf : public testing::Test
+{
+protected:
+    // Drives a TimeConfiguration like the TimeSyncService of a participant in a fleet of numberOfPeers synchronized
+    // participants: in each step, the NextSimTask of every peer is received and the participant checks whether it may
+    // advance after each of them. The peers send in the order of their names, so the peer blocking the step is always
+    // the last one in name order.
+    void ExecuteTest(size_t numberOfPeers, size_t numberOfSteps, bool dynamicStepSize)
+    {
+        SilKit::Services::Logging::Logger logger{"Benchmark", SilKit::Config::Logging{}};
+        TimeConfiguration timeConfiguration{&logger};
+        timeConfiguration.SetStepDuration(1ms);
+        timeConfiguration.SetDynamicStepSizeEnabled(dynamicStepSize);
+
+        std::vector<std::string> peerNames;
+        for (size_t i = 0; i < numberOfPeers; i++)
+        {
+            std::ostringstream peerName;
+            peerName << "Participant" << std::setfill('0') << std::setw(4) << i;
+            peerNames.emplace_back(peerName.str());
+            timeConfiguration.AddSynchronizedParticipant(peerNames.back());
+        }
+
+        NextSimTask task;
+        task.duration = 1ms;
+
+        size_t blockedChecks{0};
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t step = 0; step < numberOfSteps; step++)
+        {
+            task.timePoint = std::chrono::milliseconds{step};
+            for (const auto& peerName : peerNames)
+            {
+                timeConfiguration.OnReceiveNextSimStep(peerName, task);
+                if (timeConfiguration.OtherParticipantHasLowerTimepoint())
+                {
+                    ++blockedChecks;
+                }
+            }
+            timeConfiguration.AdvanceTimeStep();
+        }
+        const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+
+        // the participant is blocked by the peers that have not sent their NextSimTask of this step yet
+        ASSERT_EQ(blockedChecks, numberOfSteps * (numberOfPeers - 1));
+
+        const auto nsPerTask = duration.count() / static_cast<double>(numberOfSteps * numberOfPeers);
+        std::cout << std::left << std::setw(12) << numberOfPeers << std::setw(16) << dynamicStepSize << nsPerTask
+                  << " ns/NextSimTask" << std::endl;
+    }
+};
+
+TEST_F(FTest_TimeConfigurationPerf, test_next_sim_task_processing_with_many_peers)
+{
+    std::cout << std::left << std::setw(12) << "peers" << std::setw(16) << "dynamicStep" << "duration" << std::endl;
+    for (auto dynamicStepSize : {false, true})
+    {
+        for (auto numberOfPeers : {10u, 100u, 1000u})
+        {
+            ExecuteTest(numberOfPeers, 100000 / numberOfPeers, dynamicStepSize);
+        }
+    }
+}
+
+} // anonymous namespace
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+
+#include "services/orchestration/TimeProvider.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Orchestration;
+
+class FTest_TimeProviderPerf : public testing::Test
+{
+protected:
+    // Measures the average cost of Now() on numberOfReaders user threads while an 'IO thread' advances the time
+    void ExecuteTest(size_t numberOfReaders, size_t numberOfCalls)
+    {
+        TimeProvider timeProvider{};
+        timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+        timeProvider.SetSynchronizeVirtualTime(true);
+
+        std::atomic<bool> stopTimeAdvance{false};
+        std::thread ioThread{[&timeProvider, &stopTimeAdvance] {
+            std::chrono::nanoseconds now{0};
+            while (!stopTimeAdvance)
+            {
+                timeProvider.SetTime(now, 1ms);
+                now += 1ms;
+            }
+        }};
+
+        std::vector<double> nsPerCall(numberOfReaders);
+        std::vector<std::thread> readers;
+        for (size_t i = 0; i < numberOfReaders; i++)
+        {
+            readers.emplace_back([&timeProvider, &nsPerCall, i, numberOfCalls] {
+                auto last = std::chrono::nanoseconds::min();
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t call = 0; call < numberOfCalls; call++)
+                {
+                    const auto now = timeProvider.Now();
+                    // the time must never go backwards
+                    ASSERT_GE(now, last);
+                    last = now;
+                }
+                const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+                nsPerCall[i] = duration.count() / static_cast<double>(numberOfCalls);
+            });
+        }
+
+        for (auto&& reader : readers)
+        {
+            reader.join();
+        }
+        stopTimeAdvance = true;
+        ioThread.join();
+
+        double average{0.0};
+        for (auto value : nsPerCall)
+        {
+            average += value / static_cast<double>(numberOfReaders);
+        }
+
+        std::cout << std::left << std::setw(12) << numberOfReaders << average << " ns/call" << std::endl;
+    }
+};
+
+TEST_F(FTest_TimeProviderPerf, test_now_under_contention)
+{
+    std::cout << std::left << std::setw(12) << "readers" << "duration" << std::endl;
+    for (auto numberOfReaders : {1u, 2u, 4u, 8u})
+    {
+        ExecuteTest(numberOfReaders, 1000000);
+    }
+}
+
+} // anonymous namespace
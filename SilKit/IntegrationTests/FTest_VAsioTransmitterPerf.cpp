@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <iomanip>
+
+#include "core/vasio/VAsioTransmitter.hpp"
+#include "wire/pubsub/WireDataMessages.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+using SilKit::Services::PubSub::WireDataMessageEvent;
+
+// Minimal peer that only counts the bytes handed over for sending
+class CountingPeer : public IVAsioPeer
+{
+public:
+    explicit CountingPeer(std::string participantName)
+    {
+        _info.participantName = std::move(participantName);
+        _info.participantId = std::hash<std::string>{}(_info.participantName);
+    }
+
+    void SendSilKitMsg(SerializedMessage buffer) override
+    {
+        auto storage = buffer.ReleaseStorage();
+        _sentBytes += storage.size();
+        // hand the storage back like VAsioPeer does after a completed write
+        SendBufferPool::Release(std::move(storage));
+        _sentMessages++;
+    }
+    void Subscribe(VAsioMsgSubscriber) override {}
+    auto GetInfo() const -> const VAsioPeerInfo& override
+    {
+        return _info;
+    }
+    void SetInfo(VAsioPeerInfo info) override
+    {
+        _info = std::move(info);
+    }
+    auto GetSimulationName() const -> const std::string& override
+    {
+        return _simulationName;
+    }
+    void SetSimulationName(const std::string& simulationName) override
+    {
+        _simulationName = simulationName;
+    }
+    auto GetRemoteAddress() const -> std::string override
+    {
+        return {};
+    }
+    auto GetLocalAddress() const -> std::string override
+    {
+        return {};
+    }
+    void StartAsyncRead() override {}
+    void Shutdown() override {}
+    void SetProtocolVersion(ProtocolVersion) override {}
+    auto GetProtocolVersion() const -> ProtocolVersion override
+    {
+        return CurrentProtocolVersion();
+    }
+    void EnableAggregation() override {}
+    void InitializeMetrics(VSilKit::IMetricsManager*) override {}
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return _serviceDescriptor;
+    }
+
+    size_t _sentBytes{0};
+    size_t _sentMessages{0};
+
+private:
+    VAsioPeerInfo _info;
+    std::string _simulationName;
+    ServiceDescriptor _serviceDescriptor;
+};
+
+class FTest_VAsioTransmitterPerf : public testing::Test
+{
+protected:
+    void ExecuteTest(size_t numberOfReceivers, size_t payloadSize, size_t numberOfMessages)
+    {
+        std::vector<std::unique_ptr<CountingPeer>> peers;
+        VAsioTransmitter<WireDataMessageEvent> transmitter{nullptr};
+        transmitter.SetHistoryLength(0);
+
+        for (size_t i = 0; i < numberOfReceivers; i++)
+        {
+            peers.emplace_back(std::make_unique<CountingPeer>("Receiver" + std::to_string(i)));
+            transmitter.AddRemoteReceiver(peers.back().get(), static_cast<EndpointId>(i + 1));
+        }
+
+        CountingPeer sender{"Sender"};
+        ServiceDescriptor senderDescriptor{};
+        senderDescriptor.SetParticipantNameAndComputeId("Sender");
+        senderDescriptor.SetServiceId(1);
+        sender.SetServiceDescriptor(senderDescriptor);
+
+        WireDataMessageEvent msg{};
+        msg.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 0xAB)};
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < numberOfMessages; i++)
+        {
+            msg.timestamp = std::chrono::nanoseconds{i};
+            transmitter.ReceiveMsg(&sender, msg);
+        }
+        const std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+
+        for (auto&& peer : peers)
+        {
+            ASSERT_EQ(peer->_sentMessages, numberOfMessages);
+        }
+
+        std::cout << std::left << std::setw(12) << numberOfReceivers << std::setw(12) << payloadSize
+                  << duration.count() / static_cast<double>(numberOfMessages) << " us/msg" << std::endl;
+    }
+};
+
+// Measures the cost of a single ReceiveMsg call depending on the number of remote receivers (fan-out)
+TEST_F(FTest_VAsioTransmitterPerf, test_fan_out_performance)
+{
+    std::cout << std::left << std::setw(12) << "receivers" << std::setw(12) << "payload" << "duration" << std::endl;
+    for (auto payloadSize : {8u, 1500u, 16u * 1024u})
+    {
+        for (auto numberOfReceivers : {1u, 5u, 10u, 20u, 40u})
+        {
+            ExecuteTest(numberOfReceivers, payloadSize, 10000);
+        }
+    }
+}
+
+} // anonymous namespace
@@ -657,6 +657,12 @@ extern "C"
             timeSyncService, handlerId);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_SetLookahead(
+        SilKit_TimeSyncService* timeSyncService, SilKit_NanosecondsTime lookahead)
+    {
+        return globalCapi->SilKit_Experimental_TimeSyncService_SetLookahead(timeSyncService, lookahead);
+    }
+
     // SystemMonitor
 
     SilKit_ReturnCode SilKitCALL SilKit_SystemMonitor_Create(SilKit_SystemMonitor** outSystemMonitor,
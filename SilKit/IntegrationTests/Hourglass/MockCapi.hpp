@@ -347,6 +347,9 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_TimeSyncService_RemoveOtherSimulationStepsCompletedHandler,
                 (SilKit_TimeSyncService * timeSyncService, SilKit_HandlerId handlerId));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_TimeSyncService_SetLookahead,
+                (SilKit_TimeSyncService * timeSyncService, SilKit_NanosecondsTime lookahead));
+
     // SystemMonitor
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_SystemMonitor_Create,
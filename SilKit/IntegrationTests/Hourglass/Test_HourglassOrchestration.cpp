@@ -449,6 +449,19 @@ TEST_F(Test_HourglassOrchestration, SilKit_Experimental_TimeSyncService_RemoveOt
     timeSyncService.ExperimentalRemoveOtherSimulationStepsCompletedHandler(cppHandlerId);
 }
 
+TEST_F(Test_HourglassOrchestration, SilKit_Experimental_TimeSyncService_SetLookahead)
+{
+    const std::chrono::nanoseconds lookahead{0x123456};
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Orchestration::TimeSyncService timeSyncService{
+        mockLifecycleService};
+
+    EXPECT_CALL(capi, SilKit_Experimental_TimeSyncService_SetLookahead(mockTimeSyncService, lookahead.count()))
+        .WillOnce(Return(SilKit_ReturnCode_SUCCESS));
+
+    timeSyncService.ExperimentalSetLookahead(lookahead);
+}
+
 // SystemMonitor
 
 TEST_F(Test_HourglassOrchestration, SilKit_SystemMonitor_Create)
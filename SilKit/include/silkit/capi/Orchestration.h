@@ -780,6 +780,26 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_AddOt
 SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_RemoveOtherSimulationStepsCompletedHandler(
     SilKit_TimeSyncService* timeSyncService, SilKit_HandlerId handlerId);
 
+/*! \brief Declare a lookahead for the virtual time synchronization of this participant.
+ *
+ * By declaring a lookahead, the participant promises that nothing it sends in the simulation step starting at its
+ * next time point affects other participants earlier than this time point plus the lookahead (e.g., due to the known
+ * latency of a bus). Other participants may then execute their simulation steps up to this point without waiting for
+ * the participant, i.e., they can run several steps ahead instead of waiting for each of its NextSimTasks.
+ *
+ * The lookahead is announced to the other participants together with the time sync. service and must be declared
+ * before the lifecycle is started. The default lookahead is zero, which is the regular lockstep synchronization.
+ * It has no effect in the hierarchical time synchronization.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * \param timeSyncService The time sync. service obtained via \ref SilKit_TimeSyncService_Create.
+ * \param lookahead The lookahead in nanoseconds.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_SetLookahead(
+    SilKit_TimeSyncService* timeSyncService, SilKit_NanosecondsTime lookahead);
+
 SILKIT_END_DECLS
 
 #pragma pack(pop)
@@ -32,6 +32,14 @@ void RemoveOtherSimulationStepsCompletedHandler(SilKit::Services::Orchestration:
     return cppTimeSyncService.ExperimentalRemoveOtherSimulationStepsCompletedHandler(handlerId);
 }
 
+void SetLookahead(SilKit::Services::Orchestration::ITimeSyncService* cppITimeSyncService,
+                  std::chrono::nanoseconds lookahead)
+{
+    auto& cppTimeSyncService = dynamic_cast<Impl::Services::Orchestration::TimeSyncService&>(*cppITimeSyncService);
+
+    cppTimeSyncService.ExperimentalSetLookahead(lookahead);
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace Experimental
@@ -47,6 +55,7 @@ using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::Orche
     AddOtherSimulationStepsCompletedHandler;
 using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::Orchestration::
     RemoveOtherSimulationStepsCompletedHandler;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::Orchestration::SetLookahead;
 } // namespace Orchestration
 } // namespace Services
 } // namespace Experimental
@@ -41,6 +41,8 @@ public:
 
     inline void ExperimentalRemoveOtherSimulationStepsCompletedHandler(SilKit::Util::HandlerId handlerId);
 
+    inline void ExperimentalSetLookahead(std::chrono::nanoseconds lookahead);
+
 private:
     template <typename HandlerFunction>
     struct HandlerData
@@ -177,6 +179,13 @@ inline void TimeSyncService::ExperimentalRemoveOtherSimulationStepsCompletedHand
     ThrowOnError(returnCode);
 }
 
+inline void TimeSyncService::ExperimentalSetLookahead(std::chrono::nanoseconds lookahead)
+{
+    const auto returnCode = SilKit_Experimental_TimeSyncService_SetLookahead(
+        _timeSyncService, static_cast<SilKit_NanosecondsTime>(lookahead.count()));
+    ThrowOnError(returnCode);
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace Impl
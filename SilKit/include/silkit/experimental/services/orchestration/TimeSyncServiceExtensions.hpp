@@ -37,6 +37,21 @@ DETAIL_SILKIT_CPP_API auto AddOtherSimulationStepsCompletedHandler(
 DETAIL_SILKIT_CPP_API void RemoveOtherSimulationStepsCompletedHandler(
     SilKit::Services::Orchestration::ITimeSyncService* timeSyncService, SilKit::Util::HandlerId handlerId);
 
+/*! \brief Declare a lookahead for the virtual time synchronization of this participant.
+ *
+ * The participant promises that nothing it sends in the simulation step starting at its next time point affects other
+ * participants earlier than this time point plus the lookahead (e.g., due to the known latency of a bus). Other
+ * participants may then run several simulation steps ahead, up to this point, without waiting for the participant.
+ *
+ * Must be called before the lifecycle is started. A lookahead of zero (the default) is the regular lockstep
+ * synchronization. The lookahead has no effect in the hierarchical time synchronization.
+ *
+ * \param timeSyncService The time sync. service.
+ * \param lookahead The lookahead, must not be negative.
+ */
+DETAIL_SILKIT_CPP_API void SetLookahead(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService,
+                                        std::chrono::nanoseconds lookahead);
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace Experimental
@@ -750,3 +750,20 @@ try
     return SilKit_ReturnCode_SUCCESS;
 }
 CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_SetLookahead(SilKit_TimeSyncService* cTimeSyncService,
+                                                                             SilKit_NanosecondsTime lookahead)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(cTimeSyncService);
+
+    const auto cppITimeSyncService =
+        reinterpret_cast<SilKit::Services::Orchestration::ITimeSyncService*>(cTimeSyncService);
+
+    SilKit::Experimental::Services::Orchestration::SetLookahead(cppITimeSyncService,
+                                                                std::chrono::nanoseconds{lookahead});
+
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
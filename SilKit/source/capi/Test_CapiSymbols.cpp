@@ -100,6 +100,7 @@ TEST(Test_CapiSymbols, DISABLED_link_all_public_symbols)
     (void)SilKit_Experimental_TimeSyncService_AddOtherSimulationStepsCompletedHandler(nullptr, nullptr, nullptr,
                                                                                       nullptr);
     (void)SilKit_Experimental_TimeSyncService_RemoveOtherSimulationStepsCompletedHandler(nullptr, 0);
+    (void)SilKit_Experimental_TimeSyncService_SetLookahead(nullptr, 0);
     (void)SilKit_LifecycleService_Pause(nullptr, "");
     (void)SilKit_LifecycleService_Continue(nullptr);
     (void)SilKit_LifecycleService_Stop(nullptr, "");
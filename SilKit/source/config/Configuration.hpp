@@ -5,6 +5,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <optional>
 #include <sstream>
@@ -88,18 +89,56 @@ struct Sink
     std::vector<Services::Logging::Topic> enabledTopics{};
 };
 
+//! \brief Asynchronous logging to the stdout and file sinks (experimental)
+struct AsyncLogging
+{
+    enum class OverflowPolicy : uint8_t
+    {
+        //! Records are dropped and counted if the queue is full
+        Drop,
+        //! The logging thread waits until the queue has space again
+        Block
+    };
+
+    //! \brief Capacity of the record queue; zero writes the records synchronously on the logging thread
+    size_t queueSize{0};
+    OverflowPolicy overflowPolicy{OverflowPolicy::Drop};
+};
+
 //! \brief Logger service
 struct Logging
 {
     bool logFromRemotes{false};
     Services::Logging::Level flushLevel{Services::Logging::Level::Off};
     std::vector<Sink> sinks;
+    // currently lives in Logging >> Experimental >>
+    AsyncLogging async;
 };
 
 // ================================================================================
 //  Tracing service
 // ================================================================================
 
+//! \brief Buffered writing of PCAP trace sinks on a background thread (experimental)
+struct TraceSinkBuffering
+{
+    enum class OverflowPolicy : uint8_t
+    {
+        //! Records are dropped and counted if all blocks are in use
+        Drop,
+        //! The tracing thread waits until a block has been written
+        Block
+    };
+
+    //! \brief Size of a record block in bytes; zero writes the records synchronously on the tracing thread
+    size_t blockSize{0};
+    //! \brief Maximum number of blocks held in memory, including the block that is currently filled
+    size_t maxBlocks{4};
+    //! \brief Maximum time a record is held in a partially filled block before it is written
+    std::chrono::milliseconds flushInterval{100};
+    OverflowPolicy overflowPolicy{OverflowPolicy::Block};
+};
+
 struct TraceSink
 {
     enum class Type
@@ -113,6 +152,16 @@ struct TraceSink
     Type type{Type::Undefined};
     std::string name;
     std::string outputPath;
+    // currently lives in TraceSinks >> Experimental >>
+    TraceSinkBuffering buffering;
+};
+
+//! \brief Part of a trace source which is replayed (experimental)
+struct TraceSourceReplayWindow
+{
+    //! \brief Messages with an earlier timestamp are skipped, the replay of the remaining messages is shifted to
+    //!        begin at the start of the simulation; zero replays the whole trace
+    std::chrono::milliseconds startTime{0};
 };
 
 struct TraceSource
@@ -127,6 +176,8 @@ struct TraceSource
     Type type{Type::Undefined};
     std::string name;
     std::string inputPath;
+    // currently lives in TraceSources >> Experimental >>
+    TraceSourceReplayWindow replayWindow;
 };
 
 //! MdfChannel identification for replaying, refer to ASAM MDF 4.1 Specification, Chapter 5.4.3
@@ -174,8 +225,13 @@ inline bool operator==(const Sink& lhs, const Sink& rhs);
 inline bool operator<(const Sink& lhs, const Sink& rhs);
 inline bool operator>(const Sink& lhs, const Sink& rhs);
 
+inline bool operator==(const AsyncLogging& lhs, const AsyncLogging& rhs);
 inline bool operator==(const Logging& lhs, const Logging& rhs);
+inline std::ostream& operator<<(std::ostream& out, const AsyncLogging::OverflowPolicy& overflowPolicy);
+inline bool operator==(const TraceSinkBuffering& lhs, const TraceSinkBuffering& rhs);
+inline std::ostream& operator<<(std::ostream& out, const TraceSinkBuffering::OverflowPolicy& overflowPolicy);
 inline bool operator==(const TraceSink& lhs, const TraceSink& rhs);
+inline bool operator==(const TraceSourceReplayWindow& lhs, const TraceSourceReplayWindow& rhs);
 inline bool operator==(const TraceSource& lhs, const TraceSource& rhs);
 inline bool operator==(const Replay& lhs, const Replay& rhs);
 inline bool operator==(const MdfChannel& lhs, const MdfChannel& rhs);
@@ -244,19 +300,70 @@ bool operator>(const Sink& lhs, const Sink& rhs)
     return rhs < lhs;
 }
 
+bool operator==(const AsyncLogging& lhs, const AsyncLogging& rhs)
+{
+    return lhs.queueSize == rhs.queueSize && lhs.overflowPolicy == rhs.overflowPolicy;
+}
+
 bool operator==(const Logging& lhs, const Logging& rhs)
 {
-    return lhs.logFromRemotes == rhs.logFromRemotes && lhs.flushLevel == rhs.flushLevel && lhs.sinks == rhs.sinks;
+    return lhs.logFromRemotes == rhs.logFromRemotes && lhs.flushLevel == rhs.flushLevel && lhs.sinks == rhs.sinks
+           && lhs.async == rhs.async;
+}
+
+std::ostream& operator<<(std::ostream& outStream, const AsyncLogging::OverflowPolicy& overflowPolicy)
+{
+    switch (overflowPolicy)
+    {
+    case AsyncLogging::OverflowPolicy::Drop:
+        outStream << "Drop";
+        break;
+    case AsyncLogging::OverflowPolicy::Block:
+        outStream << "Block";
+        break;
+    default:
+        outStream << "Invalid OverflowPolicy";
+    }
+    return outStream;
+}
+
+bool operator==(const TraceSinkBuffering& lhs, const TraceSinkBuffering& rhs)
+{
+    return lhs.blockSize == rhs.blockSize && lhs.maxBlocks == rhs.maxBlocks && lhs.flushInterval == rhs.flushInterval
+           && lhs.overflowPolicy == rhs.overflowPolicy;
+}
+
+std::ostream& operator<<(std::ostream& outStream, const TraceSinkBuffering::OverflowPolicy& overflowPolicy)
+{
+    switch (overflowPolicy)
+    {
+    case TraceSinkBuffering::OverflowPolicy::Drop:
+        outStream << "Drop";
+        break;
+    case TraceSinkBuffering::OverflowPolicy::Block:
+        outStream << "Block";
+        break;
+    default:
+        outStream << "Invalid OverflowPolicy";
+    }
+    return outStream;
 }
 
 bool operator==(const TraceSink& lhs, const TraceSink& rhs)
 {
-    return lhs.name == rhs.name && lhs.outputPath == rhs.outputPath && lhs.type == rhs.type;
+    return lhs.name == rhs.name && lhs.outputPath == rhs.outputPath && lhs.type == rhs.type
+           && lhs.buffering == rhs.buffering;
+}
+
+bool operator==(const TraceSourceReplayWindow& lhs, const TraceSourceReplayWindow& rhs)
+{
+    return lhs.startTime == rhs.startTime;
 }
 
 bool operator==(const TraceSource& lhs, const TraceSource& rhs)
 {
-    return lhs.inputPath == rhs.inputPath && lhs.type == rhs.type && lhs.name == rhs.name;
+    return lhs.inputPath == rhs.inputPath && lhs.type == rhs.type && lhs.name == rhs.name
+           && lhs.replayWindow == rhs.replayWindow;
 }
 
 bool operator==(const Replay& lhs, const Replay& rhs)
@@ -132,7 +132,8 @@ bool operator==(const MetricsSink& lhs, const MetricsSink& rhs)
 
 bool operator==(const Metrics& lhs, const Metrics& rhs)
 {
-    return lhs.sinks == rhs.sinks && lhs.collectFromRemote == rhs.collectFromRemote;
+    return lhs.sinks == rhs.sinks && lhs.collectFromRemote == rhs.collectFromRemote
+           && lhs.collectLinkLatency == rhs.collectLinkLatency;
 }
 
 bool operator==(const Extensions& lhs, const Extensions& rhs)
@@ -149,7 +150,9 @@ bool operator==(const Middleware& lhs, const Middleware& rhs)
            && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
            && lhs.registryAsFallbackProxy == rhs.registryAsFallbackProxy
            && lhs.connectTimeoutSeconds == rhs.connectTimeoutSeconds
-           && lhs.experimentalRemoteParticipantConnection == rhs.experimentalRemoteParticipantConnection;
+           && lhs.experimentalRemoteParticipantConnection == rhs.experimentalRemoteParticipantConnection
+           && lhs.enableSharedMemory == rhs.enableSharedMemory && lhs.receiveThreads == rhs.receiveThreads
+           && lhs.lazyPeerConnections == rhs.lazyPeerConnections;
 }
 
 bool operator==(const Includes& lhs, const Includes& rhs)
@@ -171,7 +174,8 @@ bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfigurat
 bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs)
 {
     return lhs.animationFactor == rhs.animationFactor && lhs.enableMessageAggregation == rhs.enableMessageAggregation
-           && lhs.dynamicSimulationStep == rhs.dynamicSimulationStep;
+           && lhs.dynamicSimulationStep == rhs.dynamicSimulationStep && lhs.aggregator == rhs.aggregator
+           && lhs.spinWaitBudget == rhs.spinWaitBudget;
 }
 
 bool operator==(const Experimental& lhs, const Experimental& rhs)
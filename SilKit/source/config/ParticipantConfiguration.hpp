@@ -262,6 +262,8 @@ struct Metrics
     std::vector<MetricsSink> sinks;
     std::optional<bool> collectFromRemote;
     std::chrono::seconds updateInterval{1};
+    //! \brief Record the send latency of every link into a histogram metric
+    bool collectLinkLatency{false};
 };
 
 // ================================================================================
@@ -297,6 +299,12 @@ struct Middleware
     bool experimentalRemoteParticipantConnection{true};
     //! Timeout for individual connection attempts (TCP, Local-Domain) and handshakes.
     double connectTimeoutSeconds{5.0};
+    //! Exchange messages with participants on the same host via shared memory (experimental, Linux only).
+    bool enableSharedMemory{false};
+    //! Number of threads dispatching received bus messages, sharded by network. 0 dispatches on the IO thread.
+    int receiveThreads{0};
+    //! Connect only to participants which share a network with this one when joining, and to all others on demand.
+    bool lazyPeerConnections{false};
 };
 
 
@@ -315,6 +323,13 @@ struct TimeSynchronization
     //! the network: it enables dynamic stepping if any peer advertises it. When false, it is a hard
     //! opt-out that never enables dynamic stepping regardless of peers.
     std::optional<bool> dynamicSimulationStep;
+    //! Name of the participant that aggregates the NextSimTasks of this participant (hierarchical time
+    //! synchronization). Empty by default, i.e., the participant exchanges its NextSimTasks with all other
+    //! participants that do not have an aggregator either.
+    std::string aggregator;
+    //! Spin-then-block waiting: the IO thread busy-polls the sockets, and the receive threads their queues, for up to
+    //! this duration before blocking. Zero (the default) blocks immediately.
+    std::chrono::microseconds spinWaitBudget{0};
 };
 
 // ================================================================================
@@ -46,12 +46,17 @@ struct MiddlewareCache
     std::optional<bool> enableDomainSockets;
     std::optional<bool> registryAsFallbackProxy;
     std::optional<bool> experimentalRemoteParticipantConnection;
+    std::optional<bool> enableSharedMemory;
+    std::optional<int> receiveThreads;
+    std::optional<bool> lazyPeerConnections;
 };
 
 struct GlobalLogCache
 {
     std::optional<bool> logFromRemotes;
     std::optional<Services::Logging::Level> flushLevel;
+    std::optional<size_t> asyncQueueSize;
+    std::optional<AsyncLogging::OverflowPolicy> asyncOverflowPolicy;
     std::set<Sink> fileSinks;
     std::optional<Sink> stdOutSink;
     std::optional<Sink> remoteSink;
@@ -63,11 +68,14 @@ struct TimeSynchronizationCache
     std::optional<double> animationFactor;
     std::optional<Aggregation> enableMessageAggregation;
     std::optional<bool> dynamicSimulationStep;
+    std::optional<std::string> aggregator;
+    std::optional<std::chrono::microseconds::rep> spinWaitBudget;
 };
 
 struct MetricsCache
 {
     std::optional<bool> collectFromRemote;
+    std::optional<bool> collectLinkLatency;
     std::set<MetricsSink> jsonFileSinks;
     std::set<std::string> fileNames;
     std::optional<MetricsSink> remoteSink;
@@ -284,6 +292,12 @@ void Cache(const Middleware& root, MiddlewareCache& cache)
                     cache.experimentalRemoteParticipantConnection);
     CacheNonDefault(defaultObject.connectTimeoutSeconds, root.connectTimeoutSeconds, "Middleware.ConnectTimeoutSeconds",
                     cache.connectTimeoutSeconds);
+    CacheNonDefault(defaultObject.enableSharedMemory, root.enableSharedMemory, "Middleware.EnableSharedMemory",
+                    cache.enableSharedMemory);
+    CacheNonDefault(defaultObject.receiveThreads, root.receiveThreads, "Middleware.ReceiveThreads",
+                    cache.receiveThreads);
+    CacheNonDefault(defaultObject.lazyPeerConnections, root.lazyPeerConnections, "Middleware.LazyPeerConnections",
+                    cache.lazyPeerConnections);
 }
 void CacheLoggingOptions(const Logging& config, GlobalLogCache& cache)
 {
@@ -291,6 +305,10 @@ void CacheLoggingOptions(const Logging& config, GlobalLogCache& cache)
     CacheNonDefault(defaultObject.flushLevel, config.flushLevel, "Logging.FlushLevel", cache.flushLevel);
     CacheNonDefault(defaultObject.logFromRemotes, config.logFromRemotes, "Logging.LogFromRemotes",
                     cache.logFromRemotes);
+    CacheNonDefault(defaultObject.async.queueSize, config.async.queueSize, "Logging.Experimental.AsyncQueueSize",
+                    cache.asyncQueueSize);
+    CacheNonDefault(defaultObject.async.overflowPolicy, config.async.overflowPolicy,
+                    "Logging.Experimental.AsyncOverflowPolicy", cache.asyncOverflowPolicy);
 }
 
 void CacheLoggingSinks(const Logging& config, GlobalLogCache& cache)
@@ -355,6 +373,9 @@ void Cache(const TimeSynchronization& root, TimeSynchronizationCache& cache)
         CacheNonDefault(!root.dynamicSimulationStep.value(), root.dynamicSimulationStep.value(),
                         "TimeSynchronization.DynamicSimulationStep", cache.dynamicSimulationStep);
     }
+    CacheNonDefault(defaultObject.aggregator, root.aggregator, "TimeSynchronization.Aggregator", cache.aggregator);
+    CacheNonDefault(defaultObject.spinWaitBudget.count(), root.spinWaitBudget.count(),
+                    "TimeSynchronization.SpinWaitBudget", cache.spinWaitBudget);
 }
 
 void Cache(const Metrics& root, MetricsCache& cache)
@@ -364,6 +385,8 @@ void Cache(const Metrics& root, MetricsCache& cache)
     {
         CacheNonDefault(false, root.collectFromRemote.value(), "Metrics.CollectFromRemote", cache.collectFromRemote);
     }
+    CacheNonDefault(defaultObject.collectLinkLatency, root.collectLinkLatency, "Metrics.CollectLinkLatency",
+                    cache.collectLinkLatency);
 
     for (const auto& sink : root.sinks)
     {
@@ -502,6 +525,9 @@ void MergeMiddleware(const MiddlewareCache& cache, Middleware& middleware)
     MergeCacheField(cache.registryAsFallbackProxy, middleware.registryAsFallbackProxy);
     MergeCacheField(cache.experimentalRemoteParticipantConnection, middleware.experimentalRemoteParticipantConnection);
     MergeCacheField(cache.connectTimeoutSeconds, middleware.connectTimeoutSeconds);
+    MergeCacheField(cache.enableSharedMemory, middleware.enableSharedMemory);
+    MergeCacheField(cache.receiveThreads, middleware.receiveThreads);
+    MergeCacheField(cache.lazyPeerConnections, middleware.lazyPeerConnections);
 
     middleware.acceptorUris = cache.acceptorUris;
 }
@@ -510,6 +536,8 @@ void MergeLogCache(const GlobalLogCache& cache, Logging& logging)
 {
     MergeCacheField(cache.flushLevel, logging.flushLevel);
     MergeCacheField(cache.logFromRemotes, logging.logFromRemotes);
+    MergeCacheField(cache.asyncQueueSize, logging.async.queueSize);
+    MergeCacheField(cache.asyncOverflowPolicy, logging.async.overflowPolicy);
     MergeCacheSet(cache.fileSinks, logging.sinks);
 
     if (cache.stdOutSink.has_value())
@@ -531,6 +559,11 @@ void MergeTimeSynchronizationCache(const TimeSynchronizationCache& cache, TimeSy
     {
         timeSynchronization.dynamicSimulationStep = cache.dynamicSimulationStep.value();
     }
+    MergeCacheField(cache.aggregator, timeSynchronization.aggregator);
+    if (cache.spinWaitBudget.has_value())
+    {
+        timeSynchronization.spinWaitBudget = std::chrono::microseconds{cache.spinWaitBudget.value()};
+    }
 }
 
 void MergeMetricsCache(const MetricsCache& cache, Metrics& metrics)
@@ -539,6 +572,7 @@ void MergeMetricsCache(const MetricsCache& cache, Metrics& metrics)
     {
         MergeCacheField(cache.collectFromRemote, metrics.collectFromRemote.value());
     }
+    MergeCacheField(cache.collectLinkLatency, metrics.collectLinkLatency);
     MergeCacheSet(cache.jsonFileSinks, metrics.sinks);
 
     if (cache.remoteSink.has_value() && cache.collectFromRemote.value_or(false))
@@ -190,6 +190,9 @@ Middleware:
   TcpSendBufferSize: 3456
   TcpReceiveBufferSize: 3456
   RegistryAsFallbackProxy: false
+  EnableSharedMemory: true
+  ReceiveThreads: 4
+  LazyPeerConnections: true
 
 )raw";
 
@@ -263,6 +266,9 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_EQ(config.middleware.tcpReceiveBufferSize, 3456);
     EXPECT_EQ(config.middleware.tcpSendBufferSize, 3456);
     ASSERT_FALSE(config.middleware.registryAsFallbackProxy);
+    ASSERT_TRUE(config.middleware.enableSharedMemory);
+    EXPECT_EQ(config.middleware.receiveThreads, 4);
+    EXPECT_TRUE(config.middleware.lazyPeerConnections);
 }
 
 TEST_F(Test_YamlParser, yaml_file_sink_defaults_to_json_format)
@@ -414,6 +420,152 @@ Experimental:
     EXPECT_EQ(configDefault.experimental.metrics.updateInterval, 1s);
 }
 
+TEST_F(Test_YamlParser, yaml_metrics_collect_link_latency)
+{
+    auto config = Deserialize<ParticipantConfiguration>(R"(
+Experimental:
+  Metrics:
+    CollectLinkLatency: true
+)");
+    EXPECT_TRUE(config.experimental.metrics.collectLinkLatency);
+
+    auto txt = Serialize(config);
+    auto config2 = Deserialize<ParticipantConfiguration>(txt);
+    EXPECT_EQ(config, config2);
+
+    auto configDefault = Deserialize<ParticipantConfiguration>(R"(
+Experimental:
+  Metrics:
+    CollectFromRemote: true
+)");
+    EXPECT_FALSE(configDefault.experimental.metrics.collectLinkLatency);
+}
+
+TEST_F(Test_YamlParser, yaml_time_synchronization_aggregator)
+{
+    auto config = Deserialize<ParticipantConfiguration>(R"(
+Experimental:
+  TimeSynchronization:
+    Aggregator: SyncHub1
+)");
+    EXPECT_EQ(config.experimental.timeSynchronization.aggregator, "SyncHub1");
+
+    auto txt = Serialize(config);
+    auto config2 = Deserialize<ParticipantConfiguration>(txt);
+    EXPECT_EQ(config, config2);
+
+    auto configDefault = Deserialize<ParticipantConfiguration>(R"(
+Experimental:
+  TimeSynchronization:
+    AnimationFactor: 1.0
+)");
+    EXPECT_TRUE(configDefault.experimental.timeSynchronization.aggregator.empty());
+}
+
+TEST_F(Test_YamlParser, yaml_time_synchronization_spin_wait_budget)
+{
+    auto config = Deserialize<ParticipantConfiguration>(R"(
+Experimental:
+  TimeSynchronization:
+    SpinWaitBudget: 50
+)");
+    EXPECT_EQ(config.experimental.timeSynchronization.spinWaitBudget, std::chrono::microseconds{50});
+
+    auto txt = Serialize(config);
+    auto config2 = Deserialize<ParticipantConfiguration>(txt);
+    EXPECT_EQ(config, config2);
+
+    auto configDefault = Deserialize<ParticipantConfiguration>(R"(
+Experimental:
+  TimeSynchronization:
+    AnimationFactor: 1.0
+)");
+    EXPECT_EQ(configDefault.experimental.timeSynchronization.spinWaitBudget, std::chrono::microseconds{0});
+}
+
+TEST_F(Test_YamlParser, yaml_logging_async)
+{
+    auto config = Deserialize<ParticipantConfiguration>(R"(
+Logging:
+  Sinks:
+  - Type: Stdout
+  Experimental:
+    AsyncQueueSize: 1024
+    AsyncOverflowPolicy: Block
+)");
+    EXPECT_EQ(config.logging.async.queueSize, 1024u);
+    EXPECT_EQ(config.logging.async.overflowPolicy, SilKit::Config::AsyncLogging::OverflowPolicy::Block);
+
+    auto txt = Serialize(config);
+    auto config2 = Deserialize<ParticipantConfiguration>(txt);
+    EXPECT_EQ(config, config2);
+
+    EXPECT_THROW(Deserialize<ParticipantConfiguration>(R"(
+Logging:
+  Sinks:
+  - Type: Stdout
+  Experimental:
+    AsyncOverflowPolicy: Overwrite
+)"),
+                 SilKit::ConfigurationError);
+}
+
+TEST_F(Test_YamlParser, yaml_trace_sink_buffering)
+{
+    auto config = Deserialize<ParticipantConfiguration>(R"(
+Tracing:
+  TraceSinks:
+  - Name: Sink1
+    Type: PcapFile
+    OutputPath: Sink1.pcap
+    Experimental:
+      BufferBlockSize: 65536
+      BufferMaxBlocks: 3
+      FlushInterval: 20
+      OverflowPolicy: Drop
+)");
+    ASSERT_EQ(config.tracing.traceSinks.size(), 1u);
+    const auto& buffering = config.tracing.traceSinks.at(0).buffering;
+    EXPECT_EQ(buffering.blockSize, 65536u);
+    EXPECT_EQ(buffering.maxBlocks, 3u);
+    EXPECT_EQ(buffering.flushInterval, std::chrono::milliseconds{20});
+    EXPECT_EQ(buffering.overflowPolicy, SilKit::Config::TraceSinkBuffering::OverflowPolicy::Drop);
+
+    auto txt = Serialize(config);
+    auto config2 = Deserialize<ParticipantConfiguration>(txt);
+    EXPECT_EQ(config, config2);
+
+    EXPECT_THROW(Deserialize<ParticipantConfiguration>(R"(
+Tracing:
+  TraceSinks:
+  - Name: Sink1
+    Type: PcapFile
+    OutputPath: Sink1.pcap
+    Experimental:
+      OverflowPolicy: Overwrite
+)"),
+                 SilKit::ConfigurationError);
+}
+
+TEST_F(Test_YamlParser, yaml_trace_source_replay_window)
+{
+    auto config = Deserialize<ParticipantConfiguration>(R"(
+Tracing:
+  TraceSources:
+  - Name: Source1
+    Type: PcapFile
+    InputPath: Source1.pcap
+    Experimental:
+      StartTime: 30000
+)");
+    ASSERT_EQ(config.tracing.traceSources.size(), 1u);
+    EXPECT_EQ(config.tracing.traceSources.at(0).replayWindow.startTime, std::chrono::seconds{30});
+
+    auto txt = Serialize(config);
+    auto config2 = Deserialize<ParticipantConfiguration>(txt);
+    EXPECT_EQ(config, config2);
+}
+
 TEST_F(Test_YamlParser, middleware_convert)
 {
     auto config = Deserialize<Middleware>(R"(
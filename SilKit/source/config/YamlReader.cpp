@@ -241,11 +241,34 @@ void YamlReader::Read(SilKit::Config::Sink& obj)
     }
 }
 
+void YamlReader::Read(SilKit::Config::AsyncLogging::OverflowPolicy& obj)
+{
+    if (IsString("Drop"))
+    {
+        obj = SilKit::Config::AsyncLogging::OverflowPolicy::Drop;
+    }
+    else if (IsString("Block"))
+    {
+        obj = SilKit::Config::AsyncLogging::OverflowPolicy::Block;
+    }
+    else
+    {
+        throw MakeConfigurationError("Unknown AsyncLogging::OverflowPolicy");
+    }
+}
+
+void YamlReader::Read(SilKit::Config::AsyncLogging& obj)
+{
+    OptionalRead(obj.queueSize, "AsyncQueueSize");
+    OptionalRead(obj.overflowPolicy, "AsyncOverflowPolicy");
+}
+
 void YamlReader::Read(SilKit::Config::Logging& obj)
 {
     OptionalRead(obj.logFromRemotes, "LogFromRemotes");
     OptionalRead(obj.flushLevel, "FlushLevel");
     OptionalRead(obj.sinks, "Sinks");
+    OptionalRead(obj.async, "Experimental");
 }
 
 void YamlReader::Read(SilKit::Config::MetricsSink::Type& obj)
@@ -278,6 +301,7 @@ void YamlReader::Read(SilKit::Config::Metrics& obj)
 {
     OptionalRead(obj.sinks, "Sinks");
     OptionalRead(obj.collectFromRemote, "CollectFromRemote");
+    OptionalRead(obj.collectLinkLatency, "CollectLinkLatency");
 
     // UpdateInterval is an integer count of seconds; keep the default if the key is absent
     std::chrono::seconds::rep updateIntervalSeconds{obj.updateInterval.count()};
@@ -406,11 +430,36 @@ void YamlReader::Read(SilKit::Config::Tracing& obj)
     OptionalRead(obj.traceSources, "TraceSources");
 }
 
+void YamlReader::Read(SilKit::Config::TraceSinkBuffering::OverflowPolicy& obj)
+{
+    if (IsString("Drop"))
+    {
+        obj = SilKit::Config::TraceSinkBuffering::OverflowPolicy::Drop;
+    }
+    else if (IsString("Block"))
+    {
+        obj = SilKit::Config::TraceSinkBuffering::OverflowPolicy::Block;
+    }
+    else
+    {
+        throw MakeConfigurationError("Unknown TraceSinkBuffering::OverflowPolicy");
+    }
+}
+
+void YamlReader::Read(SilKit::Config::TraceSinkBuffering& obj)
+{
+    OptionalRead(obj.blockSize, "BufferBlockSize");
+    OptionalRead(obj.maxBlocks, "BufferMaxBlocks");
+    OptionalRead(obj.flushInterval, "FlushInterval");
+    OptionalRead(obj.overflowPolicy, "OverflowPolicy");
+}
+
 void YamlReader::Read(SilKit::Config::TraceSink& obj)
 {
     ReadKeyValue(obj.name, "Name");
     ReadKeyValue(obj.type, "Type");
     ReadKeyValue(obj.outputPath, "OutputPath");
+    OptionalRead(obj.buffering, "Experimental");
 }
 
 
@@ -429,11 +478,17 @@ void YamlReader::Read(SilKit::Config::TraceSink::Type& obj)
         throw MakeConfigurationError("Unknown TraceSink::Type");
     }
 }
+void YamlReader::Read(SilKit::Config::TraceSourceReplayWindow& obj)
+{
+    OptionalRead(obj.startTime, "StartTime");
+}
+
 void YamlReader::Read(SilKit::Config::TraceSource& obj)
 {
     ReadKeyValue(obj.name, "Name");
     ReadKeyValue(obj.type, "Type");
     ReadKeyValue(obj.inputPath, "InputPath");
+    OptionalRead(obj.replayWindow, "Experimental");
 }
 
 void YamlReader::Read(SilKit::Config::TraceSource::Type& obj)
@@ -468,6 +523,9 @@ void YamlReader::Read(SilKit::Config::Middleware& obj)
     OptionalRead(obj.registryAsFallbackProxy, "RegistryAsFallbackProxy");
     OptionalRead(obj.experimentalRemoteParticipantConnection, "ExperimentalRemoteParticipantConnection");
     OptionalRead(obj.connectTimeoutSeconds, "ConnectTimeoutSeconds");
+    OptionalRead(obj.enableSharedMemory, "EnableSharedMemory");
+    OptionalRead(obj.receiveThreads, "ReceiveThreads");
+    OptionalRead(obj.lazyPeerConnections, "LazyPeerConnections");
 }
 
 void YamlReader::Read(SilKit::Config::Includes& obj)
@@ -495,6 +553,12 @@ void YamlReader::Read(SilKit::Config::TimeSynchronization& obj)
     OptionalRead(obj.animationFactor, "AnimationFactor");
     OptionalRead(obj.enableMessageAggregation, "EnableMessageAggregation");
     OptionalRead(obj.dynamicSimulationStep, "DynamicSimulationStep");
+    OptionalRead(obj.aggregator, "Aggregator");
+
+    // SpinWaitBudget is an integer count of microseconds; keep the default if the key is absent
+    std::chrono::microseconds::rep spinWaitBudgetMicroseconds{obj.spinWaitBudget.count()};
+    OptionalRead(spinWaitBudgetMicroseconds, "SpinWaitBudget");
+    obj.spinWaitBudget = std::chrono::microseconds{spinWaitBudgetMicroseconds};
 }
 
 void YamlReader::Read(SilKit::Config::Experimental& obj)
@@ -316,6 +316,8 @@ public:
     void Read(SilKit::Config::Sink::Type& obj);
     void Read(SilKit::Config::Sink::Format& obj);
     void Read(SilKit::Config::Sink& obj);
+    void Read(SilKit::Config::AsyncLogging::OverflowPolicy& obj);
+    void Read(SilKit::Config::AsyncLogging& obj);
     void Read(SilKit::Config::Logging& obj);
     void Read(SilKit::Config::MetricsSink::Type& obj);
     void Read(SilKit::Config::MetricsSink& obj);
@@ -334,8 +336,11 @@ public:
     void Read(SilKit::Config::RpcServer& obj);
     void Read(SilKit::Config::RpcClient& obj);
     void Read(SilKit::Config::Tracing& obj);
+    void Read(SilKit::Config::TraceSinkBuffering::OverflowPolicy& obj);
+    void Read(SilKit::Config::TraceSinkBuffering& obj);
     void Read(SilKit::Config::TraceSink& obj);
     void Read(SilKit::Config::TraceSink::Type& obj);
+    void Read(SilKit::Config::TraceSourceReplayWindow& obj);
     void Read(SilKit::Config::TraceSource& obj);
     void Read(SilKit::Config::TraceSource::Type& obj);
     void Read(SilKit::Config::Extensions& obj);
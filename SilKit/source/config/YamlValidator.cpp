@@ -140,14 +140,17 @@ const std::set<std::string> schemaPaths_v1 = {
     "/Experimental",
     "/Experimental/Metrics",
     "/Experimental/Metrics/CollectFromRemote",
+    "/Experimental/Metrics/CollectLinkLatency",
     "/Experimental/Metrics/Sinks",
     "/Experimental/Metrics/Sinks/Name",
     "/Experimental/Metrics/Sinks/Type",
     "/Experimental/Metrics/UpdateInterval",
     "/Experimental/TimeSynchronization",
+    "/Experimental/TimeSynchronization/Aggregator",
     "/Experimental/TimeSynchronization/AnimationFactor",
     "/Experimental/TimeSynchronization/DynamicSimulationStep",
     "/Experimental/TimeSynchronization/EnableMessageAggregation",
+    "/Experimental/TimeSynchronization/SpinWaitBudget",
     "/Extensions",
     "/Extensions/SearchPathHints",
     "/FlexrayControllers",
@@ -309,6 +312,9 @@ const std::set<std::string> schemaPaths_v1 = {
     "/LinControllers/Replay/UseTraceSource",
     "/LinControllers/UseTraceSinks",
     "/Logging",
+    "/Logging/Experimental",
+    "/Logging/Experimental/AsyncOverflowPolicy",
+    "/Logging/Experimental/AsyncQueueSize",
     "/Logging/FlushLevel",
     "/Logging/LogFromRemotes",
     "/Logging/Sinks",
@@ -324,7 +330,10 @@ const std::set<std::string> schemaPaths_v1 = {
     "/Middleware/ConnectAttempts",
     "/Middleware/ConnectTimeoutSeconds",
     "/Middleware/EnableDomainSockets",
+    "/Middleware/EnableSharedMemory",
     "/Middleware/ExperimentalRemoteParticipantConnection",
+    "/Middleware/LazyPeerConnections",
+    "/Middleware/ReceiveThreads",
     "/Middleware/RegistryAsFallbackProxy",
     "/Middleware/RegistryUri",
     "/Middleware/TcpNoDelay",
@@ -376,10 +385,17 @@ const std::set<std::string> schemaPaths_v1 = {
     "/SchemaVersion",
     "/Tracing",
     "/Tracing/TraceSinks",
+    "/Tracing/TraceSinks/Experimental",
+    "/Tracing/TraceSinks/Experimental/BufferBlockSize",
+    "/Tracing/TraceSinks/Experimental/BufferMaxBlocks",
+    "/Tracing/TraceSinks/Experimental/FlushInterval",
+    "/Tracing/TraceSinks/Experimental/OverflowPolicy",
     "/Tracing/TraceSinks/Name",
     "/Tracing/TraceSinks/OutputPath",
     "/Tracing/TraceSinks/Type",
     "/Tracing/TraceSources",
+    "/Tracing/TraceSources/Experimental",
+    "/Tracing/TraceSources/Experimental/StartTime",
     "/Tracing/TraceSources/InputPath",
     "/Tracing/TraceSources/Name",
     "/Tracing/TraceSources/Type",
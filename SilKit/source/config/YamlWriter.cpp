@@ -239,6 +239,29 @@ void YamlWriter::Write(const SilKit::Config::Sink& obj)
 }
 
 
+void YamlWriter::Write(const SilKit::Config::AsyncLogging::OverflowPolicy& obj)
+{
+    switch (obj)
+    {
+    case SilKit::Config::AsyncLogging::OverflowPolicy::Drop:
+        Write("Drop");
+        break;
+    case SilKit::Config::AsyncLogging::OverflowPolicy::Block:
+        Write("Block");
+        break;
+    }
+}
+
+
+void YamlWriter::Write(const SilKit::Config::AsyncLogging& obj)
+{
+    static const SilKit::Config::AsyncLogging defaultObj{};
+    MakeMap();
+    NonDefaultWrite(obj.queueSize, "AsyncQueueSize", defaultObj.queueSize);
+    NonDefaultWrite(obj.overflowPolicy, "AsyncOverflowPolicy", defaultObj.overflowPolicy);
+}
+
+
 void YamlWriter::Write(const SilKit::Config::Logging& obj)
 {
     static const SilKit::Config::Logging defaultLogger{};
@@ -247,6 +270,7 @@ void YamlWriter::Write(const SilKit::Config::Logging& obj)
     NonDefaultWrite(obj.flushLevel, "FlushLevel", defaultLogger.flushLevel);
     // ParticipantConfiguration.schema.json: this is a required property:
     WriteKeyValue("Sinks", obj.sinks);
+    NonDefaultWrite(obj.async, "Experimental", defaultLogger.async);
 }
 
 
@@ -292,6 +316,7 @@ void YamlWriter::Write(const SilKit::Config::Metrics& obj)
     }
     // UpdateInterval is serialized as an integer count of seconds
     NonDefaultWrite(obj.updateInterval.count(), "UpdateInterval", defaultObj.updateInterval.count());
+    NonDefaultWrite(obj.collectLinkLatency, "CollectLinkLatency", defaultObj.collectLinkLatency);
 }
 
 
@@ -453,12 +478,39 @@ void YamlWriter::Write(const SilKit::Config::Tracing& obj)
     OptionalWrite(obj.traceSources, "TraceSources");
 }
 
+void YamlWriter::Write(const SilKit::Config::TraceSinkBuffering::OverflowPolicy& obj)
+{
+    switch (obj)
+    {
+    case SilKit::Config::TraceSinkBuffering::OverflowPolicy::Drop:
+        Write("Drop");
+        break;
+    case SilKit::Config::TraceSinkBuffering::OverflowPolicy::Block:
+        Write("Block");
+        break;
+    }
+}
+
+
+void YamlWriter::Write(const SilKit::Config::TraceSinkBuffering& obj)
+{
+    static const SilKit::Config::TraceSinkBuffering defaultObj{};
+    MakeMap();
+    NonDefaultWrite(obj.blockSize, "BufferBlockSize", defaultObj.blockSize);
+    NonDefaultWrite(obj.maxBlocks, "BufferMaxBlocks", defaultObj.maxBlocks);
+    NonDefaultWrite(obj.flushInterval, "FlushInterval", defaultObj.flushInterval);
+    NonDefaultWrite(obj.overflowPolicy, "OverflowPolicy", defaultObj.overflowPolicy);
+}
+
+
 void YamlWriter::Write(const SilKit::Config::TraceSink& obj)
 {
+    static const SilKit::Config::TraceSink defaultObj{};
     MakeMap();
     WriteKeyValue("Name", obj.name);
     WriteKeyValue("Type", obj.type);
     WriteKeyValue("OutputPath", obj.outputPath);
+    NonDefaultWrite(obj.buffering, "Experimental", defaultObj.buffering);
 }
 
 
@@ -484,12 +536,22 @@ void YamlWriter::Write(const SilKit::Config::TraceSink::Type& obj)
 }
 
 
+void YamlWriter::Write(const SilKit::Config::TraceSourceReplayWindow& obj)
+{
+    static const SilKit::Config::TraceSourceReplayWindow defaultObj{};
+    MakeMap();
+    NonDefaultWrite(obj.startTime, "StartTime", defaultObj.startTime);
+}
+
+
 void YamlWriter::Write(const SilKit::Config::TraceSource& obj)
 {
+    static const SilKit::Config::TraceSource defaultObj{};
     MakeMap();
     WriteKeyValue("Name", obj.name);
     WriteKeyValue("Type", obj.type);
     WriteKeyValue("InputPath", obj.inputPath);
+    NonDefaultWrite(obj.replayWindow, "Experimental", defaultObj.replayWindow);
 }
 
 
@@ -536,6 +598,9 @@ void YamlWriter::Write(const SilKit::Config::Middleware& obj)
     NonDefaultWrite(obj.experimentalRemoteParticipantConnection, "ExperimentalRemoteParticipantConnection",
                     defaultObj.experimentalRemoteParticipantConnection);
     NonDefaultWrite(obj.connectTimeoutSeconds, "ConnectTimeoutSeconds", defaultObj.connectTimeoutSeconds);
+    NonDefaultWrite(obj.enableSharedMemory, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    NonDefaultWrite(obj.receiveThreads, "ReceiveThreads", defaultObj.receiveThreads);
+    NonDefaultWrite(obj.lazyPeerConnections, "LazyPeerConnections", defaultObj.lazyPeerConnections);
 }
 
 
@@ -574,6 +639,8 @@ void YamlWriter::Write(const SilKit::Config::TimeSynchronization& obj)
     {
         WriteKeyValue("DynamicSimulationStep", obj.dynamicSimulationStep.value());
     }
+    NonDefaultWrite(obj.aggregator, "Aggregator", defaultObj.aggregator);
+    NonDefaultWrite(obj.spinWaitBudget.count(), "SpinWaitBudget", defaultObj.spinWaitBudget.count());
 }
 
 
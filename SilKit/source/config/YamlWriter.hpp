@@ -155,6 +155,8 @@ public:
     void Write(const SilKit::Config::Sink::Type& obj);
     void Write(const SilKit::Config::Sink::Format& obj);
     void Write(const SilKit::Config::Sink& obj);
+    void Write(const SilKit::Config::AsyncLogging::OverflowPolicy& obj);
+    void Write(const SilKit::Config::AsyncLogging& obj);
     void Write(const SilKit::Config::Logging& obj);
     void Write(const SilKit::Config::MetricsSink::Type& obj);
     void Write(const SilKit::Config::MetricsSink& obj);
@@ -173,8 +175,11 @@ public:
     void Write(const SilKit::Config::RpcServer& obj);
     void Write(const SilKit::Config::RpcClient& obj);
     void Write(const SilKit::Config::Tracing& obj);
+    void Write(const SilKit::Config::TraceSinkBuffering::OverflowPolicy& obj);
+    void Write(const SilKit::Config::TraceSinkBuffering& obj);
     void Write(const SilKit::Config::TraceSink& obj);
     void Write(const SilKit::Config::TraceSink::Type& obj);
+    void Write(const SilKit::Config::TraceSourceReplayWindow& obj);
     void Write(const SilKit::Config::TraceSource& obj);
     void Write(const SilKit::Config::TraceSource::Type& obj);
     void Write(const SilKit::Config::Extensions& obj);
@@ -158,6 +158,8 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Discovery::ParticipantDiscoveryEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
+                         const Discovery::CompactParticipantDiscoveryEvent& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Discovery::ServiceDiscoveryEvent& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const RequestReply::RequestReplyCall& msg) = 0;
@@ -252,6 +254,8 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Discovery::ParticipantDiscoveryEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Discovery::CompactParticipantDiscoveryEvent& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Discovery::ServiceDiscoveryEvent& msg) = 0;
 
@@ -325,6 +329,8 @@ public:
                                           const std::string& controllerName,
                                           const SilKit::Config::SimulatedNetwork& simulatedNetwork) = 0;
     virtual bool ParticipantHasCapability(const std::string& participantName, const std::string& capability) const = 0;
+    //! \brief Connect to the participant, if connecting to it was deferred due to lazy peer connections.
+    virtual void ConnectParticipantOnDemand(const std::string& participantName) = 0;
 
     virtual std::string GetServiceDescriptorString(
         SilKit::Experimental::NetworkSimulation::ControllerDescriptor controllerDescriptor) = 0;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <string>
 #include <type_traits>
@@ -14,6 +15,7 @@
 #include <stdexcept>
 #include <map>
 #include <unordered_map>
+#include <memory>
 
 #include "silkit/util/Span.hpp"
 
@@ -58,9 +60,13 @@ public:
     // Constructors and Destructor
     inline MessageBuffer() = default;
     inline MessageBuffer(std::vector<uint8_t> data);
+    //! Read from a shared frame, Util::SharedVector<uint8_t> values are deserialized as views into the frame
+    inline MessageBuffer(std::shared_ptr<std::vector<uint8_t>> frame);
 
     MessageBuffer(const MessageBuffer& other) = default;
     MessageBuffer(MessageBuffer&& other) = default;
+    //! Copy of the other buffer, which stores the data in the given storage (e.g., to reuse its capacity)
+    inline MessageBuffer(const MessageBuffer& other, std::vector<uint8_t> storage);
 
 public:
     // ----------------------------------------
@@ -99,23 +105,16 @@ public:
     template <typename IntegerT, typename std::enable_if_t<std::is_integral_v<IntegerT>, int> = 0>
     inline MessageBuffer& operator<<(IntegerT t)
     {
-        if (_wPos + sizeof(IntegerT) > _storage.size())
-        {
-            _storage.resize(_storage.size() + sizeof(IntegerT));
-        }
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(IntegerT));
-
-        _wPos += sizeof(IntegerT);
-
+        WriteBytes(&t, sizeof(IntegerT));
         return *this;
     }
     template <typename IntegerT, typename std::enable_if_t<std::is_integral_v<IntegerT>, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        if (_rPos + sizeof(IntegerT) > Storage().size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, Storage().data() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -129,14 +128,7 @@ public:
         static_assert(std::numeric_limits<double>::is_iec559,
                       "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_wPos + sizeof(DoubleT) > _storage.size())
-        {
-            _storage.resize(_storage.size() + sizeof(DoubleT));
-        }
-
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(DoubleT));
-        _wPos += sizeof(DoubleT);
-
+        WriteBytes(&t, sizeof(DoubleT));
         return *this;
     }
     template <typename DoubleT, typename std::enable_if_t<std::is_floating_point<DoubleT>::value, int> = 0>
@@ -145,10 +137,10 @@ public:
         static_assert(std::numeric_limits<double>::is_iec559,
                       "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        if (_rPos + sizeof(DoubleT) > Storage().size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, Storage().data() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -248,16 +240,56 @@ public:
 public:
     void IncreaseCapacity(size_t capacity)
     {
-        _storage.reserve(_storage.size() + capacity);
+        if (_countSizeOnly)
+        {
+            return;
+        }
+
+        // grow geometrically, reserving the exact size for every field would reallocate for each of them
+        auto& storage = Storage();
+        const auto requiredCapacity = storage.size() + capacity;
+        if (requiredCapacity > storage.capacity())
+        {
+            storage.reserve(std::max(requiredCapacity, 2 * storage.capacity()));
+        }
+    }
+
+    //! \brief Only count the bytes which are written instead of storing them, see WritePos()
+    //!
+    //! Serializing a message into such a buffer yields its exact encoded size without copying any payload.
+    inline void CountSizeOnly();
+    inline auto WritePos() const -> size_t;
+
+    //! \brief Overwrite an already written integral value at the given byte offset, e.g., to patch a header field
+    template <typename IntegerT, typename std::enable_if_t<std::is_integral_v<IntegerT>, int> = 0>
+    inline void OverwriteAt(size_t pos, IntegerT t)
+    {
+        if (pos + sizeof(IntegerT) > _wPos)
+            throw end_of_buffer{};
+
+        if (!_countSizeOnly)
+        {
+            std::memcpy(Storage().data() + pos, &t, sizeof(IntegerT));
+        }
     }
 
+private:
+    // ----------------------------------------
+    // private methods
+    inline void WriteBytes(const void* data, size_t size);
+    inline auto Storage() -> std::vector<uint8_t>&;
+    inline auto Storage() const -> const std::vector<uint8_t>&;
+
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    // replaces _storage if the buffer was constructed from a shared frame (copies of the buffer share the frame)
+    std::shared_ptr<std::vector<uint8_t>> _sharedStorage;
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
+    bool _countSizeOnly{false};
 };
 
 // ================================================================================
@@ -270,16 +302,85 @@ MessageBuffer::MessageBuffer(std::vector<uint8_t> data)
 {
 }
 
+MessageBuffer::MessageBuffer(std::shared_ptr<std::vector<uint8_t>> frame)
+    : _sharedStorage{std::move(frame)}
+    , _wPos{_sharedStorage->size()}
+    , _rPos{0u}
+{
+}
+
+MessageBuffer::MessageBuffer(const MessageBuffer& other, std::vector<uint8_t> storage)
+    : _protocolVersion{other._protocolVersion}
+    , _storage{std::move(storage)}
+    , _wPos{other._wPos}
+    , _rPos{other._rPos}
+    , _countSizeOnly{other._countSizeOnly}
+{
+    _storage.assign(other.Storage().begin(), other.Storage().end());
+}
+
 auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
     _wPos = 0u;
     _rPos = 0u;
+    if (_sharedStorage)
+    {
+        // the frame might still be referenced by deserialized values or a frame pool
+        std::vector<uint8_t> storage =
+            (_sharedStorage.use_count() == 1) ? std::move(*_sharedStorage) : *_sharedStorage;
+        _sharedStorage.reset();
+        return storage;
+    }
     return std::move(_storage);
 }
 
+void MessageBuffer::CountSizeOnly()
+{
+    _countSizeOnly = true;
+}
+
+auto MessageBuffer::WritePos() const -> size_t
+{
+    return _wPos;
+}
+
+void MessageBuffer::WriteBytes(const void* data, size_t size)
+{
+    if (!_countSizeOnly && size != 0)
+    {
+        auto& storage = Storage();
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (_wPos == storage.size())
+        {
+            // appending avoids zero-initializing the bytes which are overwritten right away
+            storage.insert(storage.end(), bytes, bytes + size);
+        }
+        else
+        {
+            if (_wPos + size > storage.size())
+            {
+                storage.resize(_wPos + size);
+            }
+            std::memcpy(storage.data() + _wPos, bytes, size);
+        }
+    }
+
+    _wPos += size;
+}
+
+auto MessageBuffer::Storage() -> std::vector<uint8_t>&
+{
+    return _sharedStorage ? *_sharedStorage : _storage;
+}
+
+auto MessageBuffer::Storage() const -> const std::vector<uint8_t>&
+{
+    return _sharedStorage ? *_sharedStorage : _storage;
+}
+
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    return (_rPos > Storage().size()) ? 0 : (Storage().size() - _rPos);
 }
 
 // --------------------------------------------------------------------------------
@@ -292,14 +393,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::string& str)
     IncreaseCapacity(sizeof(uint32_t) + str.size());
 
     *this << static_cast<uint32_t>(str.length());
-
-    if (_wPos + str.size() > _storage.size())
-    {
-        _storage.resize(_wPos + str.size());
-    }
-
-    std::copy(str.begin(), str.end(), _storage.begin() + static_cast<decltype(_storage)::difference_type>(_wPos));
-    _wPos += str.size();
+    WriteBytes(str.data(), str.size());
 
     return *this;
 }
@@ -308,10 +402,10 @@ MessageBuffer& MessageBuffer::operator>>(std::string& str)
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    if (_rPos + strLength > Storage().size())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + static_cast<decltype(_storage)::difference_type>(_rPos), _storage.begin() + static_cast<decltype(_storage)::difference_type>(_rPos + strLength));
+    str = std::string(Storage().begin() + static_cast<std::ptrdiff_t>(_rPos), Storage().begin() + static_cast<std::ptrdiff_t>(_rPos + strLength));
     _rPos += strLength;
 
     return *this;
@@ -329,12 +423,12 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > Storage().size())
         throw end_of_buffer{};
 
     vector =
-        std::vector<uint8_t>(_storage.begin() + static_cast<decltype(_storage)::difference_type>(_rPos),
-                             _storage.begin() + static_cast<decltype(_storage)::difference_type>(_rPos + vectorSize));
+        std::vector<uint8_t>(Storage().begin() + static_cast<std::ptrdiff_t>(_rPos),
+                             Storage().begin() + static_cast<std::ptrdiff_t>(_rPos + vectorSize));
     _rPos += vectorSize;
 
     return *this;
@@ -365,7 +459,7 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > Storage().size())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -394,15 +488,8 @@ inline MessageBuffer& MessageBuffer::operator<<(const Util::Span<const uint8_t>&
     IncreaseCapacity(sizeof(uint32_t) + span.size());
 
     *this << static_cast<uint32_t>(span.size());
+    WriteBytes(span.data(), span.size());
 
-
-    if (_wPos + span.size() > _storage.size())
-    {
-        _storage.resize(_wPos + span.size());
-    }
-
-    std::copy(span.begin(), span.end(), _storage.begin() + static_cast<decltype(_storage)::difference_type>(_wPos));
-    _wPos += span.size();
     return *this;
 }
 
@@ -436,6 +523,25 @@ inline MessageBuffer& MessageBuffer::operator<<(const Util::SharedVector<ValueT>
 template <typename ValueT>
 inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& sharedData)
 {
+    if constexpr (std::is_same_v<ValueT, uint8_t>)
+    {
+        if (_sharedStorage)
+        {
+            // zero-copy: reference the bytes inside of the shared frame
+            uint32_t vectorSize{0u};
+            *this >> vectorSize;
+
+            if (_rPos + vectorSize > _sharedStorage->size())
+                throw end_of_buffer{};
+
+            sharedData = Util::SharedVector<uint8_t>{
+                _sharedStorage, Util::Span<const uint8_t>{_sharedStorage->data() + _rPos, vectorSize}};
+            _rPos += vectorSize;
+
+            return *this;
+        }
+    }
+
     std::vector<ValueT> vector;
     *this >> vector;
 
@@ -452,23 +558,17 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
     if (array.size() > std::numeric_limits<uint32_t>::max())
         throw end_of_buffer{};
 
-    if (_wPos + array.size() > _storage.size())
-    {
-        _storage.resize(_wPos + array.size());
-    }
-
-    std::copy(array.begin(), array.end(), _storage.begin() + _wPos);
-    _wPos += array.size();
+    WriteBytes(array.data(), array.size());
 
     return *this;
 }
 template <size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > Storage().size())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(Storage().begin() + _rPos, Storage().begin() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -490,7 +590,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template <typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > Storage().size())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -668,7 +768,7 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return Storage();
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
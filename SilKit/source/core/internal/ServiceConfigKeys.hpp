@@ -76,6 +76,12 @@ const std::string timeSyncActive = "TimeSyncActive";
 // Set to "1" by a participant that requests dynamic simulation step sizes for the whole simulation
 // (e.g. a network simulator). Peers that are not a hard opt-out enable dynamic stepping when they see it.
 const std::string timeSyncDynamicStepSize = "TimeSyncDynamicStepSize";
+// Name of the participant that aggregates the NextSimTasks of this participant in the hierarchical time synchronization.
+// Empty (or absent) if the participant is not part of a subtree.
+const std::string timeSyncAggregator = "TimeSyncAggregator";
+// Lookahead of the participant in nanoseconds: nothing it sends in the step starting at its next time point affects
+// others before this time point plus the lookahead. Empty (or absent) if no lookahead was declared.
+const std::string timeSyncLookahead = "TimeSyncLookahead";
 
 } // namespace Discovery
 } // namespace Core
@@ -120,6 +120,47 @@ TEST(Test_MessageBuffer, std_vector_uint8_t)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_MessageBuffer, shared_vector_uint8_t)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    std::vector<uint8_t> in{1, 2, 3, 4, 5};
+    SilKit::Util::SharedVector<uint8_t> out;
+
+    buffer << SilKit::Util::SharedVector<uint8_t>{in};
+    buffer >> out;
+
+    EXPECT_EQ(in, SilKit::Util::ToStdVector(out.AsSpan()));
+}
+
+TEST(Test_MessageBuffer, shared_vector_uint8_t_references_shared_frame)
+{
+    SilKit::Core::MessageBuffer writeBuffer;
+
+    std::vector<uint8_t> in{1, 2, 3, 4, 5};
+    uint32_t trailer{1234};
+    writeBuffer << SilKit::Util::SharedVector<uint8_t>{in} << trailer;
+
+    auto frame = std::make_shared<std::vector<uint8_t>>(writeBuffer.ReleaseStorage());
+    SilKit::Core::MessageBuffer readBuffer{frame};
+
+    SilKit::Util::SharedVector<uint8_t> out;
+    uint32_t outTrailer{0};
+    readBuffer >> out >> outTrailer;
+
+    EXPECT_EQ(in, SilKit::Util::ToStdVector(out.AsSpan()));
+    EXPECT_EQ(trailer, outTrailer);
+
+    // the payload is a view into the frame, which is kept alive by the deserialized value
+    EXPECT_EQ(out.AsSpan().data(), frame->data() + sizeof(uint32_t));
+    EXPECT_GT(frame.use_count(), 1);
+    std::weak_ptr<std::vector<uint8_t>> weakFrame{frame};
+    frame.reset();
+    readBuffer = SilKit::Core::MessageBuffer{};
+    EXPECT_FALSE(weakFrame.expired());
+    EXPECT_EQ(in, SilKit::Util::ToStdVector(out.AsSpan()));
+}
+
 TEST(Test_MessageBuffer, std_vector_string)
 {
     SilKit::Core::MessageBuffer buffer;
@@ -218,3 +259,21 @@ TEST(Test_MessageBuffer, mixed_types)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_MessageBuffer, count_size_only)
+{
+    SilKit::Core::MessageBuffer buffer;
+    SilKit::Core::MessageBuffer sizeCounter;
+    sizeCounter.CountSizeOnly();
+
+    const std::vector<std::string> strings{"A", "BC", "DEF"};
+    const std::vector<uint8_t> bytes(100, 0xAB);
+    const std::array<uint8_t, 3> array{1, 2, 3};
+
+    buffer << 1.5 << uint16_t{2} << std::string{"This looks nice!"} << strings << bytes << array << 17ns;
+    sizeCounter << 1.5 << uint16_t{2} << std::string{"This looks nice!"} << strings << bytes << array << 17ns;
+
+    EXPECT_EQ(sizeCounter.WritePos(), buffer.WritePos());
+    EXPECT_EQ(sizeCounter.WritePos(), buffer.PeekData().size());
+    EXPECT_EQ(sizeCounter.PeekData().size(), 0u);
+}
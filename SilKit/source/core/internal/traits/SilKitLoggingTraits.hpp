@@ -76,6 +76,8 @@ DefineSilKitLoggingTrait_Topic(SilKit::Core::RemoteConnectionManager, SilKit::Se
 DefineSilKitLoggingTrait_Topic(SilKit::Core::VAsioPeer, SilKit::Services::Logging::Topic::Asio);
 DefineSilKitLoggingTrait_Topic(VSilKit::ConnectPeer, SilKit::Services::Logging::Topic::Asio);
 DefineSilKitLoggingTrait_Topic(VSilKit::AsioGenericRawByteStream, SilKit::Services::Logging::Topic::Asio);
+DefineSilKitLoggingTrait_Topic(VSilKit::SharedMemoryRawByteStream, SilKit::Services::Logging::Topic::Asio);
+DefineSilKitLoggingTrait_Topic(VSilKit::SharedMemoryHandshake, SilKit::Services::Logging::Topic::Asio);
 
 
 DefineSilKitLoggingTrait_Topic(SilKit::Dashboard::DashboardRestClient, SilKit::Services::Logging::Topic::Dashboard);
@@ -144,6 +146,7 @@ DefineSilKitLoggingTrait_Topic(SilKit::Services::Rpc::FunctionCall, SilKit::Serv
 DefineSilKitLoggingTrait_Topic(SilKit::Services::Rpc::FunctionCallResponse, SilKit::Services::Logging::Topic::Rpc);
 
 DefineSilKitLoggingTrait_Topic(SilKit::Core::Discovery::ParticipantDiscoveryEvent, SilKit::Services::Logging::Topic::ServiceDiscovery);
+DefineSilKitLoggingTrait_Topic(SilKit::Core::Discovery::CompactParticipantDiscoveryEvent, SilKit::Services::Logging::Topic::ServiceDiscovery);
 DefineSilKitLoggingTrait_Topic(SilKit::Core::Discovery::ServiceDiscoveryEvent, SilKit::Services::Logging::Topic::ServiceDiscovery);
 
 DefineSilKitLoggingTrait_Topic(SilKit::Core::RequestReply::RequestReplyCall, SilKit::Services::Logging::Topic::RequestReply);
@@ -64,6 +64,7 @@ DefineSilKitMsgTrait_SerdesName(SilKit::Services::Flexray::FlexrayTxBufferConfig
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Flexray::WireFlexrayTxBufferUpdate, "TXBUFFERUPDATE");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Flexray::FlexrayPocStatusEvent, "POCSTATUS");
 DefineSilKitMsgTrait_SerdesName(SilKit::Core::Discovery::ParticipantDiscoveryEvent, "SERVICEANNOUNCEMENT");
+DefineSilKitMsgTrait_SerdesName(SilKit::Core::Discovery::CompactParticipantDiscoveryEvent, "COMPACTSERVICEANNOUNCEMENT");
 DefineSilKitMsgTrait_SerdesName(SilKit::Core::Discovery::ServiceDiscoveryEvent, "SERVICEDISCOVERYEVENT");
 DefineSilKitMsgTrait_SerdesName(SilKit::Core::RequestReply::RequestReplyCall, "REQUESTREPLYCALL");
 DefineSilKitMsgTrait_SerdesName(SilKit::Core::RequestReply::RequestReplyCallReturn, "REQUESTREPLYCALLRETURN");
@@ -57,6 +57,14 @@ struct SilKitMsgTraitForbidSelfDelivery
         return false;
     }
 };
+template <class MsgT>
+struct SilKitMsgTraitDispatchOnReceiveThread
+{
+    static constexpr bool IsDispatchedOnReceiveThread()
+    {
+        return false;
+    }
+};
 
 // The final message traits
 template <class MsgT>
@@ -67,6 +75,7 @@ struct SilKitMsgTraits
     , SilKitMsgTraitVersion<MsgT>
     , SilKitMsgTraitSerdesName<MsgT>
     , SilKitMsgTraitForbidSelfDelivery<MsgT>
+    , SilKitMsgTraitDispatchOnReceiveThread<MsgT>
 {
 };
 
@@ -110,6 +119,16 @@ struct SilKitMsgTraits
         } \
     }
 
+#define DefineSilKitMsgTrait_DispatchOnReceiveThread(Namespace, MsgName) \
+    template <> \
+    struct SilKitMsgTraitDispatchOnReceiveThread<Namespace::MsgName> \
+    { \
+        static constexpr bool IsDispatchedOnReceiveThread() \
+        { \
+            return true; \
+        } \
+    }
+
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg);
 DefineSilKitMsgTrait_TypeName(VSilKit, MetricsUpdate);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, SystemCommand);
@@ -146,6 +165,7 @@ DefineSilKitMsgTrait_TypeName(SilKit::Services::Flexray, FlexrayTxBufferConfigUp
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Flexray, WireFlexrayTxBufferUpdate);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Flexray, FlexrayPocStatusEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Core::Discovery, ParticipantDiscoveryEvent);
+DefineSilKitMsgTrait_TypeName(SilKit::Core::Discovery, CompactParticipantDiscoveryEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Core::Discovery, ServiceDiscoveryEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Core::RequestReply, RequestReplyCall);
 DefineSilKitMsgTrait_TypeName(SilKit::Core::RequestReply, RequestReplyCallReturn);
@@ -153,6 +173,7 @@ DefineSilKitMsgTrait_TypeName(SilKit::Core::RequestReply, RequestReplyCallReturn
 // Messages with history
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, ParticipantStatus, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Core::Discovery, ParticipantDiscoveryEvent, 1);
+DefineSilKitMsgTrait_HistSize(SilKit::Core::Discovery, CompactParticipantDiscoveryEvent, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Services::PubSub, WireDataMessageEvent, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, WorkflowConfiguration, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Lin, WireLinControllerConfig, 1);
@@ -164,5 +185,36 @@ DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Lin, LinSendFrameHead
 // Messages with forbidden self delivery
 DefineSilKitMsgTrait_ForbidSelfDelivery(SilKit::Services::Orchestration, SystemCommand);
 
+// Bus messages, which may be dispatched by the receive threads (Middleware.ReceiveThreads)
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::PubSub, WireDataMessageEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Rpc, FunctionCall);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Rpc, FunctionCallResponse);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Can, WireCanFrameEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Can, CanFrameTransmitEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Can, CanControllerStatus);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Can, CanConfigureBaudrate);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Can, CanSetControllerMode);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Ethernet, WireEthernetFrameEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Ethernet, EthernetFrameTransmitEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Ethernet, EthernetStatus);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Ethernet, EthernetSetMode);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, LinSendFrameRequest);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, LinSendFrameHeaderRequest);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, LinTransmission);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, LinWakeupPulse);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, WireLinControllerConfig);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, LinControllerStatusUpdate);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Lin, LinFrameResponseUpdate);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, WireFlexrayFrameEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, WireFlexrayFrameTransmitEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexraySymbolEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexraySymbolTransmitEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexrayCycleStartEvent);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexrayHostCommand);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexrayControllerConfig);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexrayTxBufferConfigUpdate);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, WireFlexrayTxBufferUpdate);
+DefineSilKitMsgTrait_DispatchOnReceiveThread(SilKit::Services::Flexray, FlexrayPocStatusEvent);
+
 } // namespace Core
 } // namespace SilKit
@@ -63,6 +63,7 @@ DefineSilKitMsgTrait_Version(SilKit::Services::Flexray::FlexrayTxBufferConfigUpd
 DefineSilKitMsgTrait_Version(SilKit::Services::Flexray::WireFlexrayTxBufferUpdate, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Flexray::FlexrayPocStatusEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Core::Discovery::ParticipantDiscoveryEvent, 1);
+DefineSilKitMsgTrait_Version(SilKit::Core::Discovery::CompactParticipantDiscoveryEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Core::Discovery::ServiceDiscoveryEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Core::RequestReply::RequestReplyCall, 1);
 DefineSilKitMsgTrait_Version(SilKit::Core::RequestReply::RequestReplyCallReturn, 1);
@@ -55,6 +55,13 @@ struct NullConnection
 
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* /*peer*/, ParticipantAnnouncement)> /*callback*/) {}
     void RegisterPeerShutdownCallback(std::function<void(IVAsioPeer* peer)> /*callback*/) {}
+    void RegisterDeferredPeerConnectedCallback(std::function<void(IVAsioPeer* peer)> /*callback*/) {}
+
+    void ConnectPeersOnDemand(const ServiceDescriptor& /*serviceDescriptor*/) {}
+    void ConnectPeerOnDemand(const std::string& /*participantName*/) {}
+
+    void StartPipelinedSubscriptions() {}
+    void WaitForPipelinedSubscriptions() {}
 
     void AddAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/) {}
 
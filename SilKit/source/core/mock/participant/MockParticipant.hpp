@@ -191,6 +191,12 @@ class DummyMetricsManager : public IMetricsManager
         void Add(const std::string&) override {}
     };
 
+    class DummyHistogramMetric : public IHistogramMetric
+    {
+    public:
+        void Take(uint64_t /* value */) override {}
+    };
+
 public:
     auto GetCounter(MetricName name) -> ICounterMetric* override
     {
@@ -232,6 +238,16 @@ public:
         return &(it->second);
     }
 
+    auto GetHistogram(MetricName name) -> IHistogramMetric* override
+    {
+        auto it = _histograms.find(ToString(name));
+        if (it == _histograms.end())
+        {
+            it = _histograms.emplace().first;
+        }
+        return &(it->second);
+    }
+
     void SubmitUpdates() override {}
 
 private:
@@ -239,6 +255,7 @@ private:
     std::unordered_map<std::string, DummyStatisticMetric> _statistics;
     std::unordered_map<std::string, DummyStringListMetric> _stringLists;
     std::unordered_map<std::string, DummyAttributeMetric> _attributes;
+    std::unordered_map<std::string, DummyHistogramMetric> _histograms;
 };
 
 class DummyParticipant : public IParticipantInternal
@@ -426,6 +443,9 @@ public:
     void SendMsg(const IServiceEndpoint* /*from*/, const VSilKit::MetricsUpdate& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::CompactParticipantDiscoveryEvent& /*msg*/) override
+    {
+    }
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ServiceDiscoveryEvent& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const RequestReply::RequestReplyCall& /*msg*/) override {}
@@ -598,6 +618,10 @@ public:
                  const Discovery::ParticipantDiscoveryEvent& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Discovery::CompactParticipantDiscoveryEvent& /*msg*/) override
+    {
+    }
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const Discovery::ServiceDiscoveryEvent& /*msg*/) override
     {
@@ -702,6 +726,8 @@ public:
         return true;
     }
 
+    void ConnectParticipantOnDemand(const std::string& /*participantName*/) override {}
+
     std::string GetServiceDescriptorString(
         SilKit::Experimental::NetworkSimulation::ControllerDescriptor /*controllerDescriptor*/) override
     {
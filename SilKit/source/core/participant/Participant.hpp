@@ -218,6 +218,7 @@ public:
     void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallResponse&& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const Discovery::ParticipantDiscoveryEvent& msg) override;
+    void SendMsg(const IServiceEndpoint*, const Discovery::CompactParticipantDiscoveryEvent& msg) override;
     void SendMsg(const IServiceEndpoint*, const Discovery::ServiceDiscoveryEvent& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const RequestReply::RequestReplyCall& msg) override;
@@ -311,6 +312,8 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const Discovery::ParticipantDiscoveryEvent& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
+                 const Discovery::CompactParticipantDiscoveryEvent& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const Discovery::ServiceDiscoveryEvent& msg) override;
 
@@ -345,6 +348,7 @@ public:
                                   const SilKit::Config::SimulatedNetwork& simulatedNetwork) override;
     bool ParticipantHasCapability(const std::string& /*participantName*/,
                                   const std::string& /*capability*/) const override;
+    void ConnectParticipantOnDemand(const std::string& participantName) override;
 
     std::string GetServiceDescriptorString(
         SilKit::Experimental::NetworkSimulation::ControllerDescriptor controllerDescriptor) override;
@@ -454,6 +458,7 @@ private:
     Services::Orchestration::TimeProvider _timeProvider;
 
     std::unique_ptr<Services::Logging::ILoggerInternal> _logger;
+    bool _isMessageTracingEnabled{false};
     std::vector<std::unique_ptr<ITraceMessageSink>> _traceSinks;
     std::unique_ptr<Tracing::ReplayScheduler> _replayScheduler;
     std::unique_ptr<RequestReply::ParticipantReplies> _participantReplies;
@@ -97,6 +97,7 @@ Participant<SilKitConnectionT>::Participant(Config::ParticipantConfiguration par
     // NB: do not create the _logger in the initializer list. If participantName is empty,
     //  this will cause a fairly unintuitive exception in spdlog.
     _logger = std::make_unique<Services::Logging::Logger>(GetParticipantName(), _participantConfig.logging);
+    _isMessageTracingEnabled = Services::IsMessageTracingEnabled(_logger.get());
     dynamic_cast<VSilKit::MetricsProcessor&>(*_metricsProcessor).SetLogger(*_logger);
     dynamic_cast<VSilKit::MetricsManager&>(*_metricsManager).SetLogger(*_logger);
     _connection.SetLoggerInternal(_logger.get());
@@ -120,6 +121,10 @@ void Participant<SilKitConnectionT>::JoinSilKitSimulation()
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::OnSilKitSimulationJoined()
 {
+    // The internal services wait for their subscriptions to be acknowledged together, before the participant is
+    // returned to the user
+    _connection.StartPipelinedSubscriptions();
+
     SetupRemoteLogging();
     SetupMetrics();
 
@@ -152,6 +157,8 @@ void Participant<SilKitConnectionT>::OnSilKitSimulationJoined()
             .Dispatch();
     }
 
+    _connection.WaitForPipelinedSubscriptions();
+
     CreateParticipantAttributeMetrics();
 
     if (_metricsTimerThread)
@@ -896,6 +903,11 @@ auto Participant<SilKitConnectionT>::GetSystemMonitor() -> Services::Orchestrati
                 Services::Orchestration::ParticipantConnectionInformation{peer->GetInfo().participantName});
         });
 
+        _connection.RegisterDeferredPeerConnectedCallback([controller](IVAsioPeer* peer) {
+            controller->OnParticipantConnected(
+                Services::Orchestration::ParticipantConnectionInformation{peer->GetInfo().participantName});
+        });
+
         // Get Participant which joined the Simulation earlier
         std::vector<std::string> knownNames = _connection.GetConnectedParticipantsNames();
         for (const auto& name : knownNames)
@@ -937,6 +949,10 @@ auto Participant<SilKitConnectionT>::GetServiceDiscovery() -> Discovery::IServic
 
         _connection.RegisterPeerShutdownCallback(
             [controller](IVAsioPeer* peer) { controller->OnParticpantRemoval(peer->GetInfo().participantName); });
+
+        _connection.RegisterDeferredPeerConnectedCallback([controller](IVAsioPeer* peer) {
+            controller->OnParticipantConnectedOnDemand(peer->GetInfo().participantName);
+        });
     }
     return controller;
 }
@@ -1310,6 +1326,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
+                                             const Discovery::CompactParticipantDiscoveryEvent& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Discovery::ServiceDiscoveryEvent& msg)
 {
@@ -1333,7 +1356,10 @@ template <class SilKitConnectionT>
 template <typename SilKitMessageT>
 void Participant<SilKitConnectionT>::SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
 {
-    TraceTx(GetLoggerInternal(), from, msg);
+    if (_isMessageTracingEnabled)
+    {
+        TraceTx(GetLoggerInternal(), from, msg);
+    }
     _connection.SendMsg(from, std::forward<SilKitMessageT>(msg));
 }
 
@@ -1611,6 +1637,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Discovery::CompactParticipantDiscoveryEvent& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const Discovery::ServiceDiscoveryEvent& msg)
@@ -1637,7 +1670,10 @@ template <typename SilKitMessageT>
 void Participant<SilKitConnectionT>::SendMsgImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                                  SilKitMessageT&& msg)
 {
-    TraceTx(GetLoggerInternal(), from, targetParticipantName, msg);
+    if (_isMessageTracingEnabled)
+    {
+        TraceTx(GetLoggerInternal(), from, targetParticipantName, msg);
+    }
     _connection.SendMsg(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
 }
 
@@ -1713,6 +1749,9 @@ auto Participant<SilKitConnectionT>::CreateController(const SilKitServiceTraitCo
         _connection.RegisterSilKitService(controllerPtr);
     }
 
+    // with lazy peer connections, the participants using the same network are connected when it is first used
+    _connection.ConnectPeersOnDemand(controllerPtr->GetServiceDescriptor());
+
     const auto qualifiedName = config.name;
     controllerMap[qualifiedName] = std::move(controller);
 
@@ -1937,6 +1976,12 @@ bool Participant<SilKitConnectionT>::ParticipantHasCapability(const std::string&
     return _connection.ParticipantHasCapability(participantName, capability);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::ConnectParticipantOnDemand(const std::string& participantName)
+{
+    _connection.ConnectPeerOnDemand(participantName);
+}
+
 template <class SilKitConnectionT>
 std::string Participant<SilKitConnectionT>::GetServiceDescriptorString(
     SilKit::Experimental::NetworkSimulation::ControllerDescriptor controllerDescriptor)
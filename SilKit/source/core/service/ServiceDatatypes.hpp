@@ -7,6 +7,7 @@
 #include <vector>
 #include <map>
 #include <sstream>
+#include <cstdint>
 
 #include "core/internal/IServiceEndpoint.hpp"
 
@@ -33,6 +34,27 @@ struct ParticipantDiscoveryEvent //requires history >= 1
     std::vector<ServiceDescriptor> services; //!< list of services provided by the participant
 };
 
+//! Service descriptor of a CompactParticipantDiscoveryEvent. The names are indices into the string table of the event.
+struct CompactServiceDescriptor
+{
+    ServiceType serviceType{ServiceType::Undefined};
+    Config::NetworkType networkType{Config::NetworkType::Invalid};
+    uint32_t networkName{0};
+    uint32_t serviceName{0};
+    EndpointId serviceId{0};
+    std::vector<uint32_t> supplementalData; //!< the keys and values, alternating
+};
+
+//! ParticipantDiscoveryEvent for participants with the "compact-discovery-v1" capability. The participant is only
+//! transmitted once and each distinct name only once, in the string table.
+struct CompactParticipantDiscoveryEvent
+{
+    std::string participantName;
+    ParticipantId participantId{0};
+    std::vector<std::string> strings;
+    std::vector<CompactServiceDescriptor> services;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Inline operators
 ////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +70,17 @@ inline bool operator!=(const ParticipantDiscoveryEvent& lhs, const ParticipantDi
 {
     return !(lhs == rhs);
 }
+inline bool operator==(const CompactServiceDescriptor& lhs, const CompactServiceDescriptor& rhs)
+{
+    return lhs.serviceType == rhs.serviceType && lhs.networkType == rhs.networkType
+           && lhs.networkName == rhs.networkName && lhs.serviceName == rhs.serviceName
+           && lhs.serviceId == rhs.serviceId && lhs.supplementalData == rhs.supplementalData;
+}
+inline bool operator==(const CompactParticipantDiscoveryEvent& lhs, const CompactParticipantDiscoveryEvent& rhs)
+{
+    return lhs.participantName == rhs.participantName && lhs.participantId == rhs.participantId
+           && lhs.strings == rhs.strings && lhs.services == rhs.services;
+}
 ////////////////////////////////////////////////////////////////////////////////
 // Inline string utils
 ////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +120,13 @@ inline std::ostream& operator<<(std::ostream& out, const ParticipantDiscoveryEve
     out << "] }";
     return out;
 }
+inline std::ostream& operator<<(std::ostream& out, const CompactParticipantDiscoveryEvent& serviceAnnouncement)
+{
+    out << "CompactParticipantDiscoveryEvent{\"" << serviceAnnouncement.participantName
+        << "\", services=" << serviceAnnouncement.services.size()
+        << ", strings=" << serviceAnnouncement.strings.size() << "}";
+    return out;
+}
 inline std::string to_string(const ParticipantDiscoveryEvent& serviceAnnouncement)
 {
     std::stringstream str;
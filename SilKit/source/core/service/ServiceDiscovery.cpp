@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: MIT
 
 #include "core/service/ServiceDiscovery.hpp"
+#include "core/vasio/VAsioCapabilities.hpp"
 #include "silkit/services/logging/ILogger.hpp"
+#include "util/Hash.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -41,6 +43,15 @@ void ServiceDiscovery::ReceiveMsg(const IServiceEndpoint* /*from*/, const Partic
     OnParticpantAddition(msg);
 }
 
+void ServiceDiscovery::ReceiveMsg(const IServiceEndpoint* /*from*/, const CompactParticipantDiscoveryEvent& msg)
+{
+    if (_shuttingDown)
+    {
+        return;
+    }
+    OnParticpantAddition(MakeParticipantDiscoveryEvent(msg));
+}
+
 void ServiceDiscovery::OnParticpantAddition(const ParticipantDiscoveryEvent& msg)
 {
     // Service announcement are sent when a new participant joins the simulation
@@ -51,8 +62,8 @@ void ServiceDiscovery::OnParticpantAddition(const ParticipantDiscoveryEvent& msg
     for (auto&& serviceDescriptor : msg.services)
     {
         // Check if already known
-        const auto serviceName = to_string(serviceDescriptor);
-        if (announcementMap.count(serviceName) > 0)
+        auto serviceKey = ServiceKey::FromServiceDescriptor(serviceDescriptor);
+        if (announcementMap.count(serviceKey) > 0)
         {
             continue;
         }
@@ -60,12 +71,19 @@ void ServiceDiscovery::OnParticpantAddition(const ParticipantDiscoveryEvent& msg
         {
             _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
             // Store by service name
-            announcementMap[serviceName] = serviceDescriptor;
+            announcementMap.emplace(std::move(serviceKey), serviceDescriptor);
             CallHandlers(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
         }
     }
 }
 
+void ServiceDiscovery::OnParticipantConnectedOnDemand(const std::string& participantName)
+{
+    // the other participant announces its services in return, once it discovers this service discovery
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+    AnnounceLocalParticipantTo(participantName);
+}
+
 void ServiceDiscovery::OnParticpantRemoval(const std::string& participantName)
 {
     if (participantName == _participantName)
@@ -141,7 +159,7 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
     auto&& fromParticipant = serviceDescriptor.GetParticipantName();
     auto&& announcementMap = _servicesByParticipant[fromParticipant];
-    const auto cachedServiceKey = to_string(serviceDescriptor);
+    auto cachedServiceKey = ServiceKey::FromServiceDescriptor(serviceDescriptor);
     if (announcementMap.count(cachedServiceKey) > 0)
     {
         //we already now this participant's service
@@ -163,7 +181,11 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
     }
 
     // Update the cache
-    announcementMap[cachedServiceKey] = serviceDescriptor;
+    announcementMap.emplace(std::move(cachedServiceKey), serviceDescriptor);
+    if (fromParticipant == _participantName)
+    {
+        _compactLocalAnnouncement.reset();
+    }
 
     _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
     CallHandlers(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
@@ -171,6 +193,26 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
 
 void ServiceDiscovery::AnnounceLocalParticipantTo(const std::string& otherParticipant)
 {
+    if (_participant->ParticipantHasCapability(otherParticipant, Capabilities::CompactDiscovery))
+    {
+        if (!_compactLocalAnnouncement)
+        {
+            ParticipantDiscoveryEvent localServices;
+            localServices.participantName = _participantName;
+            for (const auto& thisParticipantServiceMap : _servicesByParticipant[_participantName])
+            {
+                localServices.services.push_back(thisParticipantServiceMap.second);
+            }
+            _compactLocalAnnouncement = MakeCompactParticipantDiscoveryEvent(localServices);
+        }
+
+        if (_compactLocalAnnouncement)
+        {
+            _participant->SendMsg(this, otherParticipant, *_compactLocalAnnouncement);
+            return;
+        }
+    }
+
     ParticipantDiscoveryEvent localServices;
     localServices.participantName = _participantName;
     localServices.services.reserve(_servicesByParticipant[_participantName].size());
@@ -186,12 +228,16 @@ void ServiceDiscovery::OnServiceRemoval(const ServiceDescriptor& serviceDescript
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
     auto&& fromParticipant = serviceDescriptor.GetParticipantName();
     auto&& announcementMap = _servicesByParticipant[fromParticipant];
-    auto numErased = announcementMap.erase(to_string(serviceDescriptor));
+    auto numErased = announcementMap.erase(ServiceKey::FromServiceDescriptor(serviceDescriptor));
     if (numErased == 0)
     {
         //we only notify once per event
         return;
     }
+    if (fromParticipant == _participantName)
+    {
+        _compactLocalAnnouncement.reset();
+    }
 
     _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, serviceDescriptor);
     CallHandlers(ServiceDiscoveryEvent::Type::ServiceRemoved, serviceDescriptor);
@@ -255,6 +301,145 @@ void ServiceDiscovery::RegisterSpecificServiceDiscoveryHandler(
     _specificDiscoveryStore.RegisterSpecificServiceDiscoveryHandler(handler, controllerType_, topic, labels);
 }
 
+auto ServiceDiscovery::ServiceKey::FromServiceDescriptor(const ServiceDescriptor& serviceDescriptor) -> ServiceKey
+{
+    ServiceKey key;
+    key.serviceType = serviceDescriptor.GetServiceType();
+    switch (key.serviceType)
+    {
+    case ServiceType::Link:
+        key.networkType = serviceDescriptor.GetNetworkType();
+        key.networkName = serviceDescriptor.GetNetworkName();
+        break;
+    case ServiceType::Controller:
+    case ServiceType::SimulatedController:
+        if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, key.controllerType))
+        {
+            throw LogicError("ServiceDiscovery: No controller type defined in supplemental data.");
+        }
+        key.networkName = serviceDescriptor.GetNetworkName();
+        key.serviceName = serviceDescriptor.GetServiceName();
+        break;
+    case ServiceType::InternalController:
+        key.serviceName = serviceDescriptor.GetServiceName();
+        break;
+    case ServiceType::Undefined:
+        key.networkName = serviceDescriptor.GetNetworkName();
+        key.serviceName = serviceDescriptor.GetServiceName();
+        break;
+    }
+    return key;
+}
+
+bool ServiceDiscovery::ServiceKey::operator==(const ServiceKey& other) const
+{
+    return serviceType == other.serviceType && networkType == other.networkType
+           && controllerType == other.controllerType && networkName == other.networkName
+           && serviceName == other.serviceName;
+}
+
+auto ServiceDiscovery::ServiceKeyHash::operator()(const ServiceKey& key) const -> std::size_t
+{
+    auto hash = std::hash<std::string>{}(key.serviceName);
+    hash = Util::Hash::HashCombine(hash, std::hash<std::string>{}(key.networkName));
+    hash = Util::Hash::HashCombine(hash, std::hash<std::string>{}(key.controllerType));
+    hash = Util::Hash::HashCombine(hash, static_cast<std::size_t>(key.serviceType));
+    return Util::Hash::HashCombine(hash, static_cast<std::size_t>(key.networkType));
+}
+
+auto MakeCompactParticipantDiscoveryEvent(const ParticipantDiscoveryEvent& event)
+    -> std::optional<CompactParticipantDiscoveryEvent>
+{
+    CompactParticipantDiscoveryEvent compactEvent;
+    compactEvent.participantName = event.participantName;
+    compactEvent.services.reserve(event.services.size());
+
+    std::unordered_map<std::string, uint32_t> stringIndices;
+    auto intern = [&compactEvent, &stringIndices](const std::string& string) {
+        auto result = stringIndices.emplace(string, static_cast<uint32_t>(compactEvent.strings.size()));
+        if (result.second)
+        {
+            compactEvent.strings.push_back(string);
+        }
+        return result.first->second;
+    };
+
+    for (const auto& serviceDescriptor : event.services)
+    {
+        if (serviceDescriptor.GetParticipantName() != event.participantName)
+        {
+            return std::nullopt;
+        }
+        if (compactEvent.services.empty())
+        {
+            compactEvent.participantId = serviceDescriptor.GetParticipantId();
+        }
+        else if (serviceDescriptor.GetParticipantId() != compactEvent.participantId)
+        {
+            return std::nullopt;
+        }
+
+        CompactServiceDescriptor compactServiceDescriptor;
+        compactServiceDescriptor.serviceType = serviceDescriptor.GetServiceType();
+        compactServiceDescriptor.networkType = serviceDescriptor.GetNetworkType();
+        compactServiceDescriptor.networkName = intern(serviceDescriptor.GetNetworkName());
+        compactServiceDescriptor.serviceName = intern(serviceDescriptor.GetServiceName());
+        compactServiceDescriptor.serviceId = serviceDescriptor.GetServiceId();
+        for (const auto& item : serviceDescriptor.GetSupplementalData())
+        {
+            compactServiceDescriptor.supplementalData.push_back(intern(item.first));
+            compactServiceDescriptor.supplementalData.push_back(intern(item.second));
+        }
+        compactEvent.services.push_back(std::move(compactServiceDescriptor));
+    }
+
+    return compactEvent;
+}
+
+auto MakeParticipantDiscoveryEvent(const CompactParticipantDiscoveryEvent& event) -> ParticipantDiscoveryEvent
+{
+    auto lookup = [&event](uint32_t index) -> const std::string& {
+        if (index >= event.strings.size())
+        {
+            throw ProtocolError("CompactParticipantDiscoveryEvent: string index out of range");
+        }
+        return event.strings[index];
+    };
+
+    ParticipantDiscoveryEvent result;
+    result.participantName = event.participantName;
+    result.services.reserve(event.services.size());
+
+    for (const auto& compactServiceDescriptor : event.services)
+    {
+        if (compactServiceDescriptor.supplementalData.size() % 2 != 0)
+        {
+            throw ProtocolError("CompactParticipantDiscoveryEvent: incomplete supplemental data");
+        }
+
+        ServiceDescriptor serviceDescriptor;
+        serviceDescriptor.SetParticipantNameAndComputeId(event.participantName);
+        serviceDescriptor.SetParticipantId(event.participantId);
+        serviceDescriptor.SetServiceType(compactServiceDescriptor.serviceType);
+        serviceDescriptor.SetNetworkType(compactServiceDescriptor.networkType);
+        serviceDescriptor.SetNetworkName(lookup(compactServiceDescriptor.networkName));
+        serviceDescriptor.SetServiceName(lookup(compactServiceDescriptor.serviceName));
+        serviceDescriptor.SetServiceId(compactServiceDescriptor.serviceId);
+
+        SupplementalData supplementalData;
+        for (size_t i = 0; i < compactServiceDescriptor.supplementalData.size(); i += 2)
+        {
+            supplementalData.emplace(lookup(compactServiceDescriptor.supplementalData[i]),
+                                     lookup(compactServiceDescriptor.supplementalData[i + 1]));
+        }
+        serviceDescriptor.SetSupplementalData(std::move(supplementalData));
+
+        result.services.push_back(std::move(serviceDescriptor));
+    }
+
+    return result;
+}
+
 } // namespace Discovery
 } // namespace Core
 } // namespace SilKit
@@ -9,6 +9,7 @@
 #include <mutex>
 #include <vector>
 #include <atomic>
+#include <optional>
 #include <unordered_set>
 
 #include "core/service/SpecificDiscoveryStore.hpp"
@@ -24,8 +25,8 @@ namespace Core {
 namespace Discovery {
 
 class ServiceDiscovery
-    : public Core::IReceiver<ParticipantDiscoveryEvent, ServiceDiscoveryEvent>
-    , public Core::ISender<ParticipantDiscoveryEvent, ServiceDiscoveryEvent>
+    : public Core::IReceiver<ParticipantDiscoveryEvent, CompactParticipantDiscoveryEvent, ServiceDiscoveryEvent>
+    , public Core::ISender<ParticipantDiscoveryEvent, CompactParticipantDiscoveryEvent, ServiceDiscoveryEvent>
     , public IServiceEndpoint
     , public Discovery::IServiceDiscovery
 {
@@ -51,6 +52,9 @@ public: //IServiceDiscovery
     //!< React on a leaving participant, called via RegisterPeerShutdownCallback
     void OnParticpantRemoval(const std::string& participantName) override;
 
+    //!< Announce all services to a participant, which was connected on demand after joining the simulation
+    void OnParticipantConnectedOnDemand(const std::string& participantName);
+
 public: // Interfaces
     // IServiceEndpoint
     void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
@@ -58,6 +62,7 @@ public: // Interfaces
 
     // IReceiver
     void ReceiveMsg(const IServiceEndpoint* from, const ParticipantDiscoveryEvent& msg) override;
+    void ReceiveMsg(const IServiceEndpoint* from, const CompactParticipantDiscoveryEvent& msg) override;
     void ReceiveMsg(const IServiceEndpoint* from, const ServiceDiscoveryEvent& msg) override;
 
 private: // Methods
@@ -74,19 +79,48 @@ private: // Methods
     //!< Inform about service changes
     void CallHandlers(ServiceDiscoveryEvent::Type eventType, const ServiceDescriptor& serviceDescriptor) const;
 
+private: // Types
+    //!< Identifies a service of a participant, with the same fields as ServiceDescriptor::to_string()
+    struct ServiceKey
+    {
+        ServiceType serviceType{ServiceType::Undefined};
+        Config::NetworkType networkType{Config::NetworkType::Invalid};
+        std::string controllerType;
+        std::string networkName;
+        std::string serviceName;
+
+        static auto FromServiceDescriptor(const ServiceDescriptor& serviceDescriptor) -> ServiceKey;
+
+        bool operator==(const ServiceKey& other) const;
+    };
+
+    struct ServiceKeyHash
+    {
+        auto operator()(const ServiceKey& key) const -> std::size_t;
+    };
+
 private:
     IParticipantInternal* _participant{nullptr};
     std::string _participantName;
     ServiceDescriptor _serviceDescriptor; //!< for the ServiceDiscovery controller itself
     std::vector<ServiceDiscoveryHandler> _handlers;
     //!< a cache for computing additions/removals per participant
-    using ServiceMap = std::unordered_map<std::string /*serviceDescriptor*/, ServiceDescriptor>;
+    using ServiceMap = std::unordered_map<ServiceKey, ServiceDescriptor, ServiceKeyHash>;
     std::unordered_map<std::string /* participant name */, ServiceMap> _servicesByParticipant;
+    //!< the compact announcement of the local services, built once for all peers until the services change
+    std::optional<CompactParticipantDiscoveryEvent> _compactLocalAnnouncement;
     SpecificDiscoveryStore _specificDiscoveryStore;
     mutable std::recursive_mutex _discoveryMx;
     std::atomic<bool> _shuttingDown{false};
 };
 
+//! \brief Interns the names of the services into a string table. Fails, if a service belongs to another participant.
+auto MakeCompactParticipantDiscoveryEvent(const ParticipantDiscoveryEvent& event)
+    -> std::optional<CompactParticipantDiscoveryEvent>;
+
+//! \brief Restores the services of a compact event. Throws ProtocolError on string indices outside of the table.
+auto MakeParticipantDiscoveryEvent(const CompactParticipantDiscoveryEvent& event) -> ParticipantDiscoveryEvent;
+
 } // namespace Discovery
 } // namespace Core
 } // namespace SilKit
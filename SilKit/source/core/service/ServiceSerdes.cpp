@@ -43,6 +43,35 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+// CompactParticipantDiscoveryEvent
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const CompactServiceDescriptor& msg)
+{
+    buffer << msg.serviceType << msg.networkType << msg.networkName << msg.serviceName << msg.serviceId
+           << msg.supplementalData;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, CompactServiceDescriptor& updatedMsg)
+{
+    buffer >> updatedMsg.serviceType >> updatedMsg.networkType >> updatedMsg.networkName >> updatedMsg.serviceName
+        >> updatedMsg.serviceId >> updatedMsg.supplementalData;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
+                                               const CompactParticipantDiscoveryEvent& msg)
+{
+    buffer << msg.participantName << msg.participantId << msg.strings << msg.services;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer,
+                                               CompactParticipantDiscoveryEvent& updatedMsg)
+{
+    buffer >> updatedMsg.participantName >> updatedMsg.participantId >> updatedMsg.strings >> updatedMsg.services;
+    return buffer;
+}
+
 // ServiceDiscoveryEvent
 inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const ServiceDiscoveryEvent& msg)
 {
@@ -67,6 +96,12 @@ void Serialize(MessageBuffer& buffer, const ServiceDiscoveryEvent& msg)
     return;
 }
 
+void Serialize(MessageBuffer& buffer, const CompactParticipantDiscoveryEvent& msg)
+{
+    buffer << msg;
+    return;
+}
+
 void Deserialize(MessageBuffer& buffer, ParticipantDiscoveryEvent& out)
 {
     buffer >> out;
@@ -75,6 +110,10 @@ void Deserialize(MessageBuffer& buffer, ServiceDiscoveryEvent& out)
 {
     buffer >> out;
 }
+void Deserialize(MessageBuffer& buffer, CompactParticipantDiscoveryEvent& out)
+{
+    buffer >> out;
+}
 
 } // namespace Discovery
 } // namespace Core
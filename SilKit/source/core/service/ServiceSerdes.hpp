@@ -14,9 +14,11 @@ namespace Discovery {
 
 void Serialize(SilKit::Core::MessageBuffer& buffer, const ParticipantDiscoveryEvent& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const ServiceDiscoveryEvent& msg);
+void Serialize(SilKit::Core::MessageBuffer& buffer, const CompactParticipantDiscoveryEvent& msg);
 
 void Deserialize(MessageBuffer& buffer, ParticipantDiscoveryEvent& out);
 void Deserialize(MessageBuffer& buffer, ServiceDiscoveryEvent& out);
+void Deserialize(MessageBuffer& buffer, CompactParticipantDiscoveryEvent& out);
 
 } // namespace Discovery
 } // namespace Core
@@ -62,14 +62,18 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
                 }
             }
 
-            CallHandlersOnServiceChange(changeType, supplControllerTypeName, key, labels, serviceDescriptor);
+            Util::CompiledLabels compiledLabels{labels, _labelStrings};
+            CallHandlersOnServiceChange(changeType, supplControllerTypeName, key, labels, compiledLabels,
+                                        serviceDescriptor);
             if (changeType == ServiceDiscoveryEvent::Type::ServiceCreated)
             {
                 InsertLookupNode(supplControllerTypeName, key, labels, serviceDescriptor);
+                _compiledServiceLabels[serviceDescriptor.to_endpointAddress()] = std::move(compiledLabels);
             }
             else if (changeType == ServiceDiscoveryEvent::Type::ServiceRemoved)
             {
                 RemoveLookupNode(supplControllerTypeName, key, serviceDescriptor);
+                _compiledServiceLabels.erase(serviceDescriptor.to_endpointAddress());
             }
         }
     }
@@ -84,14 +88,14 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(
     auto& entry = _lookup[MakeFilter(controllerType_, key)];
 
     auto* greedyLabel = GetLabelWithMinimalNodeSet(entry, labels);
+    const Util::CompiledLabels compiledLabels{labels, _labelStrings};
 
     if (greedyLabel == nullptr)
     {
         // no labels present trigger all
         for (auto&& serviceDescriptor : entry.allCluster.nodes)
         {
-            const auto descriptorLabels = GetLabels(serviceDescriptor);
-            if (Util::MatchLabels(labels, descriptorLabels))
+            if (Util::MatchLabels(compiledLabels, GetCompiledLabels(serviceDescriptor)))
             {
                 handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
             }
@@ -104,8 +108,7 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(
             // Get all services that do not have the same optional label present
             for (auto&& serviceDescriptor : entry.notLabelMap[greedyLabel->key].nodes)
             {
-                const auto descriptorLabels = GetLabels(serviceDescriptor);
-                if (Util::MatchLabels(labels, descriptorLabels))
+                if (Util::MatchLabels(compiledLabels, GetCompiledLabels(serviceDescriptor)))
                 {
                     handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
                 }
@@ -113,8 +116,7 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(
             // Get all services that do not have any labels attached, thus matching our optional label
             for (auto&& serviceDescriptor : entry.noLabelCluster.nodes)
             {
-                const auto descriptorLabels = GetLabels(serviceDescriptor);
-                if (Util::MatchLabels(labels, descriptorLabels))
+                if (Util::MatchLabels(compiledLabels, GetCompiledLabels(serviceDescriptor)))
                 {
                     handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
                 }
@@ -123,8 +125,7 @@ void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(
         // trigger label handlers for exact matches (optional and mandatory)
         for (auto&& serviceDescriptor : entry.labelMap[MakeFilter(greedyLabel->key, greedyLabel->value)].nodes)
         {
-            const auto descriptorLabels = GetLabels(serviceDescriptor);
-            if (Util::MatchLabels(labels, descriptorLabels))
+            if (Util::MatchLabels(compiledLabels, GetCompiledLabels(serviceDescriptor)))
             {
                 handler(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
             }
@@ -137,6 +138,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
                                                          const std::string& supplControllerTypeName,
                                                          const std::string& key,
                                                          const std::vector<SilKit::Services::MatchingLabel>& labels,
+                                                         const Util::CompiledLabels& compiledLabels,
                                                          const ServiceDescriptor& serviceDescriptor)
 {
     // pre filter key and mediaType
@@ -150,7 +152,8 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
         // no labels present trigger all
         for (auto&& controllerInfo : entry.allCluster.controllerInfo)
         {
-            bool run_handler = skipLabelCheck ? true : Util::MatchLabels(controllerInfo->labels, labels);
+            bool run_handler =
+                skipLabelCheck ? true : Util::MatchLabels(controllerInfo->compiledLabels, compiledLabels);
             if (controllerInfo->handler && run_handler)
             {
                 controllerInfo->handler(eventType, serviceDescriptor);
@@ -164,7 +167,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
             // trigger handlers that do not have the same optional label
             for (auto&& controllerInfo : entry.notLabelMap[greedyLabel->key].controllerInfo)
             {
-                if (controllerInfo->handler && Util::MatchLabels(controllerInfo->labels, labels))
+                if (controllerInfo->handler && Util::MatchLabels(controllerInfo->compiledLabels, compiledLabels))
                 {
                     controllerInfo->handler(eventType, serviceDescriptor);
                 }
@@ -172,7 +175,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
             // trigger handlers with no labels attached, thus matching our optional label
             for (auto&& controllerInfo : entry.noLabelCluster.controllerInfo)
             {
-                if (controllerInfo->handler && Util::MatchLabels(controllerInfo->labels, labels))
+                if (controllerInfo->handler && Util::MatchLabels(controllerInfo->compiledLabels, compiledLabels))
                 {
                     controllerInfo->handler(eventType, serviceDescriptor);
                 }
@@ -181,7 +184,7 @@ void SpecificDiscoveryStore::CallHandlersOnServiceChange(ServiceDiscoveryEvent::
         // trigger label handlers with exact matches (optional and mandatory)
         for (auto&& controllerInfo : entry.labelMap[MakeFilter(greedyLabel->key, greedyLabel->value)].controllerInfo)
         {
-            if (controllerInfo->handler && Util::MatchLabels(controllerInfo->labels, labels))
+            if (controllerInfo->handler && Util::MatchLabels(controllerInfo->compiledLabels, compiledLabels))
             {
                 controllerInfo->handler(eventType, serviceDescriptor);
             }
@@ -378,34 +381,18 @@ void SpecificDiscoveryStore::InsertLookupHandler(const std::string& controllerTy
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels,
                                                  ServiceDiscoveryHandler handler)
 {
-    auto controllerInfo = std::make_shared<ControllerCluster>(ControllerCluster(std::move(handler), labels));
+    auto controllerInfo = std::make_shared<ControllerCluster>(
+        ControllerCluster(std::move(handler), labels, Util::CompiledLabels{labels, _labelStrings}));
     UpdateDiscoveryClusters(controllerType_, key, labels,
                             [controllerInfo](auto& cluster) { cluster.controllerInfo.push_back(controllerInfo); });
 }
 
-const std::vector<SilKit::Services::MatchingLabel> SpecificDiscoveryStore::GetLabels(
-    const ServiceDescriptor& descriptor)
+auto SpecificDiscoveryStore::GetCompiledLabels(const ServiceDescriptor& descriptor) const
+    -> const Util::CompiledLabels&
 {
-    const auto ctrlType = descriptor.GetSupplementalDataValue(Core::Discovery::controllerType);
-
-    std::string labelsStr;
-
-    if (ctrlType == controllerTypeDataPublisher)
-    {
-        labelsStr = descriptor.GetSupplementalDataValue(Core::Discovery::supplKeyDataPublisherPubLabels);
-    }
-    else if (ctrlType == controllerTypeRpcClient)
-    {
-        labelsStr = descriptor.GetSupplementalDataValue(Core::Discovery::supplKeyRpcClientLabels);
-    }
-    else
-    {
-        // Don't need labels return an empty vector
-        return std::vector<SilKit::Services::MatchingLabel>();
-    }
-
-    const auto descriptorLabels = SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
-    return descriptorLabels;
+    static const Util::CompiledLabels noLabels;
+    auto it = _compiledServiceLabels.find(descriptor.to_endpointAddress());
+    return it != _compiledServiceLabels.end() ? it->second : noLabels;
 }
 
 void SpecificDiscoveryStore::RegisterSpecificServiceDiscoveryHandler(
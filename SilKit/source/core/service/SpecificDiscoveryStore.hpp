@@ -14,6 +14,7 @@
 
 #include "core/service/IServiceDiscovery.hpp"
 #include "util/Hash.hpp"
+#include "util/LabelMatching.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -37,10 +38,13 @@ using HandlerValue = std::shared_ptr<ServiceDiscoveryHandler>;
 struct ControllerCluster {
     ServiceDiscoveryHandler handler;
     std::vector<SilKit::Services::MatchingLabel> labels;
+    Util::CompiledLabels compiledLabels;
 
-    ControllerCluster(ServiceDiscoveryHandler ahandler, const std::vector<SilKit::Services::MatchingLabel>& alabels) :
+    ControllerCluster(ServiceDiscoveryHandler ahandler, const std::vector<SilKit::Services::MatchingLabel>& alabels,
+                      Util::CompiledLabels acompiledLabels) :
         handler(ahandler),
-        labels(alabels) {
+        labels(alabels),
+        compiledLabels(std::move(acompiledLabels)) {
     };
 
 };
@@ -96,6 +100,7 @@ private: //methods
     void CallHandlersOnServiceChange(ServiceDiscoveryEvent::Type eventType, const std::string& controllerType,
                                      const std::string& topic,
                                      const std::vector<SilKit::Services::MatchingLabel>& labels,
+                                     const Util::CompiledLabels& compiledLabels,
                                      const ServiceDescriptor& serviceDescriptor);
 
     //!< Trigger handler for past events that happened before registration
@@ -148,14 +153,19 @@ private: //methods
                              const std::vector<SilKit::Services::MatchingLabel>& labels,
                              ServiceDiscoveryHandler handler);
 
-    //!< Get serviceDescriptorLabels
-    const std::vector<SilKit::Services::MatchingLabel> GetLabels(const ServiceDescriptor& descriptor);
+    //!< Get the labels of a known service, which are compiled once when the service is created
+    auto GetCompiledLabels(const ServiceDescriptor& descriptor) const -> const Util::CompiledLabels&;
 
 private: //member
     //!< SpecificDiscoveryStore is only available to a a sub set of controllers
     const std::unordered_set<std::string> _allowedControllers = {
         controllerTypeDataPublisher, controllerTypeRpcServerInternal, controllerTypeRpcClient};
 
+    //!< interned label keys and values of all compiled labels
+    Util::LabelStringTable _labelStrings;
+    //!< compiled labels of the services in _lookup, so the candidates are matched without parsing their labels
+    std::map<EndpointAddress, Util::CompiledLabels> _compiledServiceLabels;
+
 protected:
     //! NB: container is not thread safe, all public API interactions must be secured with a common mutex
     std::unordered_map<FilterType, DiscoveryKeyNode, FilterTypeHash> _lookup;
@@ -35,6 +35,8 @@ class MockParticipant : public DummyParticipant
 public:
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const ParticipantDiscoveryEvent&), (override));
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const ServiceDiscoveryEvent&), (override));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const std::string&, const CompactParticipantDiscoveryEvent&),
+                (override));
 };
 
 class Callbacks
@@ -197,4 +199,91 @@ TEST_F(Test_ServiceDiscovery, service_removal)
     EXPECT_CALL(callbacks, ServiceDiscoveryHandler(_, _)).Times(0);
     disco.ReceiveMsg(&otherParticipant, event);
 }
+
+TEST_F(Test_ServiceDiscovery, compact_participant_discovery_event_roundtrip)
+{
+    ParticipantDiscoveryEvent event;
+    event.participantName = "P1";
+    for (auto i = 0; i < 4; i++)
+    {
+        ServiceDescriptor descr;
+        descr.SetParticipantNameAndComputeId("P1");
+        descr.SetServiceType(ServiceType::Controller);
+        descr.SetNetworkType(Config::NetworkType::CAN);
+        descr.SetNetworkName("CAN1");
+        descr.SetServiceName("Controller" + std::to_string(i % 2));
+        descr.SetServiceId(static_cast<EndpointId>(i));
+        descr.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeCan);
+        event.services.push_back(descr);
+    }
+
+    auto compactEvent = MakeCompactParticipantDiscoveryEvent(event);
+    ASSERT_TRUE(compactEvent.has_value());
+    // "CAN1", "Controller0", "Controller1", the controller type key and its value
+    EXPECT_EQ(compactEvent->strings.size(), 5u);
+    EXPECT_EQ(compactEvent->participantId, event.services.front().GetParticipantId());
+
+    auto restoredEvent = MakeParticipantDiscoveryEvent(*compactEvent);
+    EXPECT_EQ(restoredEvent, event);
+    for (size_t i = 0; i < event.services.size(); i++)
+    {
+        EXPECT_EQ(restoredEvent.services.at(i).GetParticipantName(), "P1");
+        EXPECT_EQ(restoredEvent.services.at(i).GetServiceName(), event.services.at(i).GetServiceName());
+        EXPECT_EQ(restoredEvent.services.at(i).GetSupplementalData(), event.services.at(i).GetSupplementalData());
+    }
+
+    // services of other participants cannot be encoded
+    event.services.back().SetParticipantNameAndComputeId("P2");
+    EXPECT_FALSE(MakeCompactParticipantDiscoveryEvent(event).has_value());
+
+    compactEvent->services.back().serviceName = 42;
+    EXPECT_THROW(MakeParticipantDiscoveryEvent(*compactEvent), ProtocolError);
+}
+
+TEST_F(Test_ServiceDiscovery, compact_announcement_to_capable_participant)
+{
+    ServiceDiscovery disco{&participant, "ParticipantA"};
+    disco.RegisterServiceDiscoveryHandler(
+        [this](auto type, auto&& descr) { callbacks.ServiceDiscoveryHandler(type, descr); });
+
+    ServiceDescriptor localDescr;
+    localDescr.SetParticipantNameAndComputeId("ParticipantA");
+    localDescr.SetNetworkName("Link1");
+    localDescr.SetServiceName("TestService");
+    EXPECT_CALL(participant, SendMsg(&disco, A<const ServiceDiscoveryEvent&>())).Times(1);
+    EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, localDescr)).Times(1);
+    disco.NotifyServiceCreated(localDescr);
+
+    // the announcement to a new participant is triggered by its service discovery
+    ServiceDescriptor remoteDisco;
+    remoteDisco.SetParticipantNameAndComputeId("ParticipantB");
+    remoteDisco.SetServiceType(ServiceType::InternalController);
+    remoteDisco.SetServiceName("ServiceDiscovery");
+    remoteDisco.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeServiceDiscovery);
+    ServiceDiscoveryEvent event;
+    event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
+    event.serviceDescriptor = remoteDisco;
+
+    CompactParticipantDiscoveryEvent announcement;
+    EXPECT_CALL(participant, SendMsg(&disco, "ParticipantB", _)).WillOnce(SaveArg<2>(&announcement));
+    EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, remoteDisco)).Times(1);
+    MockServiceEndpoint otherParticipant{"ParticipantB", "N1", "C1", 2};
+    disco.ReceiveMsg(&otherParticipant, event);
+
+    EXPECT_EQ(announcement.participantName, "ParticipantA");
+    ASSERT_EQ(announcement.services.size(), 1u);
+    EXPECT_EQ(MakeParticipantDiscoveryEvent(announcement).services.at(0), localDescr);
+
+    // receiving the compact announcement of another participant creates its services
+    ParticipantDiscoveryEvent remoteServices;
+    remoteServices.participantName = "ParticipantC";
+    ServiceDescriptor remoteDescr;
+    remoteDescr.SetParticipantNameAndComputeId("ParticipantC");
+    remoteDescr.SetNetworkName("Link1");
+    remoteDescr.SetServiceName("RemoteService");
+    remoteServices.services.push_back(remoteDescr);
+    EXPECT_CALL(callbacks, ServiceDiscoveryHandler(ServiceDiscoveryEvent::Type::ServiceCreated, remoteDescr)).Times(1);
+    disco.ReceiveMsg(&otherParticipant, *MakeCompactParticipantDiscoveryEvent(remoteServices));
+}
+
 } // namespace
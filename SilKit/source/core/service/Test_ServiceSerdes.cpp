@@ -41,3 +41,33 @@ TEST(Test_ServiceSerdes, Mw_Service)
     std::string dummy;
     EXPECT_EQ(out.services.at(9).GetSupplementalDataItem("Second", dummy), true);
 }
+
+TEST(Test_ServiceSerdes, Mw_CompactService)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    SilKit::Core::Discovery::CompactParticipantDiscoveryEvent in{};
+    in.participantName = "Input";
+    in.participantId = 1234;
+    in.strings = {"Link", "Service", "hello", "world"};
+    for (auto i = 0; i < 10; i++)
+    {
+        SilKit::Core::Discovery::CompactServiceDescriptor descr;
+        descr.serviceType = SilKit::Core::ServiceType::SimulatedController;
+        descr.networkType = SilKit::Config::NetworkType::CAN;
+        descr.networkName = 0;
+        descr.serviceName = 1;
+        descr.serviceId = static_cast<SilKit::Core::EndpointId>(i);
+        descr.supplementalData = {2, 3};
+        in.services.push_back(descr);
+    }
+
+    SilKit::Core::Discovery::CompactParticipantDiscoveryEvent out{};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in, out);
+    EXPECT_EQ(out.services.at(9).serviceId, 9u);
+    EXPECT_EQ(out.services.at(9).supplementalData.size(), 2u);
+}
@@ -5,10 +5,12 @@
 #include "core/vasio/ConnectKnownParticipants.hpp"
 
 #include "services/logging/LoggerMessage.hpp"
+#include "core/vasio/VAsioCapabilities.hpp"
 #include "core/vasio/VAsioConnection.hpp"
 #include "core/vasio/VAsioPeer.hpp"
 #include "core/vasio/io/util/TracingMacros.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 
@@ -63,8 +65,12 @@ void ConnectKnownParticipants::StartConnecting()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
-    SILKIT_ASSERT(_connectStage == ConnectStage::INVALID);
-    _connectStage = ConnectStage::CONNECTING;
+    // connecting starts as soon as the known participants are received, later calls are ignored
+    auto expectedStage{ConnectStage::INVALID};
+    if (!_connectStage.compare_exchange_strong(expectedStage, ConnectStage::CONNECTING))
+    {
+        return;
+    }
 
     // wait for the known participants to be set
     auto knownParticipants{_knownParticipants.get_future()};
@@ -79,16 +85,66 @@ void ConnectKnownParticipants::StartConnecting()
         }
     }
 
-    // initiate all direct connection attempts
+    // initiate all direct connection attempts, unless the peer is not needed yet
+    size_t numberOfDeferredPeers{0};
     for (const auto& pair : _peers)
     {
         const auto& peer{pair.second};
-        peer->StartConnecting();
+
+        auto deferrableNetworks{GetDeferrableNetworks(peer->GetInfo())};
+        if (deferrableNetworks.empty())
+        {
+            peer->StartConnecting();
+        }
+        else
+        {
+            peer->DeferConnecting(std::move(deferrableNetworks));
+            ++numberOfDeferredPeers;
+        }
+    }
+
+    if (numberOfDeferredPeers > 0)
+    {
+        _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+            .SetMessage("Deferred connecting to {} of {} known participants, which share no network with this one",
+                        numberOfDeferredPeers, _peers.size())
+            .Dispatch();
     }
 
     UpdateStage();
 }
 
+auto ConnectKnownParticipants::GetDeferrableNetworks(const VAsioPeerInfo& peerInfo) const -> std::vector<std::string>
+{
+    if (!_settings.lazyPeerConnections || _settings.networks.empty())
+    {
+        return {};
+    }
+
+    std::vector<std::string> peerNetworks;
+    try
+    {
+        const VAsioCapabilities peerCapabilities{peerInfo.capabilities};
+        peerNetworks = peerCapabilities.GetCapabilityValues(Capabilities::LazyPeerConnections, CapabilityKeys::Network);
+    }
+    catch (const SilKit::TypeConversionError&)
+    {
+        // peers with unparsable capabilities are connected immediately
+        return {};
+    }
+
+    // peers which do not announce their networks might communicate on any network
+    const bool anySharedNetwork{std::any_of(peerNetworks.begin(), peerNetworks.end(), [this](const auto& network) {
+        return _settings.networks.find(network) != _settings.networks.end();
+    })};
+    if (anySharedNetwork)
+    {
+        return {};
+    }
+
+    return peerNetworks;
+}
+
 void ConnectKnownParticipants::HandlePeerEvent(const std::string& participantName, PeerEvent event)
 {
     SILKIT_TRACE_METHOD_(_logger, "({}, ...)", participantName);
@@ -105,6 +161,56 @@ void ConnectKnownParticipants::HandlePeerEvent(const std::string& participantNam
     peer->HandleEvent(event);
 }
 
+void ConnectKnownParticipants::ConnectDeferredPeers(const std::string& network)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", network);
+
+    std::vector<Peer*> deferredPeers;
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+        for (const auto& pair : _peers)
+        {
+            const auto& peer{pair.second};
+            if (peer->GetStage() != PeerStage::DEFERRED)
+            {
+                continue;
+            }
+
+            const auto& peerNetworks{peer->GetDeferredNetworks()};
+            if (std::find(peerNetworks.begin(), peerNetworks.end(), network) != peerNetworks.end())
+            {
+                deferredPeers.push_back(peer.get());
+            }
+        }
+    }
+
+    // the peers are never removed, and connecting might update the stage, which requires the lock
+    for (auto* peer : deferredPeers)
+    {
+        if (peer->StartConnectingIfDeferred())
+        {
+            _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+                .SetMessage("Connecting to '{}' on demand, because it uses '{}'", peer->GetInfo().participantName,
+                            network)
+                .Dispatch();
+        }
+    }
+}
+
+void ConnectKnownParticipants::ConnectDeferredPeer(const std::string& participantName)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", participantName);
+
+    auto peer{FindPeerByName(participantName)};
+    if (peer != nullptr && peer->StartConnectingIfDeferred())
+    {
+        _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+            .SetMessage("Connecting to '{}' on demand", participantName)
+            .Dispatch();
+    }
+}
+
 
 auto ConnectKnownParticipants::FindPeerByName(const std::string& name) -> Peer*
 {
@@ -192,8 +298,10 @@ void ConnectKnownParticipants::UpdateStage()
         const bool allWaitingForReplies{[this] {
             std::lock_guard<decltype(_mutex)> lock{_mutex};
             return std::all_of(_peers.begin(), _peers.end(), [](const auto& pair) {
-                const auto& peer{pair.second};
-                return peer->GetStage() >= PeerStage::WAITING_FOR_REPLY;
+                // deferred peers do not delay joining the simulation
+                const auto stage{pair.second->GetStage()};
+                return stage == PeerStage::WAITING_FOR_REPLY || stage == PeerStage::REPLY_RECEIVED
+                       || stage == PeerStage::DEFERRED;
             });
         }()};
 
@@ -211,8 +319,8 @@ void ConnectKnownParticipants::UpdateStage()
         const bool allRepliesReceived{[this] {
             std::lock_guard<decltype(_mutex)> lock{_mutex};
             return std::all_of(_peers.begin(), _peers.end(), [](const auto& pair) {
-                const auto& peer{pair.second};
-                return peer->GetStage() >= PeerStage::REPLY_RECEIVED;
+                const auto stage{pair.second->GetStage()};
+                return stage == PeerStage::REPLY_RECEIVED || stage == PeerStage::DEFERRED;
             });
         }()};
 
@@ -247,6 +355,11 @@ auto ConnectKnownParticipants::Peer::GetInfo() const -> const VAsioPeerInfo&
     return _info;
 }
 
+auto ConnectKnownParticipants::Peer::GetDeferredNetworks() const -> const std::vector<std::string>&
+{
+    return _deferredNetworks;
+}
+
 
 void ConnectKnownParticipants::Peer::StartConnecting()
 {
@@ -259,6 +372,30 @@ void ConnectKnownParticipants::Peer::StartConnecting()
     _directConnectPeer->AsyncConnect(1, _manager->_settings.directConnectTimeout);
 }
 
+void ConnectKnownParticipants::Peer::DeferConnecting(std::vector<std::string> networks)
+{
+    SILKIT_TRACE_METHOD_(_manager->_logger, "()");
+
+    _deferredNetworks = std::move(networks);
+    _peerStage = PeerStage::DEFERRED;
+}
+
+bool ConnectKnownParticipants::Peer::StartConnectingIfDeferred()
+{
+    SILKIT_TRACE_METHOD_(_manager->_logger, "()");
+
+    // the connection can be requested concurrently, e.g., by creating services on multiple threads
+    auto expected{PeerStage::DEFERRED};
+    if (!_peerStage.compare_exchange_strong(expected, PeerStage::DIRECT))
+    {
+        return false;
+    }
+
+    _wasDeferred = true;
+    StartConnecting();
+    return true;
+}
+
 void ConnectKnownParticipants::Peer::HandleEvent(PeerEvent event)
 {
     SILKIT_TRACE_METHOD_(_manager->_logger, "({})", event);
@@ -334,6 +471,11 @@ void ConnectKnownParticipants::Peer::HandleEvent(PeerEvent event)
         _peerStage = PeerStage::REPLY_RECEIVED;
         _manager->UpdateStage();
 
+        if (_wasDeferred)
+        {
+            _manager->_listener->OnConnectKnownParticipantsDeferredPeerConnected(*_manager, _info.participantName);
+        }
+
         return;
     }
     }
@@ -384,6 +526,9 @@ auto ConnectKnownParticipants::Peer::Describe() const -> std::string
     case PeerStage::REPLY_RECEIVED:
         fmt::format_to(it, "is connected");
         break;
+    case PeerStage::DEFERRED:
+        fmt::format_to(it, "is not connected until it is needed");
+        break;
     }
 
     return buffer;
@@ -527,6 +672,8 @@ struct fmt::formatter<::SilKit::Core::ConnectKnownParticipants::PeerStage> : for
             return formatter<string_view>::format("WAITING_FOR_REPLY", ctx);
         case Stage::REPLY_RECEIVED:
             return formatter<string_view>::format("REPLY_RECEIVED", ctx);
+        case Stage::DEFERRED:
+            return formatter<string_view>::format("DEFERRED", ctx);
         default:
             return fmt::format_to(ctx.out(), "ConnectionManager::PeerStage({})",
                                   static_cast<std::underlying_type_t<Stage>>(stage));
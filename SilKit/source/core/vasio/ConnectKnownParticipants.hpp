@@ -17,8 +17,10 @@
 #include <atomic>
 #include <future>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "fmt/format.h"
 
@@ -39,6 +41,10 @@ struct ConnectKnownParticipantsSettings
 {
     std::chrono::milliseconds directConnectTimeout{5000};
     std::chrono::milliseconds remoteConnectRequestTimeout{5000};
+    /// Defer connecting to peers which announce networks, none of which is in the networks of this participant
+    bool lazyPeerConnections{false};
+    /// Networks, topics and function names of this participant
+    std::set<std::string> networks;
 };
 
 
@@ -68,6 +74,9 @@ public:
         WAITING_FOR_REPLY,
         /// ParticipantAnnouncementReply has been received
         REPLY_RECEIVED,
+        /// Connecting is deferred until the peer is needed, which does not delay joining the simulation. UpdateStage
+        /// checks this stage explicitly, it is not ordered relative to the other stages.
+        DEFERRED,
     };
 
 private:
@@ -91,14 +100,19 @@ private:
         std::unique_ptr<IConnectPeer> _directConnectPeer;
         std::unique_ptr<ITimer> _remoteConnectRequestTimer;
         std::string _failureReason;
+        std::vector<std::string> _deferredNetworks;
+        bool _wasDeferred{false};
 
     public:
         Peer(ConnectKnownParticipants& manager, VAsioPeerInfo info);
 
         auto GetInfo() const -> const VAsioPeerInfo&;
         auto GetStage() const -> PeerStage;
+        auto GetDeferredNetworks() const -> const std::vector<std::string>&;
 
         void StartConnecting();
+        void DeferConnecting(std::vector<std::string> networks);
+        bool StartConnectingIfDeferred();
         void HandleEvent(PeerEvent event);
         void Shutdown();
 
@@ -138,14 +152,21 @@ public:
     void SetLogger(SilKit::Services::Logging::ILoggerInternal& logger);
 
     void SetKnownParticipants(const std::vector<VAsioPeerInfo>& peerInfos);
+    /// Waits for the known participants and starts connecting to them. Only the first call has an effect.
     void StartConnecting();
     void HandlePeerEvent(const std::string& participantName, PeerEvent event);
     void Shutdown();
 
+    /// Starts connecting to the deferred peers which announced the network, topic or function name
+    void ConnectDeferredPeers(const std::string& network);
+    /// Starts connecting to the peer, if connecting to it was deferred
+    void ConnectDeferredPeer(const std::string& participantName);
+
     auto Describe() -> std::string;
 
 private:
     auto FindPeerByName(const std::string& name) -> Peer*;
+    auto GetDeferrableNetworks(const VAsioPeerInfo& peerInfo) const -> std::vector<std::string>;
     void UpdateStage();
 
     friend struct ::fmt::formatter<PeerEvent>;
@@ -9,6 +9,8 @@
 #include "core/vasio/VAsioConnection.hpp"
 #include "core/vasio/VAsioPeerInfo.hpp"
 #include "core/vasio/VAsioPeer.hpp"
+#include "core/vasio/VAsioConstants.hpp"
+#include "core/vasio/io/SharedMemoryConnector.hpp"
 
 #include "util/Uri.hpp"
 
@@ -30,11 +32,13 @@ namespace VSilKit {
 
 
 ConnectPeer::ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILoggerInternal* logger,
-                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets)
+                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets,
+                         bool enableSharedMemory)
     : _ioContext{ioContext}
     , _logger{logger}
     , _peerInfo{peerInfo}
     , _enableDomainSockets{enableDomainSockets}
+    , _enableSharedMemory{enableSharedMemory}
 {
     SILKIT_ASSERT(_ioContext != nullptr);
     SILKIT_ASSERT(!_peerInfo.participantName.empty());
@@ -92,6 +96,11 @@ void ConnectPeer::UpdateUris()
 {
     std::vector<Uri> acceptorUris;
 
+    // the peer listens for shared memory connections next to each of its local-domain acceptors
+    const SilKit::Core::VAsioCapabilities capabilities{_peerInfo.capabilities};
+    const bool useSharedMemory{_enableSharedMemory
+                               && capabilities.HasCapability(SilKit::Core::Capabilities::SharedMemory)};
+
     for (const auto& str : _peerInfo.acceptorUris)
     {
         try
@@ -122,6 +131,11 @@ void ConnectPeer::UpdateUris()
             }
             else
             {
+                if (useSharedMemory && uri.Type() == Uri::UriType::Local)
+                {
+                    acceptorUris.emplace_back(Uri::Parse("shm://" + uri.Path() + SHARED_MEMORY_ACCEPTOR_SUFFIX));
+                }
+
                 acceptorUris.emplace_back(std::move(uri));
             }
         }
@@ -144,6 +158,8 @@ void ConnectPeer::UpdateUris()
         const auto ComputePenalty{[](const Uri& uri) -> int {
             switch (uri.Type())
             {
+            case Uri::UriType::SharedMemory:
+                return 50;
             case Uri::UriType::Local:
                 return 100;
             case Uri::UriType::Tcp:
@@ -220,6 +236,14 @@ void ConnectPeer::TryNextUri()
             }
             break;
 
+        case Uri::UriType::SharedMemory:
+            if (_enableDomainSockets && _enableSharedMemory)
+            {
+                _connector = std::make_unique<SharedMemoryConnector>(*_ioContext, *_logger,
+                                                                     _ioContext->MakeLocalConnector(uri.Path()));
+            }
+            break;
+
         default:
             _logger->MakeMessage(SilKit::Services::Logging::Level::Warn, TopicOf(*this))
                 .SetMessage("Invalid uri type {}", static_cast<std::underlying_type_t<Uri::UriType>>(uri.Type()))
@@ -41,6 +41,7 @@ class ConnectPeer
     SilKit::Services::Logging::ILoggerInternal* _logger{nullptr};
     SilKit::Core::VAsioPeerInfo _peerInfo;
     bool _enableDomainSockets{false};
+    bool _enableSharedMemory{false};
 
     IConnectPeerListener* _listener{nullptr};
 
@@ -54,7 +55,7 @@ class ConnectPeer
 
 public:
     ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILoggerInternal* logger,
-                const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets);
+                const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets, bool enableSharedMemory = false);
     ~ConnectPeer() override;
 
 public: // IConnectPeer
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string>
+
 
 namespace SilKit {
 namespace Core {
@@ -19,6 +21,9 @@ struct IConnectKnownParticipantsListener
     virtual void OnConnectKnownParticipantsFailure(ConnectKnownParticipants& connectKnownParticipants) = 0;
     virtual void OnConnectKnownParticipantsWaitingForAllReplies(ConnectKnownParticipants& connectKnownParticipants) = 0;
     virtual void OnConnectKnownParticipantsAllRepliesReceived(ConnectKnownParticipants& connectKnownParticipants) = 0;
+    /// Called when the handshake with a peer completed, whose connection was deferred while joining
+    virtual void OnConnectKnownParticipantsDeferredPeerConnected(ConnectKnownParticipants& connectKnownParticipants,
+                                                                 const std::string& participantName) = 0;
 };
 
 
@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/IoThreadCommandQueue.hpp"
+
+#include <iterator>
+
+namespace SilKit {
+namespace Core {
+
+IoThreadCommandQueue::IoThreadCommandQueue(std::function<void()> wakeUp)
+    : _wakeUp{std::move(wakeUp)}
+{
+}
+
+void IoThreadCommandQueue::Drain()
+{
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        std::swap(_pending, _executing);
+    }
+
+    // commands pushed while the batch is executed are collected in _pending and trigger another wake-up
+    std::size_t index{0};
+    try
+    {
+        for (; index < _executing.size(); ++index)
+        {
+            _executing[index]();
+        }
+    }
+    catch (...)
+    {
+        // keep the commands following the failed one, they are executed by the next Drain
+        bool wakeUp{false};
+        {
+            std::lock_guard<decltype(_mutex)> lock{_mutex};
+            wakeUp = _pending.empty() && index + 1 < _executing.size();
+            _pending.insert(_pending.begin(), std::make_move_iterator(_executing.begin() + index + 1),
+                            std::make_move_iterator(_executing.end()));
+        }
+        _executing.clear();
+
+        if (wakeUp)
+        {
+            _wakeUp();
+        }
+        throw;
+    }
+
+    _executing.clear();
+}
+
+auto IoThreadCommandQueue::Size() const -> std::size_t
+{
+    std::lock_guard<decltype(_mutex)> lock{_mutex};
+    return _pending.size();
+}
+
+} // namespace Core
+} // namespace SilKit
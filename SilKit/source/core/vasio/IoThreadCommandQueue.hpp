@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Move-only, type-erased command which is executed on the IO thread.
+//!
+//! Callables up to InlineStorageSize bytes (e.g., a send command capturing the message) are stored inline, larger
+//! ones are allocated on the heap.
+class IoThreadCommand
+{
+public:
+    static constexpr std::size_t InlineStorageSize = 192;
+
+public:
+    // constructors and destructors
+    template <typename FunctionT,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<FunctionT>, IoThreadCommand>::value>>
+    IoThreadCommand(FunctionT&& function);
+
+    IoThreadCommand(IoThreadCommand&& other) noexcept;
+    IoThreadCommand& operator=(IoThreadCommand&& other) noexcept;
+
+    IoThreadCommand(const IoThreadCommand&) = delete;
+    IoThreadCommand& operator=(const IoThreadCommand&) = delete;
+
+    ~IoThreadCommand();
+
+public:
+    // public methods
+    void operator()();
+
+    bool IsStoredInline() const;
+
+private:
+    struct Operations
+    {
+        void (*invoke)(void* storage);
+        void (*moveConstruct)(void* destination, void* source);
+        void (*destroy)(void* storage);
+        bool isInline;
+    };
+
+    template <typename FunctionT>
+    static constexpr bool FitsInline();
+
+    template <typename FunctionT>
+    static auto GetOperations() -> const Operations*;
+
+    void Reset();
+
+private:
+    // member variables
+    alignas(std::max_align_t) unsigned char _storage[InlineStorageSize];
+    const Operations* _operations{nullptr};
+};
+
+//! \brief Queue of commands which are posted to the IO thread by the user threads.
+//!
+//! Commands are executed in FIFO order. Only the first command enqueued into an empty queue triggers the wake-up of
+//! the IO thread, which then executes all queued commands as one batch.
+class IoThreadCommandQueue
+{
+public:
+    // constructors and destructors
+
+    //! The wake-up function must post a call to Drain to the IO thread.
+    explicit IoThreadCommandQueue(std::function<void()> wakeUp);
+
+public:
+    // public methods
+    template <typename FunctionT>
+    void Push(FunctionT&& function);
+
+    //! Executes all commands queued up to now. Must only be called on the IO thread.
+    void Drain();
+
+    auto Size() const -> std::size_t;
+
+private:
+    // member variables
+    std::function<void()> _wakeUp;
+
+    mutable std::mutex _mutex;
+    std::vector<IoThreadCommand> _pending;
+    // Only accessed by the IO thread, keeps its capacity between batches
+    std::vector<IoThreadCommand> _executing;
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+template <typename FunctionT>
+constexpr bool IoThreadCommand::FitsInline()
+{
+    return sizeof(FunctionT) <= InlineStorageSize && alignof(FunctionT) <= alignof(std::max_align_t)
+           && std::is_nothrow_move_constructible<FunctionT>::value;
+}
+
+template <typename FunctionT>
+auto IoThreadCommand::GetOperations() -> const Operations*
+{
+    if constexpr (FitsInline<FunctionT>())
+    {
+        static constexpr Operations operations{
+            [](void* storage) { (*static_cast<FunctionT*>(storage))(); },
+            [](void* destination, void* source) {
+                new (destination) FunctionT{std::move(*static_cast<FunctionT*>(source))};
+            },
+            [](void* storage) { static_cast<FunctionT*>(storage)->~FunctionT(); },
+            true,
+        };
+        return &operations;
+    }
+    else
+    {
+        // the inline storage holds the pointer to the heap allocated callable
+        static constexpr Operations operations{
+            [](void* storage) { (**static_cast<FunctionT**>(storage))(); },
+            [](void* destination, void* source) {
+                new (destination) FunctionT*{std::exchange(*static_cast<FunctionT**>(source), nullptr)};
+            },
+            [](void* storage) { delete *static_cast<FunctionT**>(storage); },
+            false,
+        };
+        return &operations;
+    }
+}
+
+template <typename FunctionT, typename>
+IoThreadCommand::IoThreadCommand(FunctionT&& function)
+{
+    using DecayedFunctionT = std::decay_t<FunctionT>;
+    if constexpr (FitsInline<DecayedFunctionT>())
+    {
+        new (_storage) DecayedFunctionT{std::forward<FunctionT>(function)};
+    }
+    else
+    {
+        new (_storage) DecayedFunctionT*{new DecayedFunctionT{std::forward<FunctionT>(function)}};
+    }
+    _operations = GetOperations<DecayedFunctionT>();
+}
+
+inline IoThreadCommand::IoThreadCommand(IoThreadCommand&& other) noexcept
+    : _operations{other._operations}
+{
+    if (_operations != nullptr)
+    {
+        _operations->moveConstruct(_storage, other._storage);
+        other.Reset();
+    }
+}
+
+inline IoThreadCommand& IoThreadCommand::operator=(IoThreadCommand&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        _operations = other._operations;
+        if (_operations != nullptr)
+        {
+            _operations->moveConstruct(_storage, other._storage);
+            other.Reset();
+        }
+    }
+    return *this;
+}
+
+inline IoThreadCommand::~IoThreadCommand()
+{
+    Reset();
+}
+
+inline void IoThreadCommand::operator()()
+{
+    _operations->invoke(_storage);
+}
+
+inline bool IoThreadCommand::IsStoredInline() const
+{
+    return _operations != nullptr && _operations->isInline;
+}
+
+inline void IoThreadCommand::Reset()
+{
+    if (_operations != nullptr)
+    {
+        _operations->destroy(_storage);
+        _operations = nullptr;
+    }
+}
+
+template <typename FunctionT>
+void IoThreadCommandQueue::Push(FunctionT&& function)
+{
+    bool wakeUp{false};
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _pending.emplace_back(std::forward<FunctionT>(function));
+        wakeUp = _pending.size() == 1;
+    }
+
+    if (wakeUp)
+    {
+        _wakeUp();
+    }
+}
+
+} // namespace Core
+} // namespace SilKit
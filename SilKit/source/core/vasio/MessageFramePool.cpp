@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/MessageFramePool.hpp"
+
+#include <atomic>
+
+namespace SilKit {
+namespace Core {
+
+MessageFramePool::MessageFramePool(std::size_t maxFrames, std::size_t maxPooledFrameSize)
+    : _maxFrames{maxFrames}
+    , _maxPooledFrameSize{maxPooledFrameSize}
+{
+    _frames.reserve(_maxFrames);
+}
+
+auto MessageFramePool::Acquire(std::size_t frameSize) -> std::shared_ptr<std::vector<uint8_t>>
+{
+    if (frameSize > _maxPooledFrameSize)
+    {
+        // large frames are not pooled to bound the memory held by the pool
+        return std::make_shared<std::vector<uint8_t>>(frameSize);
+    }
+
+    // round robin search for a frame which is no longer referenced outside of the pool
+    for (std::size_t i = 0; i < _frames.size(); ++i)
+    {
+        auto& frame = _frames[(_nextFrame + i) % _frames.size()];
+        if (frame.use_count() == 1)
+        {
+            // synchronizes with the release of the last outside reference, which may happen on another thread
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            _nextFrame = (_nextFrame + i + 1) % _frames.size();
+            frame->resize(frameSize);
+            return frame;
+        }
+    }
+
+    auto frame = std::make_shared<std::vector<uint8_t>>(frameSize);
+    if (_frames.size() < _maxFrames)
+    {
+        _frames.push_back(frame);
+    }
+    return frame;
+}
+
+auto MessageFramePool::NumberOfPooledFrames() const -> std::size_t
+{
+    return _frames.size();
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Pool of reference counted buffers for received message frames.
+//!
+//! Payloads deserialized from a frame (e.g., Util::SharedVector<uint8_t>) reference the frame instead of copying it.
+//! A frame is reused as soon as the pool holds the last reference to it.
+class MessageFramePool
+{
+public:
+    // constructors and destructors
+    MessageFramePool(std::size_t maxFrames, std::size_t maxPooledFrameSize);
+
+public:
+    // public methods
+
+    //! Returns a frame of the given size, either a currently unused pooled one or a freshly allocated one.
+    auto Acquire(std::size_t frameSize) -> std::shared_ptr<std::vector<uint8_t>>;
+
+    auto NumberOfPooledFrames() const -> std::size_t;
+
+private:
+    // member variables
+    std::vector<std::shared_ptr<std::vector<uint8_t>>> _frames;
+    std::size_t _nextFrame{0};
+
+    const std::size_t _maxFrames;
+    const std::size_t _maxPooledFrameSize;
+};
+
+} // namespace Core
+} // namespace SilKit
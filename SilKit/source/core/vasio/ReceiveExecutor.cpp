@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/ReceiveExecutor.hpp"
+
+#include "util/SetThreadName.hpp"
+#include "util/SpinWait.hpp"
+
+namespace SilKit {
+namespace Core {
+
+ReceiveExecutor::ReceiveExecutor(std::size_t numberOfThreads, const std::string& threadName,
+                                 ErrorHandler errorHandler, std::chrono::nanoseconds spinWaitBudget)
+    : _errorHandler{std::move(errorHandler)}
+    , _spinWaitBudget{spinWaitBudget}
+{
+    for (std::size_t index = 0; index < numberOfThreads; ++index)
+    {
+        _shards.emplace_back(std::make_unique<Shard>());
+    }
+
+    for (std::size_t index = 0; index < numberOfThreads; ++index)
+    {
+        auto& shard = *_shards[index];
+        shard.thread = std::thread{[this, &shard, name = threadName + " " + std::to_string(index)] {
+            SilKit::Util::SetThreadName(name.substr(0, 15));
+            Run(shard);
+        }};
+    }
+}
+
+ReceiveExecutor::~ReceiveExecutor()
+{
+    for (auto& shard : _shards)
+    {
+        {
+            std::lock_guard<decltype(shard->mutex)> lock{shard->mutex};
+            shard->stopRequested = true;
+        }
+        shard->wakeUp.notify_one();
+    }
+
+    for (auto& shard : _shards)
+    {
+        if (shard->thread.joinable())
+        {
+            shard->thread.join();
+        }
+    }
+}
+
+auto ReceiveExecutor::GetNumberOfThreads() const -> std::size_t
+{
+    return _shards.size();
+}
+
+auto ReceiveExecutor::GetShard(const std::string& networkName) const -> std::size_t
+{
+    return std::hash<std::string>{}(networkName) % _shards.size();
+}
+
+void ReceiveExecutor::Drain()
+{
+    const auto isDrained = [this] { return _outstandingTasks.load() == 0; };
+    if (Util::SpinUntil(isDrained, _spinWaitBudget))
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_drainMutex)> lock{_drainMutex};
+    // announced before checking the predicate, so the last finishing thread either sees the waiter or the waiter sees
+    // that all tasks are done
+    _drainWaiters.fetch_add(1);
+    _drained.wait(lock, isDrained);
+    _drainWaiters.fetch_sub(1);
+}
+
+void ReceiveExecutor::Push(Shard& shard, IoThreadCommand command)
+{
+    _outstandingTasks.fetch_add(1);
+
+    bool wakeUp{false};
+    {
+        std::lock_guard<decltype(shard.mutex)> lock{shard.mutex};
+        shard.pending.emplace_back(std::move(command));
+        shard.numberOfPending.store(shard.pending.size());
+        // a spinning thread checks the pending tasks again before it waits for the notification
+        wakeUp = shard.pending.size() == 1 && !shard.spinning.load();
+    }
+
+    if (wakeUp)
+    {
+        shard.wakeUp.notify_one();
+    }
+}
+
+void ReceiveExecutor::Run(Shard& shard)
+{
+    // only accessed by this thread, keeps its capacity between batches
+    std::vector<IoThreadCommand> executing;
+
+    while (true)
+    {
+        if (_spinWaitBudget > std::chrono::nanoseconds::zero())
+        {
+            shard.spinning.store(true);
+            Util::SpinUntil([&shard] { return shard.numberOfPending.load() != 0; }, _spinWaitBudget);
+        }
+
+        {
+            std::unique_lock<decltype(shard.mutex)> lock{shard.mutex};
+            // cleared under the lock, so tasks posted from now on notify this thread
+            shard.spinning.store(false);
+            shard.wakeUp.wait(lock, [&shard] { return shard.stopRequested || !shard.pending.empty(); });
+
+            if (shard.stopRequested)
+            {
+                return;
+            }
+
+            std::swap(shard.pending, executing);
+            shard.numberOfPending.store(0);
+        }
+
+        for (auto& command : executing)
+        {
+            try
+            {
+                command();
+            }
+            catch (const std::exception& exception)
+            {
+                _errorHandler(exception);
+            }
+        }
+
+        const auto numberOfTasks = executing.size();
+        executing.clear();
+
+        if (_outstandingTasks.fetch_sub(numberOfTasks) == numberOfTasks && _drainWaiters.load() != 0)
+        {
+            // the lock orders the update before the predicate check of a thread entering Drain
+            {
+                std::lock_guard<decltype(_drainMutex)> lock{_drainMutex};
+            }
+            _drained.notify_all();
+        }
+    }
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "core/vasio/IoThreadCommandQueue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Threads which deserialize and dispatch received messages besides the IO thread.
+//!
+//! Every network is assigned to one shard, i.e., one thread. The tasks of a shard are executed in the order they were
+//! posted, so the messages of a network keep their order, while the messages of different networks are handled
+//! concurrently.
+//!
+//! With a spin budget, idle threads (and threads in Drain) busy-wait for up to the budget before they block, and
+//! threads are only notified if they actually block. This saves the wake-ups on the path between two simulation steps.
+class ReceiveExecutor
+{
+public:
+    //! Marks receivers whose messages are dispatched on the IO thread
+    static constexpr std::size_t NoShard{static_cast<std::size_t>(-1)};
+
+    using ErrorHandler = std::function<void(const std::exception&)>;
+
+public:
+    // constructors and destructors
+    ReceiveExecutor(std::size_t numberOfThreads, const std::string& threadName, ErrorHandler errorHandler,
+                    std::chrono::nanoseconds spinWaitBudget = std::chrono::nanoseconds::zero());
+
+    ReceiveExecutor(const ReceiveExecutor&) = delete;
+    ReceiveExecutor& operator=(const ReceiveExecutor&) = delete;
+
+    //! Stops and joins the threads, tasks which have not been started yet are discarded.
+    ~ReceiveExecutor();
+
+public:
+    // public methods
+    auto GetNumberOfThreads() const -> std::size_t;
+    auto GetShard(const std::string& networkName) const -> std::size_t;
+
+    template <typename FunctionT>
+    void Post(std::size_t shard, FunctionT&& function);
+
+    //! Blocks until all tasks posted up to now have been executed. Must not be called from a task.
+    void Drain();
+
+private:
+    struct Shard
+    {
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::vector<IoThreadCommand> pending;
+        bool stopRequested{false};
+        std::thread thread;
+        // set while the thread spins, i.e., checks the pending tasks without waiting for the notification
+        std::atomic<bool> spinning{false};
+        // number of pending tasks, checked while spinning without taking the mutex
+        std::atomic<std::size_t> numberOfPending{0};
+    };
+
+    void Run(Shard& shard);
+    void Push(Shard& shard, IoThreadCommand command);
+
+private:
+    // member variables
+    ErrorHandler _errorHandler;
+    std::chrono::nanoseconds _spinWaitBudget;
+    std::vector<std::unique_ptr<Shard>> _shards;
+
+    std::atomic<std::size_t> _outstandingTasks{0};
+    std::mutex _drainMutex;
+    std::condition_variable _drained;
+    // number of threads blocked in Drain
+    std::atomic<std::size_t> _drainWaiters{0};
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+template <typename FunctionT>
+void ReceiveExecutor::Post(std::size_t shard, FunctionT&& function)
+{
+    Push(*_shards[shard], IoThreadCommand{std::forward<FunctionT>(function)});
+}
+
+} // namespace Core
+} // namespace SilKit
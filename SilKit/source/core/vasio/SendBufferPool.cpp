@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/SendBufferPool.hpp"
+
+#include <iterator>
+
+namespace {
+
+thread_local std::vector<std::vector<uint8_t>> tPooledBuffers;
+
+} // namespace
+
+namespace SilKit {
+namespace Core {
+
+auto SendBufferPool::Acquire(std::size_t capacity) -> std::vector<uint8_t>
+{
+    // prefer the most recently released buffer which is large enough, it is most likely still cached
+    for (auto it = tPooledBuffers.rbegin(); it != tPooledBuffers.rend(); ++it)
+    {
+        if (it->capacity() >= capacity)
+        {
+            auto buffer = std::move(*it);
+            tPooledBuffers.erase(std::next(it).base());
+            return buffer;
+        }
+    }
+
+    // grow the most recently released buffer, it is kept in the pool with the larger capacity later on
+    std::vector<uint8_t> buffer;
+    if (!tPooledBuffers.empty())
+    {
+        buffer = std::move(tPooledBuffers.back());
+        tPooledBuffers.pop_back();
+    }
+    buffer.reserve(capacity);
+    return buffer;
+}
+
+void SendBufferPool::Release(std::vector<uint8_t> buffer)
+{
+    if (tPooledBuffers.size() >= MaxPooledBuffers || buffer.capacity() > MaxPooledBufferCapacity
+        || buffer.capacity() == 0)
+    {
+        return;
+    }
+
+    buffer.clear();
+    tPooledBuffers.emplace_back(std::move(buffer));
+}
+
+auto SendBufferPool::NumberOfPooledBuffers() -> std::size_t
+{
+    return tPooledBuffers.size();
+}
+
+} // namespace Core
+} // namespace SilKit
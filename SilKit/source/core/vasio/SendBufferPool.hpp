@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Thread-local pool of the buffers outgoing messages are serialized into.
+//!
+//! The buffer of a sent message is released into the pool of the thread which completed the write, and reused for
+//! the next message serialized on that thread. Since both happen on the IO thread, sending does not allocate once
+//! the pool is warmed up.
+class SendBufferPool
+{
+public:
+    //! Buffers exceeding the pool size or this capacity are freed instead of pooled.
+    static constexpr std::size_t MaxPooledBuffers{64};
+    static constexpr std::size_t MaxPooledBufferCapacity{1024 * 1024};
+
+public:
+    //! Returns an empty buffer with at least the given capacity, pooled if possible.
+    static auto Acquire(std::size_t capacity) -> std::vector<uint8_t>;
+    //! Returns the buffer to the pool of the calling thread.
+    static void Release(std::vector<uint8_t> buffer);
+
+    static auto NumberOfPooledBuffers() -> std::size_t;
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -14,6 +14,25 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     ReadNetworkHeaders();
 }
 
+SerializedMessage::SerializedMessage(std::shared_ptr<std::vector<uint8_t>> frame)
+    : _buffer{std::move(frame)}
+{
+    ReadNetworkHeaders();
+}
+
+SerializedMessage::SerializedMessage(const SerializedMessage& other, std::vector<uint8_t> storage)
+    : _messageSize{other._messageSize}
+    , _messageKind{other._messageKind}
+    , _registryKind{other._registryKind}
+    , _aggregationKind{other._aggregationKind}
+    , _endpointAddress{other._endpointAddress}
+    , _remoteIndex{other._remoteIndex}
+    , _registryMessageHeader{other._registryMessageHeader}
+    , _proxyMessageHeader{other._proxyMessageHeader}
+    , _buffer{other._buffer, std::move(storage)}
+{
+}
+
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
     auto buffer = _buffer.ReleaseStorage();
@@ -76,20 +95,28 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
-void SerializedMessage::WriteNetworkHeaders()
+void SerializedMessage::WriteNetworkHeaders(MessageBuffer& buffer)
 {
-    _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
-    _buffer << _messageKind;
+    buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
+    buffer << _messageKind;
     if (_messageKind == VAsioMsgKind::SilKitRegistryMessage)
     {
-        _buffer << _registryKind;
+        buffer << _registryKind;
     }
     if (IsMwOrSim(_messageKind))
     {
-        _buffer << _remoteIndex << _endpointAddress;
+        buffer << _remoteIndex << _endpointAddress;
     }
 }
 
+auto SerializedMessage::NetworkHeadersSize() -> size_t
+{
+    MessageBuffer sizeCounter;
+    sizeCounter.CountSizeOnly();
+    WriteNetworkHeaders(sizeCounter);
+    return sizeCounter.WritePos();
+}
+
 void SerializedMessage::ReadNetworkHeaders()
 {
     _messageSize = ExtractMessageSize(_buffer);
@@ -146,6 +173,20 @@ void SerializedMessage::ReadNetworkHeaders()
     }
 }
 
+void SerializedMessage::SetRemoteIndex(EndpointId remoteIndex)
+{
+    if (!IsMwOrSim(_messageKind))
+    {
+        throw SilKitError("SerializedMessage::SetRemoteIndex called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+
+    // the remote index directly follows the message size and the message kind, see WriteNetworkHeaders()
+    constexpr auto remoteIndexOffset = sizeof(_messageSize) + sizeof(std::underlying_type_t<VAsioMsgKind>);
+    _buffer.OverwriteAt(remoteIndexOffset, remoteIndex);
+    _remoteIndex = remoteIndex;
+}
+
 void SerializedMessage::SetAggregationKind(MessageAggregationKind msgAggregationKind)
 {
     _aggregationKind = msgAggregationKind;
@@ -7,6 +7,7 @@
 #include "core/vasio/VAsioDatatypes.hpp"
 #include "core/vasio/SerializedMessageTraits.hpp"
 #include "core/vasio/AggregationMessageTraits.hpp"
+#include "core/vasio/SendBufferPool.hpp"
 #include "core/internal/MessageBuffer.hpp"
 
 // Component specific Serialize/Deserialize functions
@@ -34,21 +35,16 @@ auto AdlDeserialize(Args&&... args) -> decltype(auto)
     return Deserialize(std::forward<Args>(args)...);
 }
 
+//! \brief Returns the exact number of bytes Serialize writes for the message, without copying any of its data
 template <typename T>
-struct SerializedSize
+auto SerializedSize(const T& message, ProtocolVersion version) -> size_t
 {
-    size_t _size{};
-    SerializedSize(const T& message)
-    {
-        MessageBuffer buffer;
-        Serialize(buffer, message);
-        _size = buffer.ReleaseStorage().size();
-    }
-    size_t Size() const
-    {
-        return _size;
-    }
-};
+    MessageBuffer sizeCounter;
+    sizeCounter.SetProtocolVersion(version);
+    sizeCounter.CountSizeOnly();
+    Serialize(sizeCounter, message);
+    return sizeCounter.WritePos();
+}
 
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
@@ -67,11 +63,16 @@ public: // Sending a SerializedMessage: from T to binary blob
     explicit SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex);
     template <typename MessageT>
     explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+    //! Copy of the other message, which is stored in the given buffer (e.g., from the SendBufferPool)
+    explicit SerializedMessage(const SerializedMessage& other, std::vector<uint8_t> storage);
 
+    //! The returned buffer can be handed back to the SendBufferPool once it has been sent
     auto ReleaseStorage() -> std::vector<uint8_t>;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
     explicit SerializedMessage(std::vector<uint8_t>&& blob);
+    //! Payloads of type Util::SharedVector<uint8_t> reference the frame instead of copying it
+    explicit SerializedMessage(std::shared_ptr<std::vector<uint8_t>> frame);
 
     template <typename ApiMessageT>
     auto Deserialize() -> ApiMessageT;
@@ -89,13 +90,19 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 
     void SetAggregationKind(MessageAggregationKind msgAggregationKind);
 
+    //! Patch the remote index of an already serialized SilKitSimMsg in place (e.g., for fan-out to multiple peers)
+    void SetRemoteIndex(EndpointId remoteIndex);
+
     auto GetStorageSize() const -> size_t
     {
         return _buffer.PeekData().size();
     }
 
 private:
-    void WriteNetworkHeaders();
+    template <typename MessageT>
+    void WriteMessage(const MessageT& message);
+    void WriteNetworkHeaders(MessageBuffer& buffer);
+    auto NetworkHeadersSize() -> size_t;
     void ReadNetworkHeaders();
     // network headers, some members are optional depending on messageKind
     uint32_t _messageSize{0};
@@ -119,14 +126,10 @@ private:
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _aggregationKind = aggregationKind<MessageT>();
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -134,15 +137,11 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 template <typename MessageT>
 SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _aggregationKind = aggregationKind<MessageT>();
     _buffer.SetProtocolVersion(version);
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -150,20 +149,29 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _remoteIndex = remoteIndex;
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _aggregationKind = aggregationKind<MessageT>();
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+template <typename MessageT>
+void SerializedMessage::WriteMessage(const MessageT& message)
+{
+    // the exact size is known upfront, the buffer is taken from the pool and never grows while serializing
+    const auto protocolVersion = _buffer.GetProtocolVersion();
+    const auto size = NetworkHeadersSize() + SerializedSize(message, protocolVersion);
+
+    _buffer = MessageBuffer{SendBufferPool::Acquire(size)};
+    _buffer.SetProtocolVersion(protocolVersion);
+    WriteNetworkHeaders(_buffer);
+    Serialize(_buffer, message);
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
@@ -52,6 +52,16 @@ inline constexpr auto messageKind<VAsioMsgSubscriber>() -> VAsioMsgKind
 {
     return VAsioMsgKind::SubscriptionAnnouncement;
 }
+template <>
+inline constexpr auto messageKind<BulkSubscriptionAnnouncement>() -> VAsioMsgKind
+{
+    return VAsioMsgKind::BulkSubscriptionAnnouncement;
+}
+template <>
+inline constexpr auto messageKind<BulkSubscriptionAcknowledge>() -> VAsioMsgKind
+{
+    return VAsioMsgKind::BulkSubscriptionAcknowledge;
+}
 
 // Proxy messages
 template <>
@@ -7,12 +7,16 @@
 #include "services/logging/LoggerMessage.hpp"
 
 #include "core/vasio/VAsioTransmitter.hpp"
+#include "core/vasio/ReceiveExecutor.hpp"
 #include "core/internal/traits/SilKitMsgTraits.hpp"
 #include "services/logging/MessageTracing.hpp"
 
 #include "core/internal/IMessageReceiver.hpp"
+#include "services/metrics/IHistogramMetric.hpp"
 #include "services/orchestration/TimeSyncService.hpp"
 
+#include <chrono>
+
 namespace SilKit {
 namespace Core {
 
@@ -21,6 +25,7 @@ class SilKitLink
 {
 public:
     using ReceiverT = IMessageReceiver<MsgT>;
+    using SendTimePoint = std::chrono::steady_clock::time_point;
 
 public:
     // ----------------------------------------
@@ -52,18 +57,35 @@ public:
     std::vector<std::string> GetParticipantNamesOfRemoteReceivers();
 
     void DistributeRemoteSilKitMessage(const IServiceEndpoint* from, MsgT&& msg);
-    void DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg);
+    //! \brief The send latency is taken once the message is handed to the peers, before it is delivered locally
+    void DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg, SendTimePoint sendTime);
 
     void SetHistoryLength(size_t history);
 
+    //! \brief Records the time between the send call and the hand-over of each message to the peers, if a metric is set
+    void SetSendLatencyMetric(VSilKit::IHistogramMetric* metric);
+    void TakeSendLatency(SendTimePoint sendTime);
+
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName,
-                                       const MsgT& msg);
+                                       const MsgT& msg, SendTimePoint sendTime);
+
+    //! \brief Self deliveries are dispatched by the given shard, which also dispatches the remote messages of the link
+    void SetReceiveExecutor(ReceiveExecutor* executor, size_t shard);
 
 private:
     // ----------------------------------------
     // private methods
     void DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg);
     void DistributeToSelf(const IServiceEndpoint* from, const MsgT& msg);
+    void DeliverToSelf(const IServiceEndpoint* from, const MsgT& msg);
+
+private:
+    // The endpoint of a local receiver is looked up once when it is added, not per message
+    struct LocalReceiver
+    {
+        ReceiverT* receiver;
+        const IServiceEndpoint* endpoint;
+    };
 
 private:
     // ----------------------------------------
@@ -71,9 +93,13 @@ private:
     std::string _name;
     Services::Logging::ILoggerInternal* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
+    bool _isMessageTracingEnabled;
 
-    std::vector<ReceiverT*> _localReceivers;
+    std::vector<LocalReceiver> _localReceivers;
     VAsioTransmitter<MsgT> _vasioTransmitter;
+    VSilKit::IHistogramMetric* _sendLatencyMetric{nullptr};
+    ReceiveExecutor* _receiveExecutor{nullptr};
+    size_t _receiveShard{ReceiveExecutor::NoShard};
 };
 
 // ================================================================================
@@ -86,6 +112,7 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILoggerInterna
     : _name{std::move(name)}
     , _logger{logger}
     , _timeProvider{timeProvider}
+    , _isMessageTracingEnabled{Services::IsMessageTracingEnabled(logger)}
     , _vasioTransmitter{logger}
 {
 }
@@ -93,9 +120,10 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILoggerInterna
 template <class MsgT>
 void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
 {
-    if (std::find(_localReceivers.begin(), _localReceivers.end(), receiver) != _localReceivers.end())
+    if (std::any_of(_localReceivers.begin(), _localReceivers.end(),
+                    [receiver](const LocalReceiver& localReceiver) { return localReceiver.receiver == receiver; }))
         return;
-    _localReceivers.push_back(receiver);
+    _localReceivers.push_back(LocalReceiver{receiver, dynamic_cast<const IServiceEndpoint*>(receiver)});
 }
 
 template <class MsgT>
@@ -148,21 +176,24 @@ void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* fro
         SetTimestamp(msg, _timeProvider->Now());
     }
 
-    for (auto&& receiver : _localReceivers)
+    for (auto&& localReceiver : _localReceivers)
     {
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
 // Distribute outgoing (= from local) SilKitMessages to local (via _localReceivers) and remote (via transmitter per MsgT) receivers
 template <class MsgT>
-void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg)
+void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg,
+                                                    SendTimePoint sendTime)
 {
     // NB: Messages must be dispatched to remote receivers first.
     // Otherwise, messages that may be produced during the internal dispatch will be dispatched to remote receivers first.
     // As a result, the messages may be delivered in the wrong order (possibly even reversed)
     DispatchSilKitMessage(&_vasioTransmitter, from, msg);
-    DistributeToSelf(from, msg);
+    // the latency must not include the handlers of the local receivers
+    TakeSendLatency(sendTime);
+    DeliverToSelf(from, msg);
 }
 
 template <class MsgT>
@@ -174,22 +205,37 @@ void SilKitLink<MsgT>::DistributeToSelf(const IServiceEndpoint* from, const MsgT
     }
     else
     {
-        for (auto&& receiver : _localReceivers)
+        for (auto&& localReceiver : _localReceivers)
         {
-            auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
             if constexpr (!SilKitMsgTraits<MsgT>::IsSelfDeliveryEnforced())
             {
-                if (receiverId->GetServiceDescriptor() == from->GetServiceDescriptor())
+                if (localReceiver.endpoint->GetServiceDescriptor() == from->GetServiceDescriptor())
                     continue;
             }
             // Trace reception of self delivery
-            Services::TraceRx(_logger, receiverId, msg, from->GetServiceDescriptor());
+            if (_isMessageTracingEnabled)
+            {
+                Services::TraceRx(_logger, localReceiver.endpoint, msg, from->GetServiceDescriptor());
+            }
 
-            DispatchSilKitMessage(receiver, from, msg);
+            DispatchSilKitMessage(localReceiver.receiver, from, msg);
         }
     }
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::DeliverToSelf(const IServiceEndpoint* from, const MsgT& msg)
+{
+    if (_receiveExecutor == nullptr || _localReceivers.empty() || SilKitMsgTraits<MsgT>::IsSelfDeliveryForbidden())
+    {
+        DistributeToSelf(from, msg);
+        return;
+    }
+
+    // keep the order with the remote messages of this link, which are dispatched by the receive executor
+    _receiveExecutor->Post(_receiveShard, [this, from, msg] { DistributeToSelf(from, msg); });
+}
+
 // Dispatcher for outgoing SilKitMessages
 template <class MsgT>
 void SilKitLink<MsgT>::DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg)
@@ -214,15 +260,18 @@ void SilKitLink<MsgT>::DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoi
 
 template <class MsgT>
 void SilKitLink<MsgT>::DispatchSilKitMessageToTarget(const IServiceEndpoint* from,
-                                                     const std::string& targetParticipantName, const MsgT& msg)
+                                                     const std::string& targetParticipantName, const MsgT& msg,
+                                                     SendTimePoint sendTime)
 {
     if (from->GetServiceDescriptor().GetParticipantName() == targetParticipantName)
     {
-        DistributeToSelf(from, msg);
+        TakeSendLatency(sendTime);
+        DeliverToSelf(from, msg);
     }
     else
     {
         _vasioTransmitter.SendMessageToTarget(from, targetParticipantName, msg);
+        TakeSendLatency(sendTime);
     }
 }
 
@@ -232,5 +281,30 @@ void SilKitLink<MsgT>::SetHistoryLength(size_t history)
     _vasioTransmitter.SetHistoryLength(history);
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::SetSendLatencyMetric(VSilKit::IHistogramMetric* metric)
+{
+    _sendLatencyMetric = metric;
+}
+
+template <class MsgT>
+void SilKitLink<MsgT>::SetReceiveExecutor(ReceiveExecutor* executor, size_t shard)
+{
+    _receiveExecutor = executor;
+    _receiveShard = shard;
+}
+
+template <class MsgT>
+void SilKitLink<MsgT>::TakeSendLatency(SendTimePoint sendTime)
+{
+    if (_sendLatencyMetric == nullptr)
+    {
+        return;
+    }
+
+    const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(SendTimePoint::clock::now() - sendTime);
+    _sendLatencyMetric->Take(static_cast<uint64_t>(latency.count()));
+}
+
 } // namespace Core
 } // namespace SilKit
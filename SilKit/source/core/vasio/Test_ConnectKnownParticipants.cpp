@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "core/vasio/ConnectKnownParticipants.hpp"
+#include "core/vasio/VAsioCapabilities.hpp"
 
 #include "services/logging/MockLogger.hpp"
 
@@ -114,6 +115,55 @@ TEST_F(Test_ConnectKnownParticipants, empty_known_participants_calls_success_han
 }
 
 
+TEST_F(Test_ConnectKnownParticipants, start_connecting_only_connects_once)
+{
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    // Arrange
+
+    Sequence s1;
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    {
+        EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+            .Times(1)
+            .InSequence(s1)
+            .WillOnce(MakeSucceedingConnectPeer);
+
+        EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfo.acceptorUris.front())))
+            .InSequence(s1)
+            .WillOnce([](std::unique_ptr<IRawByteStream>) {
+            auto vAsioPeer{std::make_unique<NiceMock<MockVAsioPeer>>()};
+            return vAsioPeer;
+        });
+
+        EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+        EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+    }
+
+    MockConnectKnownParticipantsListener listener;
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1).InSequence(s1);
+
+    // Act
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    // connecting is started when the known participants are received, and again after the registry replied
+    connectKnownParticipants.SetKnownParticipants({peerInfo});
+    connectKnownParticipants.StartConnecting();
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+}
+
 TEST_F(Test_ConnectKnownParticipants, successful_connection_initiates_waiting_for_replies)
 {
     auto MakeSucceedingConnectPeer{
@@ -458,4 +508,90 @@ TEST_F(Test_ConnectKnownParticipants, remote_connect_fallback_to_proxy_after_fai
 }
 
 
+TEST_F(Test_ConnectKnownParticipants, lazy_peer_connections_defer_peers_without_shared_network)
+{
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+    auto MakeVAsioPeer{[](std::unique_ptr<IRawByteStream>) {
+        auto vAsioPeer{std::make_unique<NiceMock<MockVAsioPeer>>()};
+        return vAsioPeer;
+    }};
+
+    const auto MakePeerInfo{[](const std::string& participantName, const std::string& acceptorUri,
+                               const std::string& network) {
+        VAsioCapabilities capabilities;
+        capabilities.AddCapabilityValue(Capabilities::LazyPeerConnections, CapabilityKeys::Network, network);
+
+        VAsioPeerInfo peerInfo;
+        peerInfo.participantName = participantName;
+        peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+        peerInfo.acceptorUris.emplace_back(acceptorUri);
+        peerInfo.capabilities = capabilities.ToCapabilitiesString();
+        return peerInfo;
+    }};
+
+    const auto peerInfoA{MakePeerInfo("A", "local:///one", "CAN1")};
+    const auto peerInfoB{MakePeerInfo("B", "local:///two", "ETH1")};
+
+    settings.lazyPeerConnections = true;
+    settings.networks = {"CAN1"};
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    MockConnectKnownParticipantsListener listener;
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    // Arrange: only the participant sharing a network is connected when joining
+
+    Sequence s1;
+
+    EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfoA.participantName)))
+        .InSequence(s1)
+        .WillOnce(MakeSucceedingConnectPeer);
+    EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfoA.acceptorUris.front())))
+        .InSequence(s1)
+        .WillOnce(MakeVAsioPeer);
+    EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+    EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1).InSequence(s1);
+    EXPECT_CALL(listener, OnConnectKnownParticipantsAllRepliesReceived).Times(1).InSequence(s1);
+
+    // Act
+
+    connectKnownParticipants.SetKnownParticipants({peerInfoA, peerInfoB});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+
+    connectKnownParticipants.HandlePeerEvent(peerInfoA.participantName, PeerEvent::PARTICIPANT_ANNOUNCEMENT_REPLY);
+
+    // Arrange: the other participant is connected once its network is used
+
+    EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfoB.participantName)))
+        .InSequence(s1)
+        .WillOnce(MakeSucceedingConnectPeer);
+    EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfoB.acceptorUris.front())))
+        .InSequence(s1)
+        .WillOnce(MakeVAsioPeer);
+    EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+    EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsDeferredPeerConnected(_, Eq(peerInfoB.participantName)))
+        .Times(1)
+        .InSequence(s1);
+
+    // Act
+
+    connectKnownParticipants.ConnectDeferredPeers("CAN1");
+    connectKnownParticipants.ConnectDeferredPeers("ETH1");
+    connectKnownParticipants.ConnectDeferredPeers("ETH1");
+
+    ioContext.Run();
+
+    connectKnownParticipants.HandlePeerEvent(peerInfoB.participantName, PeerEvent::PARTICIPANT_ANNOUNCEMENT_REPLY);
+}
+
+
 } // namespace
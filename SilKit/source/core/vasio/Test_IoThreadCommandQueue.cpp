@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/IoThreadCommandQueue.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+TEST(Test_IoThreadCommandQueue, only_the_first_command_wakes_up_the_io_thread)
+{
+    size_t wakeUps{0};
+    IoThreadCommandQueue queue{[&wakeUps] { ++wakeUps; }};
+
+    std::vector<int> executed;
+    for (int i = 0; i < 3; ++i)
+    {
+        queue.Push([&executed, i] { executed.push_back(i); });
+    }
+    ASSERT_EQ(wakeUps, 1u);
+    ASSERT_EQ(queue.Size(), 3u);
+
+    queue.Drain();
+    ASSERT_EQ(executed, (std::vector<int>{0, 1, 2}));
+    ASSERT_EQ(queue.Size(), 0u);
+
+    queue.Push([&executed] { executed.push_back(3); });
+    ASSERT_EQ(wakeUps, 2u);
+}
+
+TEST(Test_IoThreadCommandQueue, commands_pushed_while_draining_are_executed_by_the_next_drain)
+{
+    size_t wakeUps{0};
+    IoThreadCommandQueue queue{[&wakeUps] { ++wakeUps; }};
+
+    std::vector<int> executed;
+    queue.Push([&queue, &executed] {
+        executed.push_back(0);
+        queue.Push([&executed] { executed.push_back(1); });
+    });
+
+    queue.Drain();
+    ASSERT_EQ(executed, (std::vector<int>{0}));
+    ASSERT_EQ(wakeUps, 2u);
+
+    queue.Drain();
+    ASSERT_EQ(executed, (std::vector<int>{0, 1}));
+}
+
+TEST(Test_IoThreadCommandQueue, commands_after_a_throwing_command_are_kept)
+{
+    size_t wakeUps{0};
+    IoThreadCommandQueue queue{[&wakeUps] { ++wakeUps; }};
+
+    std::vector<int> executed;
+    queue.Push([&executed] { executed.push_back(0); });
+    queue.Push([] { throw std::runtime_error{"failure"}; });
+    queue.Push([&executed] { executed.push_back(2); });
+
+    ASSERT_THROW(queue.Drain(), std::runtime_error);
+    ASSERT_EQ(executed, (std::vector<int>{0}));
+    ASSERT_EQ(wakeUps, 2u);
+
+    queue.Drain();
+    ASSERT_EQ(executed, (std::vector<int>{0, 2}));
+}
+
+TEST(Test_IoThreadCommandQueue, small_commands_are_stored_inline)
+{
+    std::string text{"moved into the command"};
+    IoThreadCommand smallCommand{[text = std::move(text)] { (void)text; }};
+    ASSERT_TRUE(smallCommand.IsStoredInline());
+
+    std::array<char, IoThreadCommand::InlineStorageSize + 1> largeCapture{};
+    size_t invocations{0};
+    IoThreadCommand largeCommand{[largeCapture, &invocations] {
+        (void)largeCapture;
+        ++invocations;
+    }};
+    ASSERT_FALSE(largeCommand.IsStoredInline());
+
+    // both kinds survive being moved around
+    std::vector<IoThreadCommand> commands;
+    commands.emplace_back(std::move(smallCommand));
+    commands.emplace_back(std::move(largeCommand));
+    commands.reserve(100);
+    for (auto&& command : commands)
+    {
+        command();
+    }
+    ASSERT_EQ(invocations, 1u);
+}
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/MessageFramePool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+TEST(Test_MessageFramePool, unreferenced_frames_are_reused)
+{
+    MessageFramePool pool{4, 1024};
+
+    auto frame = pool.Acquire(100);
+    ASSERT_EQ(frame->size(), 100u);
+    const auto* frameAddress = frame.get();
+    frame.reset();
+
+    auto reusedFrame = pool.Acquire(200);
+    ASSERT_EQ(reusedFrame.get(), frameAddress);
+    ASSERT_EQ(reusedFrame->size(), 200u);
+    ASSERT_EQ(pool.NumberOfPooledFrames(), 1u);
+}
+
+TEST(Test_MessageFramePool, referenced_frames_are_not_reused)
+{
+    MessageFramePool pool{2, 1024};
+
+    auto frame1 = pool.Acquire(10);
+    auto frame2 = pool.Acquire(10);
+    ASSERT_NE(frame1, frame2);
+
+    // the pool is exhausted, further frames are allocated but not pooled
+    auto frame3 = pool.Acquire(10);
+    ASSERT_NE(frame3, frame1);
+    ASSERT_NE(frame3, frame2);
+    ASSERT_EQ(pool.NumberOfPooledFrames(), 2u);
+
+    const auto* frame2Address = frame2.get();
+    frame2.reset();
+    ASSERT_EQ(pool.Acquire(10).get(), frame2Address);
+}
+
+TEST(Test_MessageFramePool, large_frames_are_not_pooled)
+{
+    MessageFramePool pool{2, 1024};
+
+    auto frame = pool.Acquire(2048);
+    ASSERT_EQ(frame->size(), 2048u);
+    ASSERT_EQ(pool.NumberOfPooledFrames(), 0u);
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/ReceiveExecutor.hpp"
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+namespace {
+
+auto IgnoreErrors() -> ReceiveExecutor::ErrorHandler
+{
+    return [](const std::exception&) {};
+}
+
+} // namespace
+
+TEST(Test_ReceiveExecutor, tasks_of_a_shard_are_executed_in_order)
+{
+    ReceiveExecutor executor{2, "Test", IgnoreErrors()};
+
+    std::vector<int> executed;
+    for (int i = 0; i < 1000; ++i)
+    {
+        executor.Post(1, [&executed, i] { executed.push_back(i); });
+    }
+    executor.Drain();
+
+    ASSERT_EQ(executed.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(executed[i], i);
+    }
+}
+
+TEST(Test_ReceiveExecutor, shards_are_executed_concurrently)
+{
+    ReceiveExecutor executor{2, "Test", IgnoreErrors()};
+
+    // the task of the first shard only completes, if the task of the second shard runs at the same time
+    std::promise<void> secondStarted;
+    auto secondStartedFuture = secondStarted.get_future();
+    std::atomic<bool> firstCompleted{false};
+    executor.Post(0, [&] {
+        ASSERT_EQ(secondStartedFuture.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+        firstCompleted = true;
+    });
+    executor.Post(1, [&] { secondStarted.set_value(); });
+    executor.Drain();
+
+    ASSERT_TRUE(firstCompleted);
+}
+
+TEST(Test_ReceiveExecutor, network_is_always_assigned_to_the_same_shard)
+{
+    ReceiveExecutor executor{4, "Test", IgnoreErrors()};
+
+    ASSERT_EQ(executor.GetNumberOfThreads(), 4u);
+    for (const std::string networkName : {"CAN1", "ETH1", "LIN1"})
+    {
+        ASSERT_LT(executor.GetShard(networkName), 4u);
+        ASSERT_EQ(executor.GetShard(networkName), executor.GetShard(networkName));
+    }
+}
+
+TEST(Test_ReceiveExecutor, throwing_task_is_reported_and_following_tasks_are_executed)
+{
+    std::vector<std::string> errors;
+    ReceiveExecutor executor{1, "Test", [&errors](const std::exception& exception) {
+        errors.emplace_back(exception.what());
+    }};
+
+    bool executed{false};
+    executor.Post(0, [] { throw std::runtime_error{"failure"}; });
+    executor.Post(0, [&executed] { executed = true; });
+    executor.Drain();
+
+    ASSERT_EQ(errors, (std::vector<std::string>{"failure"}));
+    ASSERT_TRUE(executed);
+}
+
+TEST(Test_ReceiveExecutor, tasks_are_executed_and_drained_with_a_spin_wait_budget)
+{
+    ReceiveExecutor executor{2, "Test", IgnoreErrors(), std::chrono::microseconds{50}};
+
+    // alternate between bursts and pauses longer than the budget, so both the spinning and the blocking wait are used
+    std::atomic<int> executed{0};
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            executor.Post(static_cast<std::size_t>(i % 2), [&executed] { ++executed; });
+        }
+        executor.Drain();
+        ASSERT_EQ(executed.load(), (round + 1) * 50);
+
+        if (round % 2 == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+}
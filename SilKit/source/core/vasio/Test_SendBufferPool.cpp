@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/SendBufferPool.hpp"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+namespace {
+
+// every thread has its own pool, running the checks on a fresh thread makes them independent of other tests
+template <typename FunctionT>
+void RunOnFreshThread(FunctionT function)
+{
+    std::thread thread{function};
+    thread.join();
+}
+
+} // namespace
+
+TEST(Test_SendBufferPool, released_buffers_are_reused)
+{
+    RunOnFreshThread([] {
+        auto buffer = SendBufferPool::Acquire(100);
+        ASSERT_TRUE(buffer.empty());
+        ASSERT_GE(buffer.capacity(), 100u);
+        buffer.resize(100);
+        const auto* bufferAddress = buffer.data();
+
+        SendBufferPool::Release(std::move(buffer));
+        ASSERT_EQ(SendBufferPool::NumberOfPooledBuffers(), 1u);
+
+        auto reusedBuffer = SendBufferPool::Acquire(50);
+        ASSERT_TRUE(reusedBuffer.empty());
+        ASSERT_EQ(reusedBuffer.data(), bufferAddress);
+        ASSERT_EQ(SendBufferPool::NumberOfPooledBuffers(), 0u);
+    });
+}
+
+TEST(Test_SendBufferPool, buffers_with_sufficient_capacity_are_preferred)
+{
+    RunOnFreshThread([] {
+        std::vector<uint8_t> largeBuffer;
+        largeBuffer.reserve(1000);
+        const auto* largeBufferAddress = largeBuffer.data();
+        std::vector<uint8_t> smallBuffer;
+        smallBuffer.reserve(10);
+
+        SendBufferPool::Release(std::move(largeBuffer));
+        SendBufferPool::Release(std::move(smallBuffer));
+        ASSERT_EQ(SendBufferPool::NumberOfPooledBuffers(), 2u);
+
+        ASSERT_EQ(SendBufferPool::Acquire(500).data(), largeBufferAddress);
+
+        // no pooled buffer is large enough, the most recently released one grows
+        auto grownBuffer = SendBufferPool::Acquire(2000);
+        ASSERT_GE(grownBuffer.capacity(), 2000u);
+        ASSERT_EQ(SendBufferPool::NumberOfPooledBuffers(), 0u);
+    });
+}
+
+TEST(Test_SendBufferPool, pool_size_and_buffer_capacity_are_bounded)
+{
+    RunOnFreshThread([] {
+        SendBufferPool::Release(SendBufferPool::Acquire(SendBufferPool::MaxPooledBufferCapacity + 1));
+        ASSERT_EQ(SendBufferPool::NumberOfPooledBuffers(), 0u);
+
+        for (size_t i = 0; i <= SendBufferPool::MaxPooledBuffers; ++i)
+        {
+            std::vector<uint8_t> buffer;
+            buffer.reserve(10);
+            SendBufferPool::Release(std::move(buffer));
+        }
+        ASSERT_EQ(SendBufferPool::NumberOfPooledBuffers(), SendBufferPool::MaxPooledBuffers);
+    });
+}
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <array>
 #include <string>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -82,3 +83,94 @@ TEST(Test_SerializedMessage, packed_handshake_message)
     ASSERT_EQ(ptr->simulationNameSize, announcement.simulationName.size());
     ASSERT_EQ(to_string(ptr->simulationName, ptr->simulationNameSize), announcement.simulationName);
 }
+
+TEST(Test_SerializedMessage, patch_remote_index_of_sim_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent dataMessage;
+    dataMessage.timestamp = std::chrono::nanoseconds{1234};
+    dataMessage.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5}};
+    const EndpointAddress from{5, 6};
+
+    SerializedMessage msg{dataMessage, from, 1};
+    auto patchedMsg = msg;
+    patchedMsg.SetRemoteIndex(42);
+    ASSERT_EQ(patchedMsg.GetRemoteIndex(), 42u);
+
+    // the patched copy must be indistinguishable from a message serialized with the new remote index
+    auto expectedBlob = SerializedMessage{dataMessage, from, 42}.ReleaseStorage();
+    auto patchedBlob = patchedMsg.ReleaseStorage();
+    ASSERT_EQ(patchedBlob, expectedBlob);
+
+    // the original message is unaffected
+    ASSERT_EQ(msg.GetRemoteIndex(), 1u);
+
+    SerializedMessage received{std::move(patchedBlob)};
+    ASSERT_EQ(received.GetRemoteIndex(), 42u);
+    ASSERT_EQ(received.GetEndpointAddress(), from);
+    auto receivedData = received.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+    ASSERT_EQ(receivedData.timestamp, dataMessage.timestamp);
+    ASSERT_EQ(SilKit::Util::ToStdVector(receivedData.data.AsSpan()), SilKit::Util::ToStdVector(dataMessage.data.AsSpan()));
+}
+
+TEST(Test_SerializedMessage, storage_is_sized_exactly)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent dataMessage;
+    const EndpointAddress from{5, 6};
+
+    // the thread has an empty send buffer pool, the storage is allocated with the exact size of the message
+    std::thread{[&dataMessage, &from] {
+        for (size_t payloadSize : {10u, 1000u, 100u})
+        {
+            dataMessage.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 0xAB)};
+            const auto expectedSize = SerializedMessage{dataMessage, from, 1}.GetStorageSize();
+
+            auto blob = SerializedMessage{dataMessage, from, 1}.ReleaseStorage();
+            ASSERT_EQ(blob.size(), expectedSize);
+            ASSERT_EQ(blob.capacity(), expectedSize);
+        }
+    }}.join();
+}
+
+TEST(Test_SerializedMessage, released_storage_is_reused_by_the_next_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent dataMessage;
+    dataMessage.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(100, 0xAB)};
+    const EndpointAddress from{5, 6};
+
+    std::thread{[&dataMessage, &from] {
+        auto blob = SerializedMessage{dataMessage, from, 1}.ReleaseStorage();
+        const auto* storageAddress = blob.data();
+        SendBufferPool::Release(std::move(blob));
+
+        auto nextBlob = SerializedMessage{dataMessage, from, 1}.ReleaseStorage();
+        ASSERT_EQ(nextBlob.data(), storageAddress);
+    }}.join();
+}
+
+TEST(Test_SerializedMessage, copy_into_given_storage)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent dataMessage;
+    dataMessage.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5}};
+    const EndpointAddress from{5, 6};
+
+    SerializedMessage msg{dataMessage, from, 1};
+
+    std::vector<uint8_t> storage;
+    storage.reserve(1024);
+    const auto* storageAddress = storage.data();
+
+    SerializedMessage copy{msg, std::move(storage)};
+    ASSERT_EQ(copy.GetRemoteIndex(), 1u);
+    ASSERT_EQ(copy.GetEndpointAddress(), from);
+
+    auto copyBlob = copy.ReleaseStorage();
+    ASSERT_EQ(copyBlob.data(), storageAddress);
+    ASSERT_EQ(copyBlob, msg.ReleaseStorage());
+}
+
+TEST(Test_SerializedMessage, patch_remote_index_rejects_registry_message)
+{
+    ParticipantAnnouncement announcement;
+    SerializedMessage msg{announcement};
+    ASSERT_THROW(msg.SetRemoteIndex(42), SilKit::SilKitError);
+}
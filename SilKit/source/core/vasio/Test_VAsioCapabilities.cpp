@@ -181,4 +181,21 @@ TEST(Test_VAsioCapabilities, multiple_capabilities_roundtrip)
     EXPECT_TRUE(roundtrip.HasCapability("ghi"));
 }
 
+TEST(Test_VAsioCapabilities, capability_values_roundtrip)
+{
+    auto original = SilKit::Core::VAsioCapabilities{};
+    original.AddCapability("abc");
+    original.AddCapabilityValue("def", "network", "CAN1");
+    original.AddCapabilityValue("def", "network", "Name with \"quotes\", commas and spaces");
+
+    const auto roundtrip = SilKit::Core::VAsioCapabilities{original.ToCapabilitiesString()};
+    EXPECT_EQ(roundtrip.Count(), 2u);
+    EXPECT_TRUE(roundtrip.HasCapability("abc"));
+    EXPECT_TRUE(roundtrip.HasCapability("def"));
+    EXPECT_EQ(roundtrip.GetCapabilityValues("def", "network"),
+              (std::vector<std::string>{"CAN1", "Name with \"quotes\", commas and spaces"}));
+    EXPECT_TRUE(roundtrip.GetCapabilityValues("def", "topic").empty());
+    EXPECT_TRUE(roundtrip.GetCapabilityValues("abc", "network").empty());
+}
+
 } // namespace
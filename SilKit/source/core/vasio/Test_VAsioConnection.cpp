@@ -41,6 +41,8 @@
 #include "services/logging/LoggerMessage.hpp"
 
 #include <chrono>
+#include <future>
+#include <thread>
 
 #include "core/vasio/mock/MockVAsioPeer.hpp"
 
@@ -82,6 +84,22 @@ struct MockSilKitMessageReceiver
     MOCK_METHOD(const ServiceDescriptor&, GetServiceDescriptor, (), (override, const));
 };
 
+struct MockHistogramMetric : VSilKit::IHistogramMetric
+{
+    MOCK_METHOD(void, Take, (uint64_t), (override));
+};
+
+// registered like a service which receives the TestMessage on the network of its service descriptor
+struct MockTestMessageService : MockSilKitMessageReceiver
+{
+    using SilKitReceiveMessagesTypes = std::tuple<Tests::Version2::TestMessage>;
+    using SilKitSendMessagesTypes = std::tuple<>;
+
+    explicit MockTestMessageService(const std::string& networkName)
+    {
+        _serviceDescriptor.SetNetworkName(networkName);
+    }
+};
 
 // adds some more behavior to MockVasioPeer
 struct MockVAsioPeer2 : public MockVAsioPeer
@@ -130,6 +148,52 @@ MATCHER_P(SubscriptionAcknowledgeMatcher, subscriber,
     return reply.status == SubscriptionAcknowledge::Status::Success && reply.subscriber == subscriber;
 }
 
+MATCHER_P(BulkSubscriptionAcknowledgeMatcher, subscribers,
+          "Deserialize the MessageBuffer from the SerializedMessage and check the acks of the bulk subscription")
+{
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::BulkSubscriptionAcknowledge)
+    {
+        return false;
+    }
+    auto reply = message.Deserialize<BulkSubscriptionAcknowledge>();
+    if (reply.acknowledges.size() != subscribers.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < subscribers.size(); ++i)
+    {
+        if (reply.acknowledges[i].status != SubscriptionAcknowledge::Status::Success
+            || !(reply.acknowledges[i].subscriber == subscribers[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+MATCHER_P(BulkSubscriptionAnnouncementMatcher, subscribers,
+          "Deserialize the MessageBuffer from the SerializedMessage and check the announced subscribers")
+{
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::BulkSubscriptionAnnouncement)
+    {
+        return false;
+    }
+    return message.Deserialize<BulkSubscriptionAnnouncement>().subscribers == subscribers;
+}
+
+auto MakeTestMessageSubscriber(EndpointId receiverIdx, const std::string& networkName) -> VAsioMsgSubscriber
+{
+    using MessageTrait = SilKit::Core::SilKitMsgTraits<Tests::Version2::TestMessage>;
+    VAsioMsgSubscriber subscriber;
+    subscriber.msgTypeName = MessageTrait::SerdesName();
+    subscriber.networkName = networkName;
+    subscriber.version = MessageTrait::Version();
+    subscriber.receiverIdx = receiverIdx;
+    return subscriber;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////
@@ -161,6 +225,62 @@ protected:
     {
         _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
     }
+
+    template <typename MessageT, typename ServiceT>
+    void RegisterSilKitMsgReceiver(VAsioConnection& connection, SilKit::Core::IMessageReceiver<MessageT>* receiver)
+    {
+        connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
+    }
+
+    template <typename MessageT>
+    void RegisterSilKitMsgSender(const IServiceEndpoint* sender)
+    {
+        _connection.RegisterSilKitMsgSender<MessageT>(sender);
+    }
+
+    template <typename MessageT>
+    void SendMsgImpl(const IServiceEndpoint* from, MessageT msg)
+    {
+        _connection.SendMsgImpl<MessageT>(from, {}, std::move(msg));
+    }
+
+    template <typename MessageT>
+    auto GetSenderLink(const IServiceEndpoint* from) -> SilKitLink<MessageT>*
+    {
+        return _connection.GetSenderLink<MessageT>(from);
+    }
+
+    template <typename MessageT>
+    auto GetLinkByName(const std::string& networkName) -> std::shared_ptr<SilKitLink<MessageT>>
+    {
+        return _connection.GetLinkByName<MessageT>(networkName);
+    }
+
+    void AddPeer(std::unique_ptr<IVAsioPeer> peer)
+    {
+        _connection.AddPeer(std::move(peer));
+    }
+
+    void SubscribeAtPeers(const std::vector<VAsioMsgSubscriber>& subscriptions)
+    {
+        _connection.SubscribeAtPeers(subscriptions, false);
+    }
+
+    auto GetNumberOfPendingSubscriptionAcknowledges() const -> size_t
+    {
+        return _connection._pendingSubscriptionAcknowledges.size();
+    }
+
+    // runs the commands posted to the IO thread on the calling thread, until there is no more work
+    void RunIoContext()
+    {
+        _connection._ioContext->Run();
+    }
+
+    bool IsPipeliningSubscriptions() const
+    {
+        return _connection._isPipeliningSubscriptions;
+    }
 };
 
 } // namespace Core
@@ -262,3 +382,294 @@ TEST_F(Test_VAsioConnection, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Bulk subscriptions
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, bulk_subscription_announcement_is_acknowledged_once)
+{
+    BulkSubscriptionAnnouncement announcement;
+    for (EndpointId receiverIdx = 0; receiverIdx < 3; ++receiverIdx)
+    {
+        announcement.subscribers.push_back(
+            MakeTestMessageSubscriber(receiverIdx, "unittest" + std::to_string(receiverIdx)));
+    }
+
+    EXPECT_CALL(_from, SendSilKitMsg(BulkSubscriptionAcknowledgeMatcher(announcement.subscribers))).Times(1);
+    _connection.OnSocketData(&_from, SerializedMessage{announcement});
+}
+
+TEST_F(Test_VAsioConnection, subscriptions_are_announced_in_bulk_to_capable_peers_only)
+{
+    const std::vector<VAsioMsgSubscriber> subscriptions{MakeTestMessageSubscriber(0, "unittest0"),
+                                                        MakeTestMessageSubscriber(1, "unittest1")};
+
+    VAsioCapabilities bulkCapabilities;
+    bulkCapabilities.AddCapability(Capabilities::BulkSubscription);
+
+    auto bulkPeer = std::make_unique<testing::NiceMock<MockVAsioPeer2>>();
+    bulkPeer->_peerInfo.participantName = "BulkPeer";
+    bulkPeer->_peerInfo.capabilities = bulkCapabilities.ToCapabilitiesString();
+    auto legacyPeer = std::make_unique<testing::NiceMock<MockVAsioPeer2>>();
+    legacyPeer->_peerInfo.participantName = "LegacyPeer";
+
+    EXPECT_CALL(*bulkPeer, SendSilKitMsg(BulkSubscriptionAnnouncementMatcher(subscriptions))).Times(1);
+    EXPECT_CALL(*bulkPeer, Subscribe(_)).Times(0);
+    EXPECT_CALL(*legacyPeer, Subscribe(_)).Times(2);
+
+    auto* bulkPeerPtr = bulkPeer.get();
+    auto* legacyPeerPtr = legacyPeer.get();
+    AddPeer(std::move(bulkPeer));
+    AddPeer(std::move(legacyPeer));
+
+    SubscribeAtPeers(subscriptions);
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 4u);
+
+    // a single message acknowledges all subscriptions at the bulk peer
+    BulkSubscriptionAcknowledge bulkAck;
+    for (const auto& subscriber : subscriptions)
+    {
+        bulkAck.acknowledges.push_back(SubscriptionAcknowledge{SubscriptionAcknowledge::Status::Success, subscriber});
+    }
+    _connection.OnSocketData(bulkPeerPtr, SerializedMessage{bulkAck});
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 2u);
+
+    for (const auto& subscriber : subscriptions)
+    {
+        SubscriptionAcknowledge ack{SubscriptionAcknowledge::Status::Success, subscriber};
+        _connection.OnSocketData(legacyPeerPtr, SerializedMessage{ack});
+    }
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 0u);
+}
+
+TEST_F(Test_VAsioConnection, pipelined_subscriptions_complete_after_the_last_acknowledge)
+{
+    auto peer = std::make_unique<testing::NiceMock<MockVAsioPeer2>>();
+    std::vector<VAsioMsgSubscriber> subscriptions;
+    EXPECT_CALL(*peer, Subscribe(_)).Times(2).WillRepeatedly([&subscriptions](VAsioMsgSubscriber subscriber) {
+        subscriptions.push_back(subscriber);
+    });
+    auto* peerPtr = peer.get();
+    AddPeer(std::move(peer));
+
+    // the synchronous registrations return without waiting for their acknowledges
+    testing::NiceMock<MockTestMessageService> service1{"unittest1"};
+    testing::NiceMock<MockTestMessageService> service2{"unittest2"};
+    _connection.StartPipelinedSubscriptions();
+    _connection.RegisterSilKitService(&service1);
+    _connection.RegisterSilKitService(&service2);
+    RunIoContext();
+    ASSERT_EQ(subscriptions.size(), 2u);
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 2u);
+
+    auto waitForPipelinedSubscriptions =
+        std::async(std::launch::async, [this] { _connection.WaitForPipelinedSubscriptions(); });
+    while (IsPipeliningSubscriptions())
+    {
+        RunIoContext();
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(waitForPipelinedSubscriptions.wait_for(10ms), std::future_status::timeout);
+
+    const auto acknowledge = [&subscriptions](size_t index) {
+        return SubscriptionAcknowledge{SubscriptionAcknowledge::Status::Success, subscriptions[index]};
+    };
+
+    // the acknowledges arrive in the opposite order of the registrations
+    EXPECT_NO_THROW(_connection.OnSocketData(peerPtr, SerializedMessage{acknowledge(1)}));
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 1u);
+    ASSERT_EQ(waitForPipelinedSubscriptions.wait_for(10ms), std::future_status::timeout);
+
+    EXPECT_NO_THROW(_connection.OnSocketData(peerPtr, SerializedMessage{acknowledge(0)}));
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 0u);
+    ASSERT_EQ(waitForPipelinedSubscriptions.wait_for(5s), std::future_status::ready);
+    EXPECT_NO_THROW(waitForPipelinedSubscriptions.get());
+
+    // a repeated acknowledge must not fulfill the promise a second time, which would throw
+    EXPECT_NO_THROW(_connection.OnSocketData(peerPtr, SerializedMessage{acknowledge(0)}));
+    EXPECT_NO_THROW(RunIoContext());
+}
+
+TEST_F(Test_VAsioConnection, compact_discovery_is_only_subscribed_at_capable_peers)
+{
+    using CompactTrait = SilKit::Core::SilKitMsgTraits<Discovery::CompactParticipantDiscoveryEvent>;
+    VAsioMsgSubscriber compactSubscriber;
+    compactSubscriber.msgTypeName = CompactTrait::SerdesName();
+    compactSubscriber.networkName = "default";
+    compactSubscriber.version = CompactTrait::Version();
+    compactSubscriber.receiverIdx = 0;
+    const auto testSubscriber = MakeTestMessageSubscriber(1, "unittest1");
+
+    VAsioCapabilities compactCapabilities;
+    compactCapabilities.AddCapability(Capabilities::CompactDiscovery);
+
+    auto compactPeer = std::make_unique<testing::NiceMock<MockVAsioPeer2>>();
+    compactPeer->_peerInfo.participantName = "CompactPeer";
+    compactPeer->_peerInfo.capabilities = compactCapabilities.ToCapabilitiesString();
+    auto legacyPeer = std::make_unique<testing::NiceMock<MockVAsioPeer2>>();
+    legacyPeer->_peerInfo.participantName = "LegacyPeer";
+
+    // the legacy peer would acknowledge the unknown message type as failed
+    EXPECT_CALL(*compactPeer, Subscribe(compactSubscriber)).Times(1);
+    EXPECT_CALL(*compactPeer, Subscribe(testSubscriber)).Times(1);
+    EXPECT_CALL(*legacyPeer, Subscribe(compactSubscriber)).Times(0);
+    EXPECT_CALL(*legacyPeer, Subscribe(testSubscriber)).Times(1);
+
+    AddPeer(std::move(compactPeer));
+    AddPeer(std::move(legacyPeer));
+
+    SubscribeAtPeers({compactSubscriber, testSubscriber});
+    ASSERT_EQ(GetNumberOfPendingSubscriptionAcknowledges(), 3u);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Receive path
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, received_messages_share_the_remote_service_endpoint_of_the_sender)
+{
+    MockSilKitMessageReceiver mockReceiver;
+    RegisterSilKitMsgReceiver<Tests::Version2::TestMessage, MockSilKitMessageReceiver>(&mockReceiver);
+
+    Tests::Version2::TestMessage message;
+    message.integer = 1234;
+    message.str = "1234";
+
+    EndpointAddress senderAddress{_from.GetServiceDescriptor().GetParticipantId(), 7};
+
+    std::vector<const IServiceEndpoint*> senders;
+    EXPECT_CALL(mockReceiver, ReceiveMsg(_, testing::A<const Tests::Version2::TestMessage&>()))
+        .Times(2)
+        .WillRepeatedly([&senders](const IServiceEndpoint* from, const Tests::Version2::TestMessage&) {
+        senders.push_back(from);
+    });
+
+    _connection.OnSocketData(&_from, SerializedMessage(message, senderAddress, 0));
+    _connection.OnSocketData(&_from, SerializedMessage(message, senderAddress, 0));
+
+    ASSERT_EQ(senders.size(), 2u);
+    EXPECT_EQ(senders[0], senders[1]);
+    EXPECT_EQ(senders[0]->GetServiceDescriptor().GetServiceId(), senderAddress.endpoint);
+    EXPECT_EQ(senders[0]->GetServiceDescriptor().GetParticipantName(), _from.GetInfo().participantName);
+}
+
+TEST_F(Test_VAsioConnection, bus_messages_are_dispatched_by_the_receive_threads)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.receiveThreads = 2;
+    VAsioConnection connection{nullptr, &_dummyMetricsManager, config, "Test_VAsioConnection", 1, &_timeProvider};
+    connection.SetLoggerInternal(&_dummyLogger);
+
+    testing::NiceMock<MockSilKitMessageReceiver> frameReceiver;
+    frameReceiver._serviceDescriptor.SetNetworkName("BUS1");
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(connection, &frameReceiver);
+
+    testing::NiceMock<MockSilKitMessageReceiver> messageReceiver;
+    messageReceiver._serviceDescriptor.SetNetworkName("MW1");
+    RegisterSilKitMsgReceiver<Tests::Version2::TestMessage, MockSilKitMessageReceiver>(connection, &messageReceiver);
+
+    std::promise<void> releaseFrameHandler;
+    auto releaseFrameHandlerFuture = releaseFrameHandler.get_future();
+    std::atomic<bool> frameHandled{false};
+    EXPECT_CALL(frameReceiver, ReceiveMsg(_, testing::A<const Tests::TestFrameEvent&>()))
+        .WillOnce([&](const IServiceEndpoint*, const Tests::TestFrameEvent&) {
+        releaseFrameHandlerFuture.wait();
+        frameHandled = true;
+    });
+
+    // the frame handler runs on a receive thread, so the IO thread is not blocked by it
+    EndpointAddress senderAddress{_from.GetServiceDescriptor().GetParticipantId(), 7};
+    connection.OnSocketData(&_from, SerializedMessage(Tests::TestFrameEvent{}, senderAddress, 0));
+
+    // messages which are not dispatched by the receive threads are handled after the preceding bus messages
+    EXPECT_CALL(messageReceiver, ReceiveMsg(_, testing::A<const Tests::Version2::TestMessage&>()))
+        .WillOnce([&frameHandled](const IServiceEndpoint*, const Tests::Version2::TestMessage&) {
+        EXPECT_TRUE(frameHandled);
+    });
+    releaseFrameHandler.set_value();
+    connection.OnSocketData(&_from, SerializedMessage(Tests::Version2::TestMessage{}, senderAddress, 1));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Send path
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, sender_link_is_resolved_during_registration)
+{
+    using MessageT = Tests::Version2::TestMessage;
+
+    testing::NiceMock<MockSilKitMessageReceiver> sender;
+    sender._serviceDescriptor.SetNetworkName("unittest");
+    RegisterSilKitMsgSender<MessageT>(&sender);
+
+    // the send path neither needs the network name nor the service descriptor of the registered sender
+    EXPECT_CALL(sender, GetServiceDescriptor()).Times(0);
+    ASSERT_EQ(GetSenderLink<MessageT>(&sender), GetLinkByName<MessageT>("unittest").get());
+    testing::Mock::VerifyAndClearExpectations(&sender);
+
+    // other endpoints on the same network share the link
+    testing::NiceMock<MockSilKitMessageReceiver> other;
+    other._serviceDescriptor.SetNetworkName("unittest");
+    ASSERT_EQ(GetSenderLink<MessageT>(&other), GetSenderLink<MessageT>(&sender));
+
+    // there is no link for networks without registered senders
+    other._serviceDescriptor.SetNetworkName("unknown");
+    ASSERT_EQ(GetSenderLink<MessageT>(&other), nullptr);
+}
+
+TEST_F(Test_VAsioConnection, sending_without_a_registered_sender_names_the_network)
+{
+    using MessageT = Tests::Version2::TestMessage;
+
+    testing::NiceMock<MockSilKitMessageReceiver> sender;
+    sender._serviceDescriptor.SetNetworkName("unregistered");
+
+    try
+    {
+        SendMsgImpl<MessageT>(&sender, MessageT{});
+        FAIL() << "sending without a registered sender must throw";
+    }
+    catch (const SilKit::SilKitError& error)
+    {
+        EXPECT_THAT(error.what(), testing::HasSubstr("\"unregistered\""));
+        EXPECT_THAT(error.what(), testing::HasSubstr("registered as a sender"));
+    }
+}
+
+TEST_F(Test_VAsioConnection, send_latency_is_only_taken_if_a_metric_is_set)
+{
+    using MessageT = Tests::Version2::TestMessage;
+
+    // the link latency is not collected by default
+    auto link = GetLinkByName<MessageT>("unittest");
+    MockHistogramMetric metric;
+    EXPECT_CALL(metric, Take(_)).Times(0);
+    link->TakeSendLatency(std::chrono::steady_clock::now());
+    testing::Mock::VerifyAndClearExpectations(&metric);
+
+    link->SetSendLatencyMetric(&metric);
+    EXPECT_CALL(metric, Take(testing::Ge(std::chrono::nanoseconds{1ms}.count()))).Times(1);
+    link->TakeSendLatency(std::chrono::steady_clock::now() - 1ms);
+}
+
+TEST_F(Test_VAsioConnection, send_latency_does_not_include_the_local_receivers)
+{
+    using MessageT = Tests::Version2::TestMessage;
+
+    testing::NiceMock<MockSilKitMessageReceiver> sender;
+    sender._serviceDescriptor.SetServiceId(2);
+    testing::NiceMock<MockSilKitMessageReceiver> localReceiver;
+
+    auto link = GetLinkByName<MessageT>("unittest");
+    link->AddLocalReceiver(&localReceiver);
+    MockHistogramMetric metric;
+    link->SetSendLatencyMetric(&metric);
+
+    bool latencyTaken{false};
+    EXPECT_CALL(metric, Take(_)).WillOnce([&latencyTaken](uint64_t) { latencyTaken = true; });
+    EXPECT_CALL(localReceiver, ReceiveMsg(_, testing::A<const MessageT&>()))
+        .WillOnce([&latencyTaken](const IServiceEndpoint*, const MessageT&) { EXPECT_TRUE(latencyTaken); });
+
+    link->DistributeLocalSilKitMessage(&sender, MessageT{}, std::chrono::steady_clock::now());
+}
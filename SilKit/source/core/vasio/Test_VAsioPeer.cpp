@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/VAsioPeer.hpp"
+
+#include "services/logging/MockLogger.hpp"
+
+#include "core/vasio/io/mock/MockIoContext.hpp"
+#include "core/vasio/io/mock/MockRawByteStream.hpp"
+#include "core/vasio/io/mock/MockTimer.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+
+using ::testing::_;
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+using VSilKit::MockTimer;
+
+
+struct MockVAsioPeerListener : IVAsioPeerListener
+{
+    MOCK_METHOD(void, OnSocketData, (IVAsioPeer*, SerializedMessage&&), (override));
+    MOCK_METHOD(void, OnPeerShutdown, (IVAsioPeer*), (override));
+};
+
+
+auto MakeSimMessage(size_t payloadSize) -> SerializedMessage
+{
+    SilKit::Services::PubSub::WireDataMessageEvent msg{};
+    msg.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 0xAB)};
+    return SerializedMessage{msg, EndpointAddress{1, 2}, 3};
+}
+
+
+struct Test_VAsioPeer : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    MockVAsioPeerListener peerListener;
+
+    MockRawByteStream* stream{nullptr};
+    IRawByteStreamListener* streamListener{nullptr};
+    std::unique_ptr<VAsioPeer> peer;
+
+    void SetUp() override
+    {
+        EXPECT_CALL(ioContext, MakeTimer).WillOnce([] { return std::make_unique<NiceMock<MockTimer>>(); });
+
+        auto rawByteStream = std::make_unique<NiceMock<MockRawByteStream>>();
+        stream = rawByteStream.get();
+        EXPECT_CALL(*stream, SetListener).WillOnce([this](IRawByteStreamListener& listener) {
+            streamListener = &listener;
+        });
+
+        peer = std::make_unique<VAsioPeer>(&peerListener, &ioContext, std::move(rawByteStream), &logger,
+                                           std::make_unique<VSilKit::NoMetrics>());
+    }
+};
+
+
+TEST_F(Test_VAsioPeer, queued_messages_are_sent_with_a_single_gather_write)
+{
+    std::vector<size_t> messageSizes;
+    for (size_t payloadSize : {10u, 20u, 30u})
+    {
+        auto msg = MakeSimMessage(payloadSize);
+        messageSizes.push_back(msg.GetStorageSize());
+        peer->SendSilKitMsg(std::move(msg));
+    }
+
+    EXPECT_CALL(*stream, AsyncWriteSome(_)).WillOnce([&messageSizes](ConstBufferSequence bufferSequence) {
+        ASSERT_EQ(bufferSequence.size(), messageSizes.size());
+        for (size_t i = 0; i < bufferSequence.size(); ++i)
+        {
+            EXPECT_EQ(bufferSequence[i].GetSize(), messageSizes[i]);
+        }
+    });
+
+    ioContext.Run();
+}
+
+TEST_F(Test_VAsioPeer, partial_gather_write_continues_with_remaining_bytes)
+{
+    std::vector<size_t> messageSizes;
+    for (size_t payloadSize : {10u, 20u, 30u})
+    {
+        auto msg = MakeSimMessage(payloadSize);
+        messageSizes.push_back(msg.GetStorageSize());
+        peer->SendSilKitMsg(std::move(msg));
+    }
+
+    EXPECT_CALL(*stream, AsyncWriteSome(_)).Times(1);
+    ioContext.Run();
+
+    // the first message and two bytes of the second message have been written
+    EXPECT_CALL(*stream, AsyncWriteSome(_)).WillOnce([&messageSizes](ConstBufferSequence bufferSequence) {
+        ASSERT_EQ(bufferSequence.size(), 2u);
+        EXPECT_EQ(bufferSequence[0].GetSize(), messageSizes[1] - 2);
+        EXPECT_EQ(bufferSequence[1].GetSize(), messageSizes[2]);
+    });
+    streamListener->OnAsyncWriteSomeDone(*stream, messageSizes[0] + 2);
+
+    // the remaining bytes have been written, no further writes are started
+    EXPECT_CALL(*stream, AsyncWriteSome(_)).Times(0);
+    streamListener->OnAsyncWriteSomeDone(*stream, messageSizes[1] - 2 + messageSizes[2]);
+}
+
+TEST_F(Test_VAsioPeer, messages_queued_during_write_are_sent_afterwards)
+{
+    auto first = MakeSimMessage(10);
+    const auto firstSize = first.GetStorageSize();
+    peer->SendSilKitMsg(std::move(first));
+
+    EXPECT_CALL(*stream, AsyncWriteSome(_)).Times(1);
+    ioContext.Run();
+
+    for (size_t payloadSize : {20u, 30u})
+    {
+        peer->SendSilKitMsg(MakeSimMessage(payloadSize));
+    }
+    ioContext.Run();
+
+    EXPECT_CALL(*stream, AsyncWriteSome(_)).WillOnce([](ConstBufferSequence bufferSequence) {
+        ASSERT_EQ(bufferSequence.size(), 2u);
+    });
+    streamListener->OnAsyncWriteSomeDone(*stream, firstSize);
+}
+
+TEST_F(Test_VAsioPeer, received_payload_references_the_message_frame)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent msg{};
+    msg.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>{1, 2, 3, 4, 5}};
+    auto blob = SerializedMessage{msg, EndpointAddress{1, 2}, 3}.ReleaseStorage();
+
+    std::vector<MutableBuffer> readBuffers;
+    EXPECT_CALL(*stream, AsyncReadSome(_)).WillRepeatedly([&readBuffers](MutableBufferSequence bufferSequence) {
+        readBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+    });
+    peer->StartAsyncRead();
+    ASSERT_FALSE(readBuffers.empty());
+    ASSERT_GE(readBuffers[0].GetSize(), blob.size());
+    std::memcpy(readBuffers[0].GetData(), blob.data(), blob.size());
+
+    SilKit::Util::SharedVector<uint8_t> receivedData;
+    EXPECT_CALL(peerListener, OnSocketData(peer.get(), _))
+        .WillOnce([&receivedData](IVAsioPeer*, SerializedMessage&& message) {
+        receivedData = message.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>().data;
+    });
+    streamListener->OnAsyncReadSomeDone(*stream, blob.size());
+
+    // the payload outlives the received message
+    ASSERT_EQ(SilKit::Util::ToStdVector(receivedData.AsSpan()), SilKit::Util::ToStdVector(msg.data.AsSpan()));
+}
+
+} // anonymous namespace
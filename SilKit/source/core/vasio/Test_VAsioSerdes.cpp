@@ -29,6 +29,21 @@ static bool operator==(const ParticipantAnnouncementReply& lhs, const Participan
     return lhs.subscribers == rhs.subscribers;
 }
 
+static bool operator==(const BulkSubscriptionAnnouncement& lhs, const BulkSubscriptionAnnouncement& rhs)
+{
+    return lhs.subscribers == rhs.subscribers;
+}
+
+static bool operator==(const SubscriptionAcknowledge& lhs, const SubscriptionAcknowledge& rhs)
+{
+    return lhs.status == rhs.status && lhs.subscriber == rhs.subscriber;
+}
+
+static bool operator==(const BulkSubscriptionAcknowledge& lhs, const BulkSubscriptionAcknowledge& rhs)
+{
+    return lhs.acknowledges == rhs.acknowledges;
+}
+
 static bool operator==(const KnownParticipants& lhs, const KnownParticipants& rhs)
 {
     return lhs.messageHeader == rhs.messageHeader && lhs.peerInfos == rhs.peerInfos;
@@ -105,6 +120,44 @@ TEST(Test_VAsioSerdes, vasio_participantAnouncementReply)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_VAsioSerdes, vasio_bulkSubscriptionAnnouncement)
+{
+    MessageBuffer buffer;
+    BulkSubscriptionAnnouncement in{}, out{};
+
+    for (auto i = 0; i < 10; i++)
+    {
+        auto subscriber = MakeSubscriber();
+        subscriber.receiverIdx = i;
+        in.subscribers.push_back(subscriber);
+    }
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in, out);
+}
+
+TEST(Test_VAsioSerdes, vasio_bulkSubscriptionAcknowledge)
+{
+    MessageBuffer buffer;
+    BulkSubscriptionAcknowledge in{}, out{};
+
+    for (auto i = 0; i < 10; i++)
+    {
+        SubscriptionAcknowledge ack;
+        ack.status = i % 2 == 0 ? SubscriptionAcknowledge::Status::Success : SubscriptionAcknowledge::Status::Failed;
+        ack.subscriber = MakeSubscriber();
+        ack.subscriber.receiverIdx = i;
+        in.acknowledges.push_back(ack);
+    }
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in, out);
+}
+
 TEST(Test_VAsioSerdes, vasio_knownParticipants)
 {
     MessageBuffer buffer;
@@ -48,6 +48,28 @@ void VAsioCapabilities::AddCapability(const std::string& name)
     UpdateCache();
 }
 
+void VAsioCapabilities::AddCapabilityValue(const std::string& name, const std::string& key, const std::string& value)
+{
+    AddCapability(name);
+    _capabilityItems.push_back({{"name", name}, {key, value}});
+}
+
+auto VAsioCapabilities::GetCapabilityValues(const std::string& name,
+                                            const std::string& key) const -> std::vector<std::string>
+{
+    std::vector<std::string> values;
+    for (const auto& item : _capabilityItems)
+    {
+        auto nameIt = item.find("name");
+        auto valueIt = item.find(key);
+        if (nameIt != item.end() && nameIt->second == name && valueIt != item.end())
+        {
+            values.push_back(valueIt->second);
+        }
+    }
+    return values;
+}
+
 auto VAsioCapabilities::ToCapabilitiesString() const -> std::string
 {
     if (_capabilities.empty())
@@ -75,6 +97,26 @@ auto VAsioCapabilities::ToCapabilitiesString() const -> std::string
         os << std::quoted(item);
         os << '}';
     }
+    // participants which do not know the additional keys only see the name of the capability again
+    for (const auto& item : _capabilityItems)
+    {
+        os << ',';
+        os << '{';
+        bool firstKey = true;
+        for (const auto& keyValue : item)
+        {
+            if (firstKey)
+            {
+                firstKey = false;
+            }
+            else
+            {
+                os << ',';
+            }
+            os << std::quoted(keyValue.first) << ':' << std::quoted(keyValue.second);
+        }
+        os << '}';
+    }
     os << ']';
 
     return os.str();
@@ -98,6 +140,10 @@ void VAsioCapabilities::Parse(const std::string& string)
             // each item must contain a name key which has a scalar value
             const auto name = item.at("name");
             AddCapability(name);
+            if (item.size() > 1)
+            {
+                _capabilityItems.push_back(std::move(item));
+            }
         }
         UpdateCache();
     }
@@ -2,8 +2,12 @@
 //
 // SPDX-License-Identifier: MIT
 
+#pragma once
+
+#include <map>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 
 namespace SilKit {
@@ -34,8 +38,17 @@ namespace Capabilities {
 const auto ProxyMessage = CapabilityLiteral{"proxy-message"};
 const auto AutonomousSynchronous = CapabilityLiteral{"autonomous-synchronous"};
 const auto RequestParticipantConnection = CapabilityLiteral{"request-participant-connection-v2"};
+const auto SharedMemory = CapabilityLiteral{"shared-memory-v1"};
+const auto BulkSubscription = CapabilityLiteral{"bulk-subscription-v1"};
+const auto CompactDiscovery = CapabilityLiteral{"compact-discovery-v1"};
+const auto LazyPeerConnections = CapabilityLiteral{"lazy-peer-connections-v1"};
 } // namespace Capabilities
 
+namespace CapabilityKeys {
+//! Key of the networks, topics and function names announced with Capabilities::LazyPeerConnections
+const auto Network = "network";
+} // namespace CapabilityKeys
+
 
 // Removed Capabilities (MUST NOT BE RE-USED):
 // - "request-participant-connection" replaced by "request-participant-connection-v2" in 4.0.39
@@ -54,6 +67,12 @@ public:
 
     void AddCapability(const std::string& name);
 
+    /// Adds the capability together with an additional key-value pair. A capability can have many values per key.
+    void AddCapabilityValue(const std::string& name, const std::string& key, const std::string& value);
+
+    /// Returns all values of the key, which were added together with the capability.
+    auto GetCapabilityValues(const std::string& name, const std::string& key) const -> std::vector<std::string>;
+
     auto ToCapabilitiesString() const -> std::string;
 
 public:
@@ -69,6 +88,8 @@ private:
 
 private:
     std::unordered_set<std::string> _capabilities;
+    /// Capability items with additional keys, including the name
+    std::vector<std::map<std::string, std::string>> _capabilityItems;
     bool _hasProxyMessageCapability{false};
     bool _hasRequestParticipantConnectionCapability{false};
 };
@@ -26,8 +26,12 @@
 #include "util/Assert.hpp"
 #include "core/vasio/TransformAcceptorUris.hpp"
 #include "util/StringHelpers.hpp"
+#include "util/Hash.hpp"
 
 #include "core/vasio/ConnectPeer.hpp"
+#include "core/internal/ServiceConfigKeys.hpp"
+#include "core/vasio/io/SharedMemoryAcceptor.hpp"
+#include "core/vasio/io/SharedMemorySegment.hpp"
 #include "core/vasio/io/util/TracingMacros.hpp"
 
 #include "asio.hpp"
@@ -138,6 +142,76 @@ auto selectBestEndpointFromResolverResults(const std::vector<asio::ip::tcp::endp
 }
 
 
+auto IsSharedMemoryEnabled(const SilKit::Config::ParticipantConfiguration& participantConfiguration) -> bool
+{
+    // the shared memory segment is set up over a local-domain connection
+    return participantConfiguration.middleware.enableSharedMemory
+           && participantConfiguration.middleware.enableDomainSockets && VSilKit::SharedMemorySegment::IsSupported();
+}
+
+//! Networks, topics and function names of the services in the configuration
+auto MakeLazyPeerNetworks(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> std::set<std::string>
+{
+    std::set<std::string> networks;
+
+    const auto addNetworks = [&networks](const auto& services, auto memberPointer) {
+        for (const auto& service : services)
+        {
+            const auto& network = service.*memberPointer;
+            if (network.has_value())
+            {
+                networks.insert(*network);
+            }
+        }
+    };
+
+    using namespace SilKit::Config;
+    addNetworks(participantConfiguration.canControllers, &CanController::network);
+    addNetworks(participantConfiguration.linControllers, &LinController::network);
+    addNetworks(participantConfiguration.ethernetControllers, &EthernetController::network);
+    addNetworks(participantConfiguration.flexrayControllers, &FlexrayController::network);
+    addNetworks(participantConfiguration.dataPublishers, &DataPublisher::topic);
+    addNetworks(participantConfiguration.dataSubscribers, &DataSubscriber::topic);
+    addNetworks(participantConfiguration.rpcServers, &RpcServer::functionName);
+    addNetworks(participantConfiguration.rpcClients, &RpcClient::functionName);
+
+    return networks;
+}
+
+//! Network, topic or function name under which a service is announced for lazy peer connections, empty if none
+auto GetLazyPeerNetwork(const SilKit::Core::ServiceDescriptor& serviceDescriptor) -> std::string
+{
+    namespace Discovery = SilKit::Core::Discovery;
+
+    std::string controllerType;
+    serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType);
+
+    std::string network;
+    if (controllerType == Discovery::controllerTypeCan || controllerType == Discovery::controllerTypeLin
+        || controllerType == Discovery::controllerTypeEthernet || controllerType == Discovery::controllerTypeFlexray)
+    {
+        network = serviceDescriptor.GetNetworkName();
+    }
+    else if (controllerType == Discovery::controllerTypeDataPublisher)
+    {
+        serviceDescriptor.GetSupplementalDataItem(Discovery::supplKeyDataPublisherTopic, network);
+    }
+    else if (controllerType == Discovery::controllerTypeDataSubscriber)
+    {
+        serviceDescriptor.GetSupplementalDataItem(Discovery::supplKeyDataSubscriberTopic, network);
+    }
+    else if (controllerType == Discovery::controllerTypeRpcServer)
+    {
+        serviceDescriptor.GetSupplementalDataItem(Discovery::supplKeyRpcServerFunctionName, network);
+    }
+    else if (controllerType == Discovery::controllerTypeRpcClient)
+    {
+        serviceDescriptor.GetSupplementalDataItem(Discovery::supplKeyRpcClientFunctionName, network);
+    }
+    return network;
+}
+
 auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
     -> SilKit::Core::VAsioCapabilities
 {
@@ -155,6 +229,24 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
         capabilities.AddCapability(SilKit::Core::Capabilities::RequestParticipantConnection);
     }
 
+    if (IsSharedMemoryEnabled(participantConfiguration))
+    {
+        capabilities.AddCapability(SilKit::Core::Capabilities::SharedMemory);
+    }
+
+    capabilities.AddCapability(SilKit::Core::Capabilities::BulkSubscription);
+    capabilities.AddCapability(SilKit::Core::Capabilities::CompactDiscovery);
+
+    if (participantConfiguration.middleware.lazyPeerConnections)
+    {
+        // the registry hands the networks to joining participants, which decide whether to connect immediately
+        for (const auto& network : MakeLazyPeerNetworks(participantConfiguration))
+        {
+            capabilities.AddCapabilityValue(SilKit::Core::Capabilities::LazyPeerConnections,
+                                            SilKit::Core::CapabilityKeys::Network, network);
+        }
+    }
+
     return capabilities;
 }
 
@@ -174,6 +266,7 @@ auto MakeAsioSocketOptionsFromConfiguration(const SilKit::Config::ParticipantCon
     socketOptions.tcp.noDelay = participantConfiguration.middleware.tcpNoDelay;
     socketOptions.tcp.sendBufferSize = participantConfiguration.middleware.tcpSendBufferSize;
     socketOptions.tcp.receiveBufferSize = participantConfiguration.middleware.tcpReceiveBufferSize;
+    socketOptions.spinWaitBudget = participantConfiguration.experimental.timeSynchronization.spinWaitBudget;
 
     return socketOptions;
 }
@@ -208,6 +301,8 @@ auto MakeConnectKnownParticipantsSettings(const SilKit::Config::ParticipantConfi
     SilKit::Core::ConnectKnownParticipantsSettings settings;
     settings.directConnectTimeout = GetConnectTimeoutSeconds(config);
     settings.remoteConnectRequestTimeout = GetConnectTimeoutSeconds(config);
+    settings.lazyPeerConnections = config.middleware.lazyPeerConnections;
+    settings.networks = MakeLazyPeerNetworks(config);
     return settings;
 }
 
@@ -235,15 +330,28 @@ VAsioConnection::VAsioConnection(IParticipantInternal* participant, IMetricsMana
     : _config{std::move(config)}
     , _participantName{std::move(participantName)}
     , _participantId{participantId}
+    , _lazyPeerNetworks{MakeLazyPeerNetworks(_config)}
     , _timeProvider{timeProvider}
     , _capabilities{MakeCapabilitiesFromConfiguration(_config)}
     , _ioContext{MakeAsioIoContext(MakeAsioSocketOptionsFromConfiguration(_config))}
+    , _ioThreadCommands{[this] { _ioContext->Post([this] { _ioThreadCommands.Drain(); }); }}
     , _connectKnownParticipants{*_ioContext, *this, *this, MakeConnectKnownParticipantsSettings(_config)}
     , _remoteConnectionManager{*this, MakeRemoteConnectionManagerSettings(_config)}
     , _version{version}
     , _metricsManager{metricsManager}
     , _participant{participant}
 {
+    if (_config.middleware.receiveThreads > 0)
+    {
+        _receiveExecutor = std::make_unique<ReceiveExecutor>(
+            static_cast<size_t>(_config.middleware.receiveThreads), "Rx " + _participantName,
+            [this](const std::exception& exception) {
+            _logger->MakeMessage(Log::Level::Error, TopicOf(*this))
+                .SetMessage("SilKit-ReceiveThread: Something went wrong")
+                .AddKeyValue(Log::Keys::exception, exception.what())
+                .Dispatch();
+        }, _config.experimental.timeSynchronization.spinWaitBudget);
+    }
 }
 
 VAsioConnection::~VAsioConnection()
@@ -423,6 +531,11 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
             }
 
             metric->Add(fmt::format("{}", uri.Path()));
+
+            if (IsSharedMemoryEnabled(_config))
+            {
+                AcceptSharedMemoryConnections(uri.Path() + SHARED_MEMORY_ACCEPTOR_SUFFIX);
+            }
         }
         else if (uri.Type() == Uri::UriType::Tcp && uri.Scheme() == "tcp")
         {
@@ -438,6 +551,37 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
     }
 }
 
+void VAsioConnection::AcceptSharedMemoryConnections(const std::string& path)
+{
+    // file must not exist before we bind/listen on it
+    (void)fs::remove(path);
+
+    try
+    {
+        auto localAcceptor{_ioContext->MakeLocalAcceptor(path)};
+        auto acceptor{std::make_unique<VSilKit::SharedMemoryAcceptor>(*_ioContext, *_logger, std::move(localAcceptor))};
+        acceptor->SetListener(*this);
+        acceptor->AsyncAccept({});
+
+        _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+            .SetMessage("SIL Kit is listening on {}", acceptor->GetLocalEndpoint())
+            .Dispatch();
+
+        {
+            std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
+            _acceptors.emplace_back(std::move(acceptor));
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        _logger->MakeMessage(Log::Level::Warn, TopicOf(*this))
+            .SetMessage("Unable to accept shared memory connections, falling back to local domain sockets")
+            .AddKeyValue(Log::Keys::uriPath, path)
+            .AddKeyValue(Log::Keys::exception, exception.what())
+            .Dispatch();
+    }
+}
+
 void VAsioConnection::JoinSimulation(std::string connectUri)
 {
     SILKIT_ASSERT(_logger);
@@ -454,7 +598,8 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
     // Wait for a fixed amount of time for the registry connection to complete.
     WaitForRegistryHandshakeToComplete(GetRegistryHandshakeTimeout(_config));
 
-    // Start connecting and initiate the handshakes with all known participants.
+    // Wait until the handshakes with all known participants are initiated. Connecting already started when the
+    // known participants were received from the registry.
     ConnectToKnownParticipants();
 
     // Wait for a fixed amount of time for all handshakes to complete.
@@ -605,6 +750,7 @@ void VAsioConnection::ConnectToKnownParticipants()
         .SetMessage("Connecting to known participants")
         .Dispatch();
 
+    // only has an effect if the registry did not send the known participants before its reply
     _connectKnownParticipants.StartConnecting();
 
     auto future{_startWaitingForParticipantHandshakes.get_future()};
@@ -781,8 +927,7 @@ void VAsioConnection::SendParticipantAnnouncementReply(IVAsioPeer* peer)
     reply.remoteHeader = MakeRegistryMsgHeader(peer->GetProtocolVersion());
     reply.status = ParticipantAnnouncementReply::Status::Success;
     // fill in the service descriptors we want to subscribe to
-    std::transform(_vasioReceivers.begin(), _vasioReceivers.end(), std::back_inserter(reply.subscribers),
-                   [](const auto& subscriber) { return subscriber->GetDescriptor(); });
+    reply.subscribers = GetSubscriptionsSupportedByPeer(peer, GetLocalSubscriptions());
 
         _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
         .SetMessage("Sending ParticipantAnnouncementReply to '{}' ('{}')",
@@ -919,6 +1064,10 @@ void VAsioConnection::ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessag
     peer->SetProtocolVersion(ExtractProtocolVersion(msg.messageHeader));
 
     _connectKnownParticipants.SetKnownParticipants(msg.peerInfos);
+
+    // The registry sends the known participants before its reply. Connecting right away overlaps the connection
+    // establishment with the remaining registry handshake.
+    _connectKnownParticipants.StartConnecting();
 }
 
 
@@ -1149,6 +1298,21 @@ void VAsioConnection::HandleConnectedPeer(IVAsioPeer* peer)
     // We connected to the other peer. tell him who we are.
     SendParticipantAnnouncement(peer);
 
+    // Subscriptions which exist already, e.g., when connecting on demand, are sent right behind the announcement
+    // instead of waiting for the reply. Older peers need the negotiated protocol version and are subscribed after it.
+    if (!_vasioReceivers.empty() && PeerSupportsBulkSubscription(peer))
+    {
+        BulkSubscriptionAnnouncement announcement;
+        announcement.subscribers = GetSubscriptionsSupportedByPeer(peer, GetLocalSubscriptions());
+
+        _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+            .SetMessage("Subscribing to {} message types from participant '{}' together with the announcement",
+                        announcement.subscribers.size(), peerInfo.participantName)
+            .Dispatch();
+
+        peer->SendSilKitMsg(SerializedMessage{announcement});
+    }
+
     // The service ID is incomplete at this stage.
     ServiceDescriptor peerId;
     peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
@@ -1352,6 +1516,79 @@ void VAsioConnection::RegisterPeerShutdownCallback(std::function<void(IVAsioPeer
         [this, callback{std::move(callback)}] { _peerShutdownCallbacks.emplace_back(std::move(callback)); });
 }
 
+void VAsioConnection::RegisterDeferredPeerConnectedCallback(std::function<void(IVAsioPeer* peer)> callback)
+{
+    ExecuteOnIoThread([this, callback{std::move(callback)}] {
+        _deferredPeerConnectedCallbacks.emplace_back(std::move(callback));
+    });
+}
+
+void VAsioConnection::StartPipelinedSubscriptions()
+{
+    _isPipeliningSubscriptions = true;
+}
+
+void VAsioConnection::WaitForPipelinedSubscriptions()
+{
+    if (!_isPipeliningSubscriptions)
+    {
+        return;
+    }
+
+    _receivedAllSubscriptionAcknowledges = std::promise<void>{};
+    auto allAcked{_receivedAllSubscriptionAcknowledges.get_future()};
+
+    // queued behind the pipelined registrations, i.e., all their subscriptions are pending or acknowledged already
+    ExecuteOnIoThread([this] {
+        _isPipeliningSubscriptions = false;
+        if (_pendingSubscriptionAcknowledges.empty())
+        {
+            SyncSubscriptionsCompleted();
+        }
+    });
+
+    _logger->MakeMessage(Log::Level::Trace, TopicOf(*this))
+        .SetMessage("SIL Kit waiting for the subscription acknowledges of all pipelined registrations")
+        .Dispatch();
+
+    allAcked.wait();
+}
+
+void VAsioConnection::ConnectPeersOnDemand(const ServiceDescriptor& serviceDescriptor)
+{
+    if (!_config.middleware.lazyPeerConnections)
+    {
+        return;
+    }
+
+    const auto network = GetLazyPeerNetwork(serviceDescriptor);
+    if (network.empty())
+    {
+        return;
+    }
+
+    if (!_lazyPeerNetworks.empty() && _lazyPeerNetworks.find(network) == _lazyPeerNetworks.end())
+    {
+        _logger->MakeMessage(Log::Level::Warn, TopicOf(*this))
+            .SetMessage("Service '{}' uses '{}', which is not configured for this participant. Participants joining "
+                        "later with lazy peer connections might not connect to this participant.",
+                        serviceDescriptor.GetServiceName(), network)
+            .Dispatch();
+    }
+
+    _connectKnownParticipants.ConnectDeferredPeers(network);
+}
+
+void VAsioConnection::ConnectPeerOnDemand(const std::string& participantName)
+{
+    if (!_config.middleware.lazyPeerConnections)
+    {
+        return;
+    }
+
+    _connectKnownParticipants.ConnectDeferredPeer(participantName);
+}
+
 void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 {
     if (!_isShuttingDown)
@@ -1448,6 +1685,10 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
         }
     }
 
+    // the receive threads may still reference the remote endpoints of the peer
+    DrainReceiveExecutor();
+    _remoteServiceEndpoints.erase(peer);
+
     auto it{
         std::find_if(_peers.begin(), _peers.end(), [needle = peer](const auto& hay) { return hay.get() == needle; })};
 
@@ -1488,6 +1729,10 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveSubscriptionAnnouncement(from, std::move(buffer));
     case VAsioMsgKind::SubscriptionAcknowledge:
         return ReceiveSubscriptionAcknowledge(from, std::move(buffer));
+    case VAsioMsgKind::BulkSubscriptionAnnouncement:
+        return ReceiveBulkSubscriptionAnnouncement(from, std::move(buffer));
+    case VAsioMsgKind::BulkSubscriptionAcknowledge:
+        return ReceiveBulkSubscriptionAcknowledge(from, std::move(buffer));
     case VAsioMsgKind::SilKitMwMsg:
         return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitSimMsg:
@@ -1611,6 +1856,30 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
 }
 
 void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
+    auto ack = AcknowledgeSubscription(from, std::move(subscriber));
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+}
+
+void VAsioConnection::ReceiveBulkSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto announcement = buffer.Deserialize<BulkSubscriptionAnnouncement>();
+
+    // all subscriptions are acknowledged at once
+    BulkSubscriptionAcknowledge bulkAck;
+    bulkAck.acknowledges.reserve(announcement.subscribers.size());
+    for (auto& subscriber : announcement.subscribers)
+    {
+        bulkAck.acknowledges.emplace_back(AcknowledgeSubscription(from, std::move(subscriber)));
+    }
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), bulkAck});
+}
+
+auto VAsioConnection::AcknowledgeSubscription(IVAsioPeer* from, VAsioMsgSubscriber subscriber)
+    -> SubscriptionAcknowledge
 {
     // Note: there may be multiple types that match the SerdesName
     // we try to find a version to match it, for backward compatibility.
@@ -1631,7 +1900,6 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         return subscriptionVersion;
     };
 
-    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
     bool wasAdded = TryAddRemoteSubscriber(from, subscriber);
 
     // check our Message version against the remote participant's version
@@ -1649,18 +1917,30 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         // Tell our peer what version of the given message type we have
         subscriber.version = myMessageVersion;
     }
-    // send acknowledge
+
     SubscriptionAcknowledge ack;
     ack.subscriber = std::move(subscriber);
     ack.status = wasAdded ? SubscriptionAcknowledge::Status::Success : SubscriptionAcknowledge::Status::Failed;
-
-    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+    return ack;
 }
 
 void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto ack = buffer.Deserialize<SubscriptionAcknowledge>();
+    HandleSubscriptionAcknowledge(from, ack);
+}
 
+void VAsioConnection::ReceiveBulkSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto bulkAck = buffer.Deserialize<BulkSubscriptionAcknowledge>();
+    for (const auto& ack : bulkAck.acknowledges)
+    {
+        HandleSubscriptionAcknowledge(from, ack);
+    }
+}
+
+void VAsioConnection::HandleSubscriptionAcknowledge(IVAsioPeer* from, const SubscriptionAcknowledge& ack)
+{
     if (ack.status != SubscriptionAcknowledge::Status::Success)
     {
         _logger->MakeMessage(Log::Level::Error, TopicOf(*this))
@@ -1673,55 +1953,163 @@ void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, Serialize
     RemovePendingSubscription({from, ack.subscriber});
 }
 
-void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ackId)
+auto VAsioConnection::PendingAcksIdentifierHash::operator()(const PendingAcksIdentifier& ackId) const -> size_t
+{
+    // the receiver index is unique per subscription of this participant
+    return static_cast<size_t>(Util::Hash::HashCombine(std::hash<IVAsioPeer*>{}(ackId.first),
+                                                       std::hash<EndpointId>{}(ackId.second.receiverIdx)));
+}
+
+void VAsioConnection::SubscribeAtPeers(const std::vector<VAsioMsgSubscriber>& subscriptions, bool useAsyncRegistration)
 {
-    auto iterPendingSync =
-        std::find(_pendingSubscriptionAcknowledges.begin(), _pendingSubscriptionAcknowledges.end(), ackId);
-    if (iterPendingSync != _pendingSubscriptionAcknowledges.end())
+    if (subscriptions.empty())
     {
-        _pendingSubscriptionAcknowledges.erase(iterPendingSync);
-        if (_pendingSubscriptionAcknowledges.empty())
+        return;
+    }
+
+    auto& pendingAcknowledges =
+        useAsyncRegistration ? _pendingAsyncSubscriptionAcknowledges : _pendingSubscriptionAcknowledges;
+
+    std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+    for (auto&& peer : _peers)
+    {
+        const auto peerSubscriptions = GetSubscriptionsSupportedByPeer(peer.get(), subscriptions);
+        for (const auto& subscriber : peerSubscriptions)
         {
-            SyncSubscriptionsCompleted();
+            pendingAcknowledges.emplace(peer.get(), subscriber);
         }
+
+        SubscribeAtPeer(peer.get(), peerSubscriptions);
     }
+}
+
+void VAsioConnection::SubscribeAtPeer(IVAsioPeer* peer, const std::vector<VAsioMsgSubscriber>& subscriptions)
+{
+    if (subscriptions.size() > 1 && PeerSupportsBulkSubscription(peer))
+    {
+        _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+            .SetMessage("Subscribing to {} message types from participant '{}'", subscriptions.size(),
+                        peer->GetInfo().participantName)
+            .Dispatch();
 
-    auto iterPendingASync =
-        std::find(_pendingAsyncSubscriptionAcknowledges.begin(), _pendingAsyncSubscriptionAcknowledges.end(), ackId);
-    if (iterPendingASync != _pendingAsyncSubscriptionAcknowledges.end())
+        BulkSubscriptionAnnouncement announcement;
+        announcement.subscribers = subscriptions;
+        peer->SendSilKitMsg(SerializedMessage{announcement});
+    }
+    else
     {
-        _pendingAsyncSubscriptionAcknowledges.erase(iterPendingASync);
-        if (_pendingAsyncSubscriptionAcknowledges.empty())
+        for (const auto& subscriber : subscriptions)
         {
-            AsyncSubscriptionsCompleted();
+            peer->Subscribe(subscriber);
         }
     }
 }
 
-void VAsioConnection::RemovePeerFromPendingAcknowledges(IVAsioPeer* peer)
+bool VAsioConnection::PeerSupportsBulkSubscription(IVAsioPeer* peer)
+{
+    auto it = _peerSupportsBulkSubscription.find(peer);
+    if (it == _peerSupportsBulkSubscription.end())
+    {
+        bool supportsBulkSubscription{false};
+        try
+        {
+            const VAsioCapabilities peerCapabilities{peer->GetInfo().capabilities};
+            supportsBulkSubscription = peerCapabilities.HasCapability(Capabilities::BulkSubscription);
+        }
+        catch (const SilKit::TypeConversionError&)
+        {
+            // peers with unparsable capabilities are subscribed to one message type at a time
+        }
+        it = _peerSupportsBulkSubscription.emplace(peer, supportsBulkSubscription).first;
+    }
+    return it->second;
+}
+
+auto VAsioConnection::GetLocalSubscriptions() const -> std::vector<VAsioMsgSubscriber>
+{
+    std::vector<VAsioMsgSubscriber> subscriptions;
+    subscriptions.reserve(_vasioReceivers.size());
+    std::transform(_vasioReceivers.begin(), _vasioReceivers.end(), std::back_inserter(subscriptions),
+                   [](const auto& subscriber) { return subscriber->GetDescriptor(); });
+    return subscriptions;
+}
+
+auto VAsioConnection::GetSubscriptionsSupportedByPeer(IVAsioPeer* peer,
+                                                      const std::vector<VAsioMsgSubscriber>& subscriptions) const
+    -> std::vector<VAsioMsgSubscriber>
 {
-    const auto belongsToPeer = [peer](const PendingAcksIdentifier& ackId) { return ackId.first == peer; };
+    // older peers do not know the compact discovery event, and would reject the subscription with an error
+    const auto compactDiscoveryName = SilKitMsgTraits<Discovery::CompactParticipantDiscoveryEvent>::SerdesName();
 
-    auto iterPendingSync = std::remove_if(_pendingSubscriptionAcknowledges.begin(),
-                                          _pendingSubscriptionAcknowledges.end(), belongsToPeer);
-    if (iterPendingSync != _pendingSubscriptionAcknowledges.end())
+    std::vector<VAsioMsgSubscriber> supportedSubscriptions;
+    supportedSubscriptions.reserve(subscriptions.size());
+    for (const auto& subscriber : subscriptions)
     {
-        _pendingSubscriptionAcknowledges.erase(iterPendingSync, _pendingSubscriptionAcknowledges.end());
-        if (_pendingSubscriptionAcknowledges.empty())
+        if (subscriber.msgTypeName == compactDiscoveryName
+            && !PeerHasCapability(peer, Capabilities::CompactDiscovery))
         {
-            SyncSubscriptionsCompleted();
+            continue;
         }
+        supportedSubscriptions.push_back(subscriber);
     }
+    return supportedSubscriptions;
+}
 
-    auto iterPendingASync = std::remove_if(_pendingAsyncSubscriptionAcknowledges.begin(),
-                                           _pendingAsyncSubscriptionAcknowledges.end(), belongsToPeer);
-    if (iterPendingASync != _pendingAsyncSubscriptionAcknowledges.end())
+bool VAsioConnection::PeerHasCapability(IVAsioPeer* peer, const std::string& capability) const
+{
+    try
+    {
+        return VAsioCapabilities{peer->GetInfo().capabilities}.HasCapability(capability);
+    }
+    catch (const SilKit::TypeConversionError&)
     {
-        _pendingAsyncSubscriptionAcknowledges.erase(iterPendingASync, _pendingAsyncSubscriptionAcknowledges.end());
-        if (_pendingAsyncSubscriptionAcknowledges.empty())
+        return false;
+    }
+}
+
+void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ackId)
+{
+    if (_pendingSubscriptionAcknowledges.erase(ackId) != 0 && _pendingSubscriptionAcknowledges.empty())
+    {
+        SyncSubscriptionsCompleted();
+    }
+
+    if (_pendingAsyncSubscriptionAcknowledges.erase(ackId) != 0 && _pendingAsyncSubscriptionAcknowledges.empty())
+    {
+        AsyncSubscriptionsCompleted();
+    }
+}
+
+void VAsioConnection::RemovePeerFromPendingAcknowledges(IVAsioPeer* peer)
+{
+    _peerSupportsBulkSubscription.erase(peer);
+
+    const auto removePeer = [peer](PendingAcks& pendingAcknowledges) {
+        bool removedAny{false};
+        for (auto it = pendingAcknowledges.begin(); it != pendingAcknowledges.end();)
         {
-            AsyncSubscriptionsCompleted();
+            if (it->first == peer)
+            {
+                it = pendingAcknowledges.erase(it);
+                removedAny = true;
+            }
+            else
+            {
+                ++it;
+            }
         }
+        return removedAny;
+    };
+
+    if (removePeer(_pendingSubscriptionAcknowledges) && _pendingSubscriptionAcknowledges.empty())
+    {
+        SyncSubscriptionsCompleted();
+    }
+
+    if (removePeer(_pendingAsyncSubscriptionAcknowledges) && _pendingAsyncSubscriptionAcknowledges.empty())
+    {
+        AsyncSubscriptionsCompleted();
     }
 }
 
@@ -1783,11 +2171,44 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
 
     auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+    const auto& remoteServiceEndpoint = GetRemoteServiceEndpoint(from, endpoint.endpoint);
+    auto* receiver = _vasioReceivers[receiverIdx].get();
+
+    const auto shard = _vasioReceiverShards[receiverIdx];
+    if (shard != ReceiveExecutor::NoShard)
+    {
+        _receiveExecutor->Post(shard, [receiver, from, &remoteServiceEndpoint, buffer = std::move(buffer)]() mutable {
+            receiver->ReceiveRawMsg(from, remoteServiceEndpoint, std::move(buffer));
+        });
+        return;
+    }
+
+    // bus messages received before, e.g., a time synchronization message must be handled before it
+    DrainReceiveExecutor();
+    receiver->ReceiveRawMsg(from, remoteServiceEndpoint, std::move(buffer));
+}
+
+void VAsioConnection::DrainReceiveExecutor()
+{
+    if (_receiveExecutor)
+    {
+        _receiveExecutor->Drain();
+    }
+}
+
+auto VAsioConnection::GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointId endpointId) -> const RemoteServiceEndpoint&
+{
+    auto& peerEndpoints = _remoteServiceEndpoints[from];
+
+    auto it = peerEndpoints.find(endpointId);
+    if (it == peerEndpoints.end())
+    {
+        ServiceDescriptor descriptor{from->GetServiceDescriptor()};
+        descriptor.SetServiceId(endpointId);
+        it = peerEndpoints.emplace(endpointId, RemoteServiceEndpoint{descriptor}).first;
+    }
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+    return it->second;
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1939,6 +2360,12 @@ auto VAsioConnection::GetParticipantNamesOfRemoteReceivers(const IServiceEndpoin
 
 void VAsioConnection::SyncSubscriptionsCompleted()
 {
+    // pipelined registrations are completed at once, when nothing is registered anymore
+    if (_isPipeliningSubscriptions)
+    {
+        return;
+    }
+
     _receivedAllSubscriptionAcknowledges.set_value();
 }
 
@@ -2015,8 +2442,9 @@ auto VAsioConnection::MakePeerInfo() -> VAsioPeerInfo
 
 auto VAsioConnection::MakeConnectPeer(const VAsioPeerInfo& peerInfo) -> std::unique_ptr<IConnectPeer>
 {
-    auto connectPeer{
-        std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo, _config.middleware.enableDomainSockets)};
+    auto connectPeer{std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo,
+                                                   _config.middleware.enableDomainSockets,
+                                                   IsSharedMemoryEnabled(_config))};
     return connectPeer;
 }
 
@@ -2142,6 +2570,36 @@ void VAsioConnection::OnConnectKnownParticipantsAllRepliesReceived(ConnectKnownP
 }
 
 
+void VAsioConnection::OnConnectKnownParticipantsDeferredPeerConnected(ConnectKnownParticipants&,
+                                                                      const std::string& participantName)
+{
+    auto* peer = FindPeerByName(_simulationName, participantName);
+    if (peer == nullptr)
+    {
+        return;
+    }
+
+    _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+        .SetMessage("Connected to '{}' on demand", participantName)
+        .Dispatch();
+
+    // the subscriptions of this participant were only announced to the peers connected at that time, peers supporting
+    // bulk subscriptions received them together with the announcement
+    if (!PeerSupportsBulkSubscription(peer))
+    {
+        const auto subscriptions = GetSubscriptionsSupportedByPeer(peer, GetLocalSubscriptions());
+
+        std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+        SubscribeAtPeer(peer, subscriptions);
+    }
+
+    for (auto&& callback : _deferredPeerConnectedCallbacks)
+    {
+        callback(peer);
+    }
+}
+
+
 void VAsioConnection::OnRemoteConnectionSuccess(std::unique_ptr<SilKit::Core::IVAsioPeer> vAsioPeer)
 {
     SILKIT_TRACE_METHOD_(_logger, "({})", vAsioPeer->GetInfo().participantName);
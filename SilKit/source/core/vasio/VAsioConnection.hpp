@@ -27,6 +27,8 @@
 #include "core/vasio/VAsioReceiver.hpp"
 #include "core/vasio/VAsioTransmitter.hpp"
 #include "core/vasio/VAsioMsgKind.hpp"
+#include "core/vasio/IoThreadCommandQueue.hpp"
+#include "core/vasio/ReceiveExecutor.hpp"
 #include "core/internal/IServiceEndpoint.hpp"
 #include "core/internal/traits/SilKitMsgTraits.hpp"
 #include "core/internal/traits/SilKitServiceTraits.hpp"
@@ -104,21 +106,26 @@ public:
     template <class SilKitServiceT>
     void RegisterSilKitService(SilKitServiceT* service)
     {
+        // pipelined registrations are acknowledged together, see WaitForPipelinedSubscriptions
+        const bool waitForAcknowledges{!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration()
+                                       && !_isPipeliningSubscriptions};
+
         std::future<void> allAcked;
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        {
+            _hasPendingAsyncSubscriptions = true;
+        }
+        else if (waitForAcknowledges)
         {
             SILKIT_ASSERT(_pendingSubscriptionAcknowledges.empty());
             _receivedAllSubscriptionAcknowledges = std::promise<void>{};
             allAcked = _receivedAllSubscriptionAcknowledges.get_future();
         }
-        else
-        {
-            _hasPendingAsyncSubscriptions = true;
-        }
 
-        _ioContext->Post([this, service]() { this->RegisterSilKitServiceImpl<SilKitServiceT>(service); });
+        // queued like the messages sent by the service, which must not overtake the registration
+        ExecuteOnIoThread([this, service]() { this->RegisterSilKitServiceImpl<SilKitServiceT>(service); });
 
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (waitForAcknowledges)
         {
 
             _logger->MakeMessage(Services::Logging::Level::Trace, TopicOf(*this))
@@ -152,14 +159,15 @@ public:
     template <typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
+        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, MakeSendTimePoint(),
+                          std::forward<SilKitMessageT>(msg));
     }
 
     template <typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, targetParticipantName,
-                          std::forward<SilKitMessageT>(msg));
+        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, MakeSendTimePoint(),
+                          targetParticipantName, std::forward<SilKitMessageT>(msg));
     }
 
     inline void OnAllMessagesDelivered(const std::function<void()>& callback)
@@ -170,7 +178,7 @@ public:
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> function)
     {
-        _ioContext->Post(std::move(function));
+        _ioThreadCommands.Push(std::move(function));
     }
 
     inline auto Config() const -> const SilKit::Config::ParticipantConfiguration&
@@ -188,12 +196,29 @@ public:
 
     // Listening Sockets (acceptors)
     void AcceptLocalConnections(const std::string& uniqueId);
+    void AcceptSharedMemoryConnections(const std::string& path);
     auto AcceptTcpConnectionsOn(const std::string& hostname, uint16_t port) -> std::pair<std::string, uint16_t>;
 
     void StartIoWorker();
 
     void RegisterPeerShutdownCallback(std::function<void(IVAsioPeer* peer)> callback);
 
+    //! \brief Synchronous service registrations no longer wait for their subscription acknowledges individually.
+    //!
+    //! The subscription handshakes of all services registered until WaitForPipelinedSubscriptions overlap, instead of
+    //! taking one round trip to the other participants per service.
+    void StartPipelinedSubscriptions();
+    //! Waits for the subscription acknowledges of all pipelined registrations, and ends the pipelining
+    void WaitForPipelinedSubscriptions();
+
+    //! Registers a callback for peers, which are connected on demand after this participant joined the simulation
+    void RegisterDeferredPeerConnectedCallback(std::function<void(IVAsioPeer* peer)> callback);
+
+    //! Connects to the deferred peers, which use the network, topic or function name of the local service
+    void ConnectPeersOnDemand(const ServiceDescriptor& serviceDescriptor);
+    //! Connects to the participant, if connecting to it was deferred
+    void ConnectPeerOnDemand(const std::string& participantName);
+
     void NotifyShutdown();
 
     void EnableAggregation();
@@ -225,6 +250,9 @@ private: // data types
     template <class MsgT>
     using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
 
+    template <class MsgT>
+    using SilKitEndpointToLinkMap = std::unordered_map<const IServiceEndpoint*, SilKitLink<MsgT>*>;
+
     using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
     using SilKitMessageTypes = std::tuple<
@@ -243,7 +271,7 @@ private: // data types
         Services::Flexray::FlexrayHostCommand, Services::Flexray::FlexrayControllerConfig,
         Services::Flexray::FlexrayTxBufferConfigUpdate, Services::Flexray::WireFlexrayTxBufferUpdate,
         Services::Flexray::FlexrayPocStatusEvent, Core::Discovery::ParticipantDiscoveryEvent,
-        Core::Discovery::ServiceDiscoveryEvent, Core::RequestReply::RequestReplyCall,
+        Core::Discovery::CompactParticipantDiscoveryEvent, Core::Discovery::ServiceDiscoveryEvent, Core::RequestReply::RequestReplyCall,
         Core::RequestReply::RequestReplyCallReturn, VSilKit::MetricsUpdate,
 
         // Private testing data types
@@ -253,8 +281,16 @@ private:
     // ----------------------------------------
     // private methods
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    //! Waits until the receive threads have dispatched all messages received so far
+    void DrainReceiveExecutor();
+    auto GetRemoteServiceEndpoint(IVAsioPeer* from, EndpointId endpointId) -> const RemoteServiceEndpoint&;
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveBulkSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveBulkSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    //! Adds the remote subscriber and returns the acknowledge to send back
+    auto AcknowledgeSubscription(IVAsioPeer* from, VAsioMsgSubscriber subscriber) -> SubscriptionAcknowledge;
+    void HandleSubscriptionAcknowledge(IVAsioPeer* from, const SubscriptionAcknowledge& ack);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
 
@@ -285,6 +321,20 @@ private:
     void AsyncSubscriptionsCompleted();
     // Unique identifier of SubscriptionAcknowledges on the subscriber
     using PendingAcksIdentifier = std::pair<IVAsioPeer*, VAsioMsgSubscriber>;
+    struct PendingAcksIdentifierHash
+    {
+        auto operator()(const PendingAcksIdentifier& ackId) const -> size_t;
+    };
+    using PendingAcks = std::unordered_set<PendingAcksIdentifier, PendingAcksIdentifierHash>;
+    //! Announces the new subscriptions to all connected peers and adds them to the pending acknowledges
+    void SubscribeAtPeers(const std::vector<VAsioMsgSubscriber>& subscriptions, bool useAsyncRegistration);
+    void SubscribeAtPeer(IVAsioPeer* peer, const std::vector<VAsioMsgSubscriber>& subscriptions);
+    bool PeerSupportsBulkSubscription(IVAsioPeer* peer);
+    auto GetLocalSubscriptions() const -> std::vector<VAsioMsgSubscriber>;
+    //! Returns the subscriptions without the message types the peer does not know, based on its capabilities
+    auto GetSubscriptionsSupportedByPeer(IVAsioPeer* peer, const std::vector<VAsioMsgSubscriber>& subscriptions) const
+        -> std::vector<VAsioMsgSubscriber>;
+    bool PeerHasCapability(IVAsioPeer* peer, const std::string& capability) const;
     void RemovePendingSubscription(const PendingAcksIdentifier& ackId);
     // Drop all pending acknowledges belonging to a peer that is going away, so the
     // pending lists can complete even though the peer will never acknowledge them.
@@ -303,18 +353,42 @@ private:
         if (!link)
         {
             link = std::make_shared<SilKitLink<SilKitMessageT>>(networkName, _logger, _timeProvider);
+
+            if (_config.experimental.metrics.collectLinkLatency)
+            {
+                link->SetSendLatencyMetric(_metricsManager->GetHistogram(
+                    {"Link", networkName, SilKitLink<SilKitMessageT>::MsgTypeName(), "send_latency", "[ns]"}));
+            }
+
+            if (_receiveExecutor && SilKitMsgTraits<SilKitMessageT>::IsDispatchedOnReceiveThread())
+            {
+                link->SetReceiveExecutor(_receiveExecutor.get(), _receiveExecutor->GetShard(networkName));
+            }
         }
         return link;
     }
 
     template <class SilKitMessageT, class SilKitServiceT>
     void RegisterSilKitMsgReceiver(IMessageReceiver<SilKitMessageT>* receiver)
+    {
+        std::vector<VAsioMsgSubscriber> newSubscriptions;
+        AddSilKitMsgReceiver<SilKitMessageT>(receiver, newSubscriptions);
+        SubscribeAtPeers(newSubscriptions, SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration());
+    }
+
+    //! Adds the receiver to its link. If no receiver of the message type exists on the network yet, the subscription
+    //! which has to be announced to the other peers is appended to newSubscriptions.
+    template <class SilKitMessageT>
+    void AddSilKitMsgReceiver(IMessageReceiver<SilKitMessageT>* receiver,
+                              std::vector<VAsioMsgSubscriber>& newSubscriptions)
     {
         SILKIT_ASSERT(_logger);
         auto&& serviceDescriptor = GetServiceDescriptor(receiver);
         auto&& networkName = serviceDescriptor.GetNetworkName();
 
         auto link = GetLinkByName<SilKitMessageT>(networkName);
+        // the receive threads must not dispatch messages while the receivers of the link change
+        DrainReceiveExecutor();
         link->AddLocalReceiver(receiver);
 
         std::string msgSerdesName = SilKitMsgTraits<SilKitMessageT>::SerdesName();
@@ -337,35 +411,64 @@ private:
             // copy the Service Endpoint Id
             serviceEndpointPtr->SetServiceDescriptor(tmpServiceDescriptor);
             _vasioReceivers.emplace_back(std::move(rawReceiver));
+            _vasioReceiverShards.emplace_back(
+                _receiveExecutor && SilKitMsgTraits<SilKitMessageT>::IsDispatchedOnReceiveThread()
+                    ? _receiveExecutor->GetShard(networkName)
+                    : ReceiveExecutor::NoShard);
 
-            {
-                std::unique_lock<decltype(_peersLock)> lock{_peersLock};
-
-                for (auto&& peer : _peers)
-                {
-                    // Add pending subscriptions
-                    PendingAcksIdentifier ackPair{peer.get(), subscriptionInfo};
-                    if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
-                    {
-                        _pendingSubscriptionAcknowledges.emplace_back(ackPair);
-                    }
-                    else
-                    {
-                        _pendingAsyncSubscriptionAcknowledges.emplace_back(ackPair);
-                    }
-
-                    peer->Subscribe(subscriptionInfo);
-                }
-            }
+            newSubscriptions.emplace_back(std::move(subscriptionInfo));
         }
     }
 
     template <class SilKitMessageT>
-    void RegisterSilKitMsgSender(const std::string& networkName)
+    void RegisterSilKitMsgSender(const IServiceEndpoint* sender)
     {
+        auto&& networkName = sender->GetServiceDescriptor().GetNetworkName();
+
         auto link = GetLinkByName<SilKitMessageT>(networkName);
         auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
         serviceLinkMap[networkName] = link;
+
+        // the links are never removed, the sender can keep using the raw pointer
+        auto&& endpointLinkMap = std::get<SilKitEndpointToLinkMap<SilKitMessageT>>(_endpointToLinkMap);
+        endpointLinkMap[sender] = link.get();
+    }
+
+    //! \brief Returns the link a registered sender sends the given message type on, or nullptr.
+    //!
+    //! Registering a sender always creates its link, so a missing link means that neither the endpoint nor any other
+    //! endpoint on its network was registered as a sender of the message type. This is only known when it sends.
+    template <class SilKitMessageT>
+    auto GetSenderLink(const IServiceEndpoint* from) -> SilKitLink<SilKitMessageT>*
+    {
+        auto&& endpointLinkMap = std::get<SilKitEndpointToLinkMap<SilKitMessageT>>(_endpointToLinkMap);
+        auto endpointIt = endpointLinkMap.find(from);
+        if (endpointIt != endpointLinkMap.end())
+        {
+            return endpointIt->second;
+        }
+
+        // endpoints which were not registered as senders themselves share the link of their network
+        auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
+        auto linkIt = serviceLinkMap.find(from->GetServiceDescriptor().GetNetworkName());
+        if (linkIt != serviceLinkMap.end())
+        {
+            return linkIt->second.get();
+        }
+
+        return nullptr;
+    }
+
+    template <class SilKitMessageT>
+    auto MakeMissingSenderLinkMessage(const IServiceEndpoint* from) const -> std::string
+    {
+        const auto& serviceDescriptor = from->GetServiceDescriptor();
+        std::stringstream ss;
+        ss << "Cannot send " << std::quoted(SilKitMsgTraits<SilKitMessageT>::TypeName()) << " from service "
+           << std::quoted(serviceDescriptor.GetServiceName()) << " on the network "
+           << std::quoted(serviceDescriptor.GetNetworkName())
+           << ", because no service on this network was registered as a sender of this message type";
+        return ss.str();
     }
 
     template <class SilKitServiceT>
@@ -374,14 +477,17 @@ private:
         typename SilKitServiceT::SilKitReceiveMessagesTypes receiveMessageTypes{};
         typename SilKitServiceT::SilKitSendMessagesTypes sendMessageTypes{};
 
-        Util::tuple_tools::for_each(receiveMessageTypes, [this, service](auto&& message) {
+        // the subscriptions of all message types are announced together, in one message per peer if supported
+        std::vector<VAsioMsgSubscriber> newSubscriptions;
+        Util::tuple_tools::for_each(receiveMessageTypes, [this, service, &newSubscriptions](auto&& message) {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgReceiver<SilKitMessageT, SilKitServiceT>(service);
+            this->AddSilKitMsgReceiver<SilKitMessageT>(service, newSubscriptions);
         });
+        SubscribeAtPeers(newSubscriptions, SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration());
 
         Util::tuple_tools::for_each(sendMessageTypes, [this, service](auto&& message) {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service).GetNetworkName());
+            this->RegisterSilKitMsgSender<SilKitMessageT>(dynamic_cast<const IServiceEndpoint*>(service));
         });
 
         // We could have registered a receiver that only uses already acknowledged senders, thus no new handshake is
@@ -402,23 +508,31 @@ private:
         }
     }
 
-    template <class SilKitMessageT>
-    void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
+    //! \brief Returns the time of the send call if the link latency is collected, the epoch otherwise.
+    auto MakeSendTimePoint() const -> std::chrono::steady_clock::time_point
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
+        if (_config.experimental.metrics.collectLinkLatency)
+        {
+            return std::chrono::steady_clock::now();
+        }
+        return {};
+    }
 
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+    template <class SilKitMessageT>
+    void SendMsgImpl(const IServiceEndpoint* from, std::chrono::steady_clock::time_point sendTime,
+                     SilKitMessageT&& msg)
+    {
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from);
+        if (link == nullptr)
         {
-            throw SilKitError{"SendMsgImpl: sending on empty link for " + key};
+            throw SilKitError{MakeMissingSenderLinkMessage<std::decay_t<SilKitMessageT>>(from)};
         }
-        auto&& link = linkMap[key];
-        link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg));
+        link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg), sendTime);
     }
 
     template <class SilKitMessageT>
-    void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
-                             SilKitMessageT&& msg)
+    void SendMsgToTargetImpl(const IServiceEndpoint* from, std::chrono::steady_clock::time_point sendTime,
+                             const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
         using MsgT = std::decay_t<SilKitMessageT>;
         const auto& key = from->GetServiceDescriptor().GetNetworkName();
@@ -432,23 +546,27 @@ private:
             throw SilKitError{ss.str()};
         }
 
-        auto& linkMap = std::get<SilKitServiceToLinkMap<MsgT>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+        auto* link = GetSenderLink<MsgT>(from);
+        if (link == nullptr)
         {
-            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for " + key};
+            throw SilKitError{MakeMissingSenderLinkMessage<MsgT>(from)};
         }
-        auto&& link = linkMap[key];
-        link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg), sendTime);
     }
 
     template <typename... MethodArgs, typename... Args>
     inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
     {
-        _ioContext->Post([=]() mutable { (this->*method)(std::move(args)...); });
+        // rvalue arguments (e.g., the message) are moved into the command
+        _ioThreadCommands.Push(
+            [this, method, arguments = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+            std::apply([this, method](auto&&... values) { (this->*method)(std::move(values)...); },
+                       std::move(arguments));
+        });
     }
     inline void ExecuteOnIoThread(std::function<void()> function)
     {
-        _ioContext->Post(std::move(function));
+        _ioThreadCommands.Push(std::move(function));
     }
 
     template <class SilKitServiceT>
@@ -481,6 +599,8 @@ private: // IConnectionManagerListener
     void OnConnectKnownParticipantsFailure(ConnectKnownParticipants&) override;
     void OnConnectKnownParticipantsWaitingForAllReplies(ConnectKnownParticipants&) override;
     void OnConnectKnownParticipantsAllRepliesReceived(ConnectKnownParticipants&) override;
+    void OnConnectKnownParticipantsDeferredPeerConnected(ConnectKnownParticipants&,
+                                                         const std::string& participantName) override;
 
 private:
     void OnRemoteConnectionSuccess(std::unique_ptr<SilKit::Core::IVAsioPeer> vAsioPeer);
@@ -492,6 +612,8 @@ private:
     SilKit::Config::ParticipantConfiguration _config;
     std::string _participantName;
     ParticipantId _participantId{0};
+    //! \brief Networks, topics and function names of the configured services, announced for lazy peer connections.
+    std::set<std::string> _lazyPeerNetworks;
     Services::Logging::ILoggerInternal* _logger{nullptr};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
 
@@ -504,13 +626,21 @@ private:
     Util::tuple_tools::wrapped_tuple<SilKitLinkMap, SilKitMessageTypes> _links;
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
+    //! \brief Links of the registered senders, resolved once during registration. Only accessed on the IO thread.
+    Util::tuple_tools::wrapped_tuple<SilKitEndpointToLinkMap, SilKitMessageTypes> _endpointToLinkMap;
 
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    //! \brief Shard of the receive executor for each receiver, or ReceiveExecutor::NoShard for the IO thread.
+    std::vector<size_t> _vasioReceiverShards;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
 
+    //! \brief Descriptors of the remote senders by peer and endpoint id, only accessed on the IO thread.
+    std::unordered_map<IVAsioPeer*, std::unordered_map<EndpointId, RemoteServiceEndpoint>> _remoteServiceEndpoints;
+
     std::mutex _participantAnnouncementReceiversMutex;
     std::vector<ParticipantAnnouncementReceiver> _participantAnnouncementReceivers;
     std::vector<std::function<void(IVAsioPeer*)>> _peerShutdownCallbacks;
+    std::vector<std::function<void(IVAsioPeer*)>> _deferredPeerConnectedCallbacks;
 
     VAsioCapabilities _capabilities;
 
@@ -518,6 +648,8 @@ private:
     std::mutex _peersLock;
 
     std::unique_ptr<IIoContext> _ioContext;
+    //! Commands posted by user threads (e.g., sending messages), executed in batches on the IO thread
+    IoThreadCommandQueue _ioThreadCommands;
 
     std::unique_ptr<IVAsioPeer> _registry{nullptr};
     std::vector<std::unique_ptr<IVAsioPeer>> _peers;
@@ -542,13 +674,21 @@ private:
     mutable std::mutex _mutex;
 
     // Keep track of the sent Subscriptions when Registering an SIL Kit Service
-    std::vector<PendingAcksIdentifier> _pendingSubscriptionAcknowledges;
+    PendingAcks _pendingSubscriptionAcknowledges;
     std::promise<void> _receivedAllSubscriptionAcknowledges;
 
     // Subscriptions for internal services that use async registration
-    std::vector<PendingAcksIdentifier> _pendingAsyncSubscriptionAcknowledges;
+    PendingAcks _pendingAsyncSubscriptionAcknowledges;
+    // Whether a peer understands the BulkSubscriptionAnnouncement, cached to parse its capabilities only once
+    std::unordered_map<IVAsioPeer*, bool> _peerSupportsBulkSubscription;
     Util::SynchronizedHandlers<std::function<void()>> _asyncSubscriptionsCompletionHandlers;
     std::atomic<bool> _hasPendingAsyncSubscriptions{false};
+    // Synchronous registrations do not wait for their acknowledges, and complete them only in
+    // WaitForPipelinedSubscriptions
+    std::atomic<bool> _isPipeliningSubscriptions{false};
+
+    //! Dispatches received bus messages if Middleware.ReceiveThreads is set, stopped before the links are destroyed
+    std::unique_ptr<ReceiveExecutor> _receiveExecutor;
 
     // The worker thread should be the last members in this class. This ensures
     // that no callback is destroyed before the thread finishes.
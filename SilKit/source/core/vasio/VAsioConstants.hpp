@@ -11,6 +11,9 @@ namespace VSilKit {
 constexpr const SilKit::Core::ParticipantId REGISTRY_PARTICIPANT_ID{0};
 constexpr const char* REGISTRY_PARTICIPANT_NAME{"SilKitRegistry"};
 
+//! Appended to the path of a local-domain acceptor to obtain the path of the matching shared memory acceptor.
+constexpr const char* SHARED_MEMORY_ACCEPTOR_SUFFIX{".shm"};
+
 } // namespace VSilKit
 
 
@@ -19,6 +22,7 @@ namespace Core {
 
 using VSilKit::REGISTRY_PARTICIPANT_ID;
 using VSilKit::REGISTRY_PARTICIPANT_NAME;
+using VSilKit::SHARED_MEMORY_ACCEPTOR_SUFFIX;
 
 } // namespace Core
 } // namespace SilKit
\ No newline at end of file
@@ -53,6 +53,18 @@ struct SubscriptionAcknowledge
     VAsioMsgSubscriber subscriber;
 };
 
+//! All subscriptions of a service registration in one message, for peers with the "bulk-subscription-v1" capability
+struct BulkSubscriptionAnnouncement
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+};
+
+//! Answers a BulkSubscriptionAnnouncement with one acknowledge per subscriber
+struct BulkSubscriptionAcknowledge
+{
+    std::vector<SubscriptionAcknowledge> acknowledges;
+};
+
 struct ParticipantAnnouncement
 {
     RegistryMsgHeader messageHeader;
@@ -17,6 +17,8 @@ enum class VAsioMsgKind : uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    BulkSubscriptionAnnouncement = 7, // with "bulk-subscription-v1" capability
+    BulkSubscriptionAcknowledge = 8, // with "bulk-subscription-v1" capability
 };
 
 } // namespace Core
@@ -10,6 +10,7 @@
 
 #include "services/logging/LoggerMessage.hpp"
 #include "core/vasio/VAsioMsgKind.hpp"
+#include "core/vasio/SendBufferPool.hpp"
 #include "core/vasio/VAsioConnection.hpp"
 #include "util/Uri.hpp"
 #include "util/Assert.hpp"
@@ -37,6 +38,7 @@ VAsioPeer::VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::u
     , _socket{std::move(stream)}
     , _logger{logger}
     , _msgBuffer{4096}
+    , _framePool{64, 64 * 1024}
     , _peerMetrics{std::move(peerMetrics)}
 {
     _socket->SetListener(*this);
@@ -108,10 +110,12 @@ void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
     if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::UserDataMessage)
     {
         Aggregate(blob);
+        SendBufferPool::Release(std::move(blob));
     }
     else if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::FlushAggregationMessage)
     {
         Aggregate(blob); // don't forget to send (current) time sync message
+        SendBufferPool::Release(std::move(blob));
         Flush();
     }
     else
@@ -184,17 +188,31 @@ void VAsioPeer::StartAsyncWrite()
 
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
+    // drain as many queued messages as the limits allow, they are sent using a single gather write
+    size_t numberOfBytes{0};
+    _currentSendingBufferData.clear();
+    _currentSendingBufferIndex = 0;
+    do
+    {
+        numberOfBytes += _sendingQueue.front().size();
+        _currentSendingBufferData.emplace_back(std::move(_sendingQueue.front()));
+        _sendingQueue.pop_front();
+    } while (!_sendingQueue.empty() && _currentSendingBufferData.size() < _gatherWriteMaxBuffers
+             && numberOfBytes + _sendingQueue.front().size() <= _gatherWriteMaxBytes);
     lock.unlock();
 
-    _currentSendingBuffer = ConstBuffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
+    _currentSendingBuffers.clear();
+    for (const auto& data : _currentSendingBufferData)
+    {
+        _currentSendingBuffers.emplace_back(data.data(), data.size());
+    }
     WriteSomeAsync();
 }
 
 void VAsioPeer::WriteSomeAsync()
 {
-    _socket->AsyncWriteSome(ConstBufferSequence{&_currentSendingBuffer, 1});
+    _socket->AsyncWriteSome(ConstBufferSequence{_currentSendingBuffers.data() + _currentSendingBufferIndex,
+                                                _currentSendingBuffers.size() - _currentSendingBufferIndex});
 }
 
 void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
@@ -275,8 +293,8 @@ void VAsioPeer::DispatchBuffer()
         }
         else
         {
-            std::vector<uint8_t> currentMsg(_currentMsgSize);
-            if (!_msgBuffer.Read(currentMsg))
+            auto currentMsg = _framePool.Acquire(_currentMsgSize);
+            if (!_msgBuffer.Read(*currentMsg))
             {
                 throw SilKitError("Reading data from ring buffer failed.");
             }
@@ -313,13 +331,35 @@ void VAsioPeer::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransfe
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    if (bytesTransferred < _currentSendingBuffer.GetSize())
+    // skip the completely written buffers and slice off the written prefix of a partially written one
+    while (_currentSendingBufferIndex < _currentSendingBuffers.size() && bytesTransferred > 0)
+    {
+        auto& buffer = _currentSendingBuffers[_currentSendingBufferIndex];
+        if (bytesTransferred < buffer.GetSize())
+        {
+            buffer.SliceOff(bytesTransferred);
+            bytesTransferred = 0;
+        }
+        else
+        {
+            bytesTransferred -= buffer.GetSize();
+            ++_currentSendingBufferIndex;
+        }
+    }
+
+    if (_currentSendingBufferIndex < _currentSendingBuffers.size())
     {
-        _currentSendingBuffer.SliceOff(bytesTransferred);
         WriteSomeAsync();
         return;
     }
 
+    // the written buffers are reused for serializing the next messages
+    for (auto& data : _currentSendingBufferData)
+    {
+        SendBufferPool::Release(std::move(data));
+    }
+    _currentSendingBufferData.clear();
+
     _sending = false;
     StartAsyncWrite();
 }
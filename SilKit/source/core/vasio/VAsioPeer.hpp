@@ -16,6 +16,7 @@
 #include "core/internal/EndpointAddress.hpp"
 #include "core/internal/MessageBuffer.hpp"
 #include "core/vasio/RingBuffer.hpp"
+#include "core/vasio/MessageFramePool.hpp"
 #include "core/vasio/VAsioPeerInfo.hpp"
 #include "core/internal/ProtocolVersion.hpp"
 
@@ -118,13 +119,16 @@ private:
     // receiving
     std::atomic<uint32_t> _currentMsgSize{0u};
     RingBuffer _msgBuffer;
+    MessageFramePool _framePool;
     std::vector<MutableBuffer> _currentReceivingBuffers;
 
     // sending
     mutable std::mutex _sendingQueueMutex;
     std::deque<std::vector<uint8_t>> _sendingQueue;
-    ConstBuffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
+    // the queued messages currently in flight, written by a single gather write (writev)
+    std::vector<ConstBuffer> _currentSendingBuffers;
+    std::vector<std::vector<uint8_t>> _currentSendingBufferData;
+    size_t _currentSendingBufferIndex{0};
     std::vector<uint8_t> _aggregatedMessages;
 
     std::atomic_bool _sending{false};
@@ -133,6 +137,10 @@ private:
     bool _useAggregation{false};
     const size_t _aggregationBufferThreshold{100 * 1000};
 
+    // limits for coalescing queued messages into a single gather write
+    const size_t _gatherWriteMaxBuffers{64};
+    const size_t _gatherWriteMaxBytes{256 * 1024};
+
     // we trigger a flush of aggregated messages, if too much time has passed since the last flush
     std::unique_ptr<ITimer> _flushTimer;
     const std::chrono::milliseconds _flushTimeout{50};
@@ -46,7 +46,8 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const RemoteServiceEndpoint& remoteEndpoint,
+                               SerializedMessage&& buffer) = 0;
 };
 
 template <class MsgT>
@@ -65,7 +66,8 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const RemoteServiceEndpoint& remoteEndpoint,
+                       SerializedMessage&& buffer) override;
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -81,6 +83,7 @@ private:
     VAsioMsgSubscriber _subscriptionInfo;
     std::shared_ptr<SilKitLink<MsgT>> _link;
     Services::Logging::ILoggerInternal* _logger;
+    bool _isMessageTracingEnabled;
     ServiceDescriptor _serviceDescriptor;
 };
 
@@ -93,6 +96,7 @@ VAsioReceiver<MsgT>::VAsioReceiver(VAsioMsgSubscriber subscriberInfo, std::share
     : _subscriptionInfo{std::move(subscriberInfo)}
     , _link{link}
     , _logger{logger}
+    , _isMessageTracingEnabled{Services::IsMessageTracingEnabled(logger)}
 {
     _serviceDescriptor.SetNetworkName(_subscriptionInfo.networkName);
 }
@@ -104,15 +108,17 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor,
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const RemoteServiceEndpoint& remoteEndpoint,
                                         SerializedMessage&& buffer)
 {
     MsgT msg = buffer.Deserialize<MsgT>();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
+    if (_isMessageTracingEnabled)
+    {
+        Services::TraceRx(_logger, this, msg, remoteEndpoint.GetServiceDescriptor());
+    }
 
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    _link->DistributeRemoteSilKitMessage(&remoteEndpoint, std::move(msg));
 }
 
 } // namespace Core
@@ -64,6 +64,30 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledge&
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const BulkSubscriptionAnnouncement& announcement)
+{
+    buffer << announcement.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, BulkSubscriptionAnnouncement& announcement)
+{
+    buffer >> announcement.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const BulkSubscriptionAcknowledge& ack)
+{
+    buffer << ack.acknowledges;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, BulkSubscriptionAcknowledge& ack)
+{
+    buffer >> ack.acknowledges;
+    return buffer;
+}
+
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const ParticipantAnnouncement& announcement)
 {
     // ParticipantAnnouncement is the first message sent during a handshake.
@@ -339,6 +363,24 @@ void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledge& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const BulkSubscriptionAnnouncement& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, BulkSubscriptionAnnouncement& out)
+{
+    buffer >> out;
+}
+
+void Serialize(MessageBuffer& buffer, const BulkSubscriptionAcknowledge& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, BulkSubscriptionAcknowledge& out)
+{
+    buffer >> out;
+}
+
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg)
 {
     buffer << msg;
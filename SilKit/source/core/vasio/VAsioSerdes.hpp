@@ -35,6 +35,8 @@ void Serialize(MessageBuffer& buffer, const ParticipantAnnouncement& announcemen
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& reply);
 void Serialize(MessageBuffer& buffer, const VAsioMsgSubscriber& subscriber);
 void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledge& msg);
+void Serialize(MessageBuffer& buffer, const BulkSubscriptionAnnouncement& msg);
+void Serialize(MessageBuffer& buffer, const BulkSubscriptionAcknowledge& msg);
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg);
 void Serialize(MessageBuffer& buffer, const ProxyMessage& msg);
 void Serialize(MessageBuffer& buffer, const RemoteParticipantConnectRequest& msg);
@@ -43,6 +45,8 @@ void Deserialize(MessageBuffer& buffer, ParticipantAnnouncement& out);
 void Deserialize(MessageBuffer& buffer, ParticipantAnnouncementReply& out);
 void Deserialize(MessageBuffer&, VAsioMsgSubscriber&);
 void Deserialize(MessageBuffer&, SubscriptionAcknowledge&);
+void Deserialize(MessageBuffer&, BulkSubscriptionAnnouncement&);
+void Deserialize(MessageBuffer&, BulkSubscriptionAcknowledge&);
 void Deserialize(MessageBuffer& buffer, KnownParticipants& out);
 void Deserialize(MessageBuffer& buffer, ProxyMessage& out);
 void Deserialize(MessageBuffer& buffer, RemoteParticipantConnectRequest& out);
@@ -165,11 +165,24 @@ public:
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
-        for (auto& receiver : _remoteReceivers)
+        if (_remoteReceivers.empty())
+            return;
+
+        // Serialize only once: the messages for the individual receivers only differ in the remote index header field
+        auto buffer =
+            SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), _remoteReceivers.front().remoteIdx);
+        const auto lastIndex = _remoteReceivers.size() - 1;
+        for (size_t i = 0; i < lastIndex; ++i)
         {
-            auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
-            receiver.peer->SendSilKitMsg(std::move(buffer));
+            auto& receiver = _remoteReceivers[i];
+            SerializedMessage receiverBuffer{buffer, SendBufferPool::Acquire(buffer.GetStorageSize())};
+            receiverBuffer.SetRemoteIndex(receiver.remoteIdx);
+            receiver.peer->SendSilKitMsg(std::move(receiverBuffer));
         }
+
+        auto& lastReceiver = _remoteReceivers[lastIndex];
+        buffer.SetRemoteIndex(lastReceiver.remoteIdx);
+        lastReceiver.peer->SendSilKitMsg(std::move(buffer));
     }
 
     // IServiceEndpoint
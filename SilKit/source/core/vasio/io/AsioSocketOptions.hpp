@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <chrono>
+
 
 namespace VSilKit {
 
@@ -17,6 +19,9 @@ struct AsioSocketOptions
         int receiveBufferSize{-1};
         int sendBufferSize{-1};
     } tcp;
+
+    //! Duration for which the IO thread busy-polls the sockets before it blocks waiting for them (zero blocks)
+    std::chrono::microseconds spinWaitBudget{0};
 };
 
 
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryAcceptor.hpp"
+
+#include "core/vasio/io/util/TracingMacros.hpp"
+
+#include <algorithm>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryAcceptor
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+SharedMemoryAcceptor::SharedMemoryAcceptor(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                                           std::unique_ptr<IAcceptor> acceptor)
+    : _ioContext{&ioContext}
+    , _logger{&logger}
+    , _acceptor{std::move(acceptor)}
+{
+    _acceptor->SetListener(*this);
+}
+
+
+SharedMemoryAcceptor::~SharedMemoryAcceptor()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryAcceptor::SetListener(IAcceptorListener& listener)
+{
+    _listener = &listener;
+}
+
+
+auto SharedMemoryAcceptor::GetLocalEndpoint() const -> std::string
+{
+    // the endpoint must not be mistaken for a regular local-domain acceptor
+    auto endpoint{_acceptor->GetLocalEndpoint()};
+
+    const std::string localScheme{"local://"};
+    if (endpoint.compare(0, localScheme.size(), localScheme) == 0)
+    {
+        endpoint.replace(0, localScheme.size(), "shm://");
+    }
+
+    return endpoint;
+}
+
+
+void SharedMemoryAcceptor::AsyncAccept(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}ms)", timeout.count());
+
+    _timeout = timeout;
+
+    // the underlying acceptor is re-armed after every accepted connection
+    if (_accepting)
+    {
+        return;
+    }
+
+    _accepting = true;
+    _acceptor->AsyncAccept(timeout);
+}
+
+
+void SharedMemoryAcceptor::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    for (const auto& handshake : _handshakes)
+    {
+        handshake->Shutdown();
+    }
+
+    _acceptor->Shutdown();
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
+
+    _accepting = false;
+
+    auto handshake{std::make_unique<SharedMemoryHandshake>(*_ioContext, *_logger, std::move(stream),
+                                                           SharedMemoryRole::Acceptor)};
+    handshake->SetListener(*this);
+    handshake->Start(HandshakeTimeout);
+    _handshakes.emplace_back(std::move(handshake));
+
+    AsyncAccept(_timeout);
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptFailure(IAcceptor&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _accepting = false;
+    _listener->OnAsyncAcceptFailure(*this);
+}
+
+
+void SharedMemoryAcceptor::OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                                          std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
+
+    RemoveHandshake(handshake);
+    _listener->OnAsyncAcceptSuccess(*this, std::move(stream));
+}
+
+
+void SharedMemoryAcceptor::OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    // a failed handshake only affects the single connection, the other side falls back to other acceptors
+    RemoveHandshake(handshake);
+}
+
+
+void SharedMemoryAcceptor::RemoveHandshake(SharedMemoryHandshake& handshake)
+{
+    auto it{std::find_if(_handshakes.begin(), _handshakes.end(),
+                         [needle = &handshake](const auto& hay) { return hay.get() == needle; })};
+
+    if (it != _handshakes.end())
+    {
+        _handshakes.erase(it);
+    }
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
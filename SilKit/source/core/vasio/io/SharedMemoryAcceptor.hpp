@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "core/vasio/io/IAcceptor.hpp"
+#include "core/vasio/io/IIoContext.hpp"
+#include "core/vasio/io/SharedMemoryHandshake.hpp"
+
+#include "services/logging/LoggerMessage.hpp"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+/// Accepts local-domain connections and sets up the shared memory segment offered by the connecting side.
+///
+/// The handshakes of multiple connections may be in progress at the same time. The acceptor keeps accepting until it
+/// is shut down or the underlying acceptor fails.
+class SharedMemoryAcceptor final
+    : public IAcceptor
+    , private IAcceptorListener
+    , private ISharedMemoryHandshakeListener
+{
+    IIoContext* _ioContext{nullptr};
+    SilKit::Services::Logging::ILoggerInternal* _logger{nullptr};
+    IAcceptorListener* _listener{nullptr};
+
+    std::unique_ptr<IAcceptor> _acceptor;
+    std::vector<std::unique_ptr<SharedMemoryHandshake>> _handshakes;
+    std::chrono::milliseconds _timeout{};
+    bool _accepting{false};
+
+public:
+    /// Timeout of a single handshake, the shared memory setup is purely local.
+    static constexpr std::chrono::milliseconds HandshakeTimeout{5000};
+
+public:
+    SharedMemoryAcceptor(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                         std::unique_ptr<IAcceptor> acceptor);
+    ~SharedMemoryAcceptor() override;
+
+public: // IAcceptor
+    void SetListener(IAcceptorListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    void AsyncAccept(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IAcceptorListener
+    void OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncAcceptFailure(IAcceptor& acceptor) override;
+
+private: // ISharedMemoryHandshakeListener
+    void OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                        std::unique_ptr<IRawByteStream> stream) override;
+    void OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake) override;
+
+private:
+    void RemoveHandshake(SharedMemoryHandshake& handshake);
+};
+
+
+} // namespace VSilKit
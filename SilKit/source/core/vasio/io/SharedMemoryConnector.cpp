@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryConnector.hpp"
+
+#include "core/vasio/io/util/TracingMacros.hpp"
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryConnector
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace VSilKit {
+
+
+SharedMemoryConnector::SharedMemoryConnector(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                                             std::unique_ptr<IConnector> connector)
+    : _ioContext{&ioContext}
+    , _logger{&logger}
+    , _connector{std::move(connector)}
+{
+    _connector->SetListener(*this);
+}
+
+
+SharedMemoryConnector::~SharedMemoryConnector()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryConnector::SetListener(IConnectorListener& listener)
+{
+    _listener = &listener;
+}
+
+
+void SharedMemoryConnector::AsyncConnect(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}ms)", timeout.count());
+
+    _timeout = timeout;
+    _connector->AsyncConnect(timeout);
+}
+
+
+void SharedMemoryConnector::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    if (_handshake)
+    {
+        _handshake->Shutdown();
+        return;
+    }
+
+    _connector->Shutdown();
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
+
+    _handshake = std::make_unique<SharedMemoryHandshake>(*_ioContext, *_logger, std::move(stream),
+                                                         SharedMemoryRole::Connector);
+    _handshake->SetListener(*this);
+    _handshake->Start(_timeout);
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectFailure(IConnector&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+void SharedMemoryConnector::OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake&,
+                                                           std::unique_ptr<IRawByteStream> stream)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", static_cast<const void*>(stream.get()));
+
+    _handshake.reset();
+    _listener->OnAsyncConnectSuccess(*this, std::move(stream));
+}
+
+
+void SharedMemoryConnector::OnSharedMemoryHandshakeFailure(SharedMemoryHandshake&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _handshake.reset();
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "core/vasio/io/IConnector.hpp"
+#include "core/vasio/io/IIoContext.hpp"
+#include "core/vasio/io/SharedMemoryHandshake.hpp"
+
+#include "services/logging/LoggerMessage.hpp"
+
+#include <chrono>
+#include <memory>
+
+
+namespace VSilKit {
+
+
+/// Connects via a local-domain socket and sets up a shared memory segment over the new connection.
+class SharedMemoryConnector final
+    : public IConnector
+    , private IConnectorListener
+    , private ISharedMemoryHandshakeListener
+{
+    IIoContext* _ioContext{nullptr};
+    SilKit::Services::Logging::ILoggerInternal* _logger{nullptr};
+    IConnectorListener* _listener{nullptr};
+
+    std::unique_ptr<IConnector> _connector;
+    std::unique_ptr<SharedMemoryHandshake> _handshake;
+    std::chrono::milliseconds _timeout{};
+
+public:
+    SharedMemoryConnector(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                          std::unique_ptr<IConnector> connector);
+    ~SharedMemoryConnector() override;
+
+public: // IConnector
+    void SetListener(IConnectorListener& listener) override;
+    void AsyncConnect(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IConnectorListener
+    void OnAsyncConnectSuccess(IConnector& connector, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncConnectFailure(IConnector& connector) override;
+
+private: // ISharedMemoryHandshakeListener
+    void OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                        std::unique_ptr<IRawByteStream> stream) override;
+    void OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake) override;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,340 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryHandshake.hpp"
+
+#include "core/vasio/io/SharedMemoryRawByteStream.hpp"
+#include "core/vasio/io/util/TracingMacros.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryHandshake
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+namespace {
+
+constexpr char SetupRecordMagic[8] = {'S', 'I', 'L', 'K', 'S', 'H', 'M', '1'};
+constexpr size_t SetupRecordHeaderSize{sizeof(SetupRecordMagic) + 2 * sizeof(uint32_t)};
+constexpr uint8_t AcknowledgeValue{1};
+
+void EncodeUint32(uint8_t* destination, uint32_t value)
+{
+    for (size_t i = 0; i < sizeof(uint32_t); ++i)
+    {
+        destination[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+auto DecodeUint32(const uint8_t* source) -> uint32_t
+{
+    uint32_t value{0};
+    for (size_t i = 0; i < sizeof(uint32_t); ++i)
+    {
+        value |= static_cast<uint32_t>(source[i]) << (8 * i);
+    }
+    return value;
+}
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+SharedMemoryHandshake::SharedMemoryHandshake(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                                             std::unique_ptr<IRawByteStream> stream, SharedMemoryRole role)
+    : _ioContext{&ioContext}
+    , _logger{&logger}
+    , _role{role}
+    , _stream{std::move(stream)}
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(_stream.get()));
+}
+
+
+SharedMemoryHandshake::~SharedMemoryHandshake()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryHandshake::SetListener(ISharedMemoryHandshakeListener& listener)
+{
+    _listener = &listener;
+}
+
+
+void SharedMemoryHandshake::Start(std::chrono::milliseconds timeout)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({}ms)", timeout.count());
+
+    _stream->SetListener(*this);
+
+    _timer = _ioContext->MakeTimer();
+    _timer->SetListener(*this);
+    _timer->AsyncWaitFor(timeout);
+
+    if (_role == SharedMemoryRole::Acceptor)
+    {
+        ReadSetupRecord();
+        return;
+    }
+
+    try
+    {
+        _segment = SharedMemorySegment::Create(DefaultRingCapacity);
+        _setupRecord = EncodeSetupRecord(_segment->GetName(), _segment->GetRingCapacity());
+    }
+    catch (const std::exception& exception)
+    {
+        HandleFailure(exception.what());
+        return;
+    }
+
+    WriteSetupRecord();
+}
+
+
+void SharedMemoryHandshake::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    HandleFailure("handshake was aborted");
+}
+
+
+auto SharedMemoryHandshake::EncodeSetupRecord(const std::string& segmentName, size_t ringCapacity)
+    -> std::array<uint8_t, SetupRecordSize>
+{
+    if (segmentName.size() > SetupRecordSize - SetupRecordHeaderSize)
+    {
+        throw SilKit::SilKitError{"shared memory segment name is too long: " + segmentName};
+    }
+
+    if (ringCapacity > std::numeric_limits<uint32_t>::max())
+    {
+        throw SilKit::SilKitError{"shared memory ring capacity is too large"};
+    }
+
+    std::array<uint8_t, SetupRecordSize> record{};
+    std::memcpy(record.data(), SetupRecordMagic, sizeof(SetupRecordMagic));
+    EncodeUint32(record.data() + sizeof(SetupRecordMagic), static_cast<uint32_t>(ringCapacity));
+    EncodeUint32(record.data() + sizeof(SetupRecordMagic) + sizeof(uint32_t),
+                 static_cast<uint32_t>(segmentName.size()));
+    std::memcpy(record.data() + SetupRecordHeaderSize, segmentName.data(), segmentName.size());
+    return record;
+}
+
+
+auto SharedMemoryHandshake::DecodeSetupRecord(const std::array<uint8_t, SetupRecordSize>& record)
+    -> std::pair<std::string, size_t>
+{
+    if (std::memcmp(record.data(), SetupRecordMagic, sizeof(SetupRecordMagic)) != 0)
+    {
+        throw SilKit::SilKitError{"invalid shared memory setup record"};
+    }
+
+    const auto ringCapacity{DecodeUint32(record.data() + sizeof(SetupRecordMagic))};
+    const auto nameLength{DecodeUint32(record.data() + sizeof(SetupRecordMagic) + sizeof(uint32_t))};
+
+    if (nameLength == 0 || nameLength > SetupRecordSize - SetupRecordHeaderSize)
+    {
+        throw SilKit::SilKitError{"invalid shared memory segment name in setup record"};
+    }
+
+    const auto* name{reinterpret_cast<const char*>(record.data() + SetupRecordHeaderSize)};
+    return {std::string{name, name + nameLength}, static_cast<size_t>(ringCapacity)};
+}
+
+
+void SharedMemoryHandshake::OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", bytesTransferred);
+
+    if (_finished)
+    {
+        return;
+    }
+
+    if (bytesTransferred == 0)
+    {
+        HandleFailure("connection was closed during the handshake");
+        return;
+    }
+
+    if (_role == SharedMemoryRole::Connector)
+    {
+        if (_acknowledge != AcknowledgeValue)
+        {
+            HandleFailure("invalid acknowledgement");
+            return;
+        }
+
+        // both sides have the segment mapped, the name is no longer required
+        _segment->Unlink();
+        HandleSuccess();
+        return;
+    }
+
+    _transferred += bytesTransferred;
+    if (_transferred < _setupRecord.size())
+    {
+        ReadSetupRecord();
+        return;
+    }
+
+    try
+    {
+        const auto nameAndCapacity{DecodeSetupRecord(_setupRecord)};
+        _segment = SharedMemorySegment::Open(nameAndCapacity.first, nameAndCapacity.second);
+        _segment->Unlink();
+    }
+    catch (const std::exception& exception)
+    {
+        HandleFailure(exception.what());
+        return;
+    }
+
+    _acknowledge = AcknowledgeValue;
+    _writeBufferSequence[0] = ConstBuffer{&_acknowledge, sizeof(_acknowledge)};
+    _stream->AsyncWriteSome(ConstBufferSequence{_writeBufferSequence.data(), _writeBufferSequence.size()});
+}
+
+
+void SharedMemoryHandshake::OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", bytesTransferred);
+
+    if (_finished)
+    {
+        return;
+    }
+
+    if (bytesTransferred == 0)
+    {
+        HandleFailure("connection was closed during the handshake");
+        return;
+    }
+
+    if (_role == SharedMemoryRole::Acceptor)
+    {
+        HandleSuccess();
+        return;
+    }
+
+    _transferred += bytesTransferred;
+    if (_transferred < _setupRecord.size())
+    {
+        WriteSetupRecord();
+        return;
+    }
+
+    _readBufferSequence[0] = MutableBuffer{&_acknowledge, sizeof(_acknowledge)};
+    _stream->AsyncReadSome(MutableBufferSequence{_readBufferSequence.data(), _readBufferSequence.size()});
+}
+
+
+void SharedMemoryHandshake::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    if (!_finished)
+    {
+        _finished = true;
+        _segment.reset();
+
+        _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+            .SetMessage("Shared memory handshake failed: connection was closed")
+            .Dispatch();
+    }
+
+    if (_timer)
+    {
+        _timer->Shutdown();
+    }
+
+    _ioContext->Post([this] { _listener->OnSharedMemoryHandshakeFailure(*this); });
+}
+
+
+void SharedMemoryHandshake::OnTimerExpired(ITimer&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    HandleFailure("handshake timed out");
+}
+
+
+void SharedMemoryHandshake::ReadSetupRecord()
+{
+    _readBufferSequence[0] = MutableBuffer{_setupRecord.data() + _transferred, _setupRecord.size() - _transferred};
+    _stream->AsyncReadSome(MutableBufferSequence{_readBufferSequence.data(), _readBufferSequence.size()});
+}
+
+
+void SharedMemoryHandshake::WriteSetupRecord()
+{
+    _writeBufferSequence[0] = ConstBuffer{_setupRecord.data() + _transferred, _setupRecord.size() - _transferred};
+    _stream->AsyncWriteSome(ConstBufferSequence{_writeBufferSequence.data(), _writeBufferSequence.size()});
+}
+
+
+void SharedMemoryHandshake::HandleSuccess()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    _finished = true;
+    _timer->Shutdown();
+
+    _result = std::make_unique<SharedMemoryRawByteStream>(*_ioContext, *_logger, std::move(_stream),
+                                                          std::move(_segment), _role);
+
+    // the listener is allowed to destroy the handshake
+    _ioContext->Post([this] { _listener->OnSharedMemoryHandshakeSuccess(*this, std::move(_result)); });
+}
+
+
+void SharedMemoryHandshake::HandleFailure(const std::string& reason)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", reason);
+
+    if (_finished)
+    {
+        return;
+    }
+
+    _finished = true;
+
+    _logger->MakeMessage(Log::Level::Debug, TopicOf(*this))
+        .SetMessage("Shared memory handshake failed: {}", reason)
+        .Dispatch();
+
+    if (_timer)
+    {
+        _timer->Shutdown();
+    }
+
+    _segment.reset();
+
+    // the failure is reported once the stream has been shut down
+    _stream->Shutdown();
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
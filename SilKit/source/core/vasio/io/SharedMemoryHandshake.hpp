@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "core/vasio/io/IRawByteStream.hpp"
+#include "core/vasio/io/IIoContext.hpp"
+#include "core/vasio/io/ITimer.hpp"
+#include "core/vasio/io/SharedMemorySegment.hpp"
+
+#include "services/logging/LoggerMessage.hpp"
+
+#include <array>
+#include <chrono>
+#include <memory>
+
+
+namespace VSilKit {
+
+
+struct ISharedMemoryHandshakeListener;
+
+
+/// Sets up the shared memory segment over a freshly connected local-domain stream.
+///
+/// The connecting side creates the segment and sends its name, the accepting side opens the segment and acknowledges
+/// it. Afterwards, both sides continue with a SharedMemoryRawByteStream wrapping the local-domain stream.
+class SharedMemoryHandshake final
+    : private IRawByteStreamListener
+    , private ITimerListener
+{
+public:
+    /// Default capacity of each of the two rings of a segment.
+    static constexpr size_t DefaultRingCapacity{1024 * 1024};
+
+    /// Size of the setup record sent by the connecting side.
+    static constexpr size_t SetupRecordSize{64};
+
+private:
+    IIoContext* _ioContext{nullptr};
+    SilKit::Services::Logging::ILoggerInternal* _logger{nullptr};
+    ISharedMemoryHandshakeListener* _listener{nullptr};
+    SharedMemoryRole _role;
+
+    std::unique_ptr<IRawByteStream> _stream;
+    std::unique_ptr<SharedMemorySegment> _segment;
+    std::unique_ptr<ITimer> _timer;
+    std::unique_ptr<IRawByteStream> _result;
+
+    std::array<uint8_t, SetupRecordSize> _setupRecord{};
+    uint8_t _acknowledge{0};
+    size_t _transferred{0};
+    std::array<ConstBuffer, 1> _writeBufferSequence;
+    std::array<MutableBuffer, 1> _readBufferSequence;
+
+    bool _finished{false};
+
+public:
+    SharedMemoryHandshake(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                          std::unique_ptr<IRawByteStream> stream, SharedMemoryRole role);
+    ~SharedMemoryHandshake() override;
+
+    void SetListener(ISharedMemoryHandshakeListener& listener);
+
+    void Start(std::chrono::milliseconds timeout);
+
+    void Shutdown();
+
+public:
+    static auto EncodeSetupRecord(const std::string& segmentName, size_t ringCapacity)
+        -> std::array<uint8_t, SetupRecordSize>;
+
+    /// Returns the segment name and ring capacity. Throws SilKitError if the record is invalid.
+    static auto DecodeSetupRecord(const std::array<uint8_t, SetupRecordSize>& record)
+        -> std::pair<std::string, size_t>;
+
+private: // IRawByteStreamListener
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private: // ITimerListener
+    void OnTimerExpired(ITimer& timer) override;
+
+private:
+    void ReadSetupRecord();
+    void WriteSetupRecord();
+    void HandleSuccess();
+    void HandleFailure(const std::string& reason);
+};
+
+
+struct ISharedMemoryHandshakeListener
+{
+    virtual ~ISharedMemoryHandshakeListener() = default;
+
+    virtual void OnSharedMemoryHandshakeSuccess(SharedMemoryHandshake& handshake,
+                                                std::unique_ptr<IRawByteStream> stream) = 0;
+
+    virtual void OnSharedMemoryHandshakeFailure(SharedMemoryHandshake& handshake) = 0;
+};
+
+
+} // namespace VSilKit
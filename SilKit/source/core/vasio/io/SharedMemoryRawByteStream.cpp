@@ -0,0 +1,383 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryRawByteStream.hpp"
+
+#include "core/vasio/io/util/Exceptions.hpp"
+#include "core/vasio/io/util/TracingMacros.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryRawByteStream
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace {
+
+auto TotalSize(VSilKit::ConstBufferSequence bufferSequence) -> size_t
+{
+    return std::accumulate(bufferSequence.begin(), bufferSequence.end(), size_t{0},
+                           [](size_t size, const VSilKit::ConstBuffer& buffer) { return size + buffer.GetSize(); });
+}
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(IIoContext& ioContext,
+                                                     SilKit::Services::Logging::ILoggerInternal& logger,
+                                                     std::unique_ptr<IRawByteStream> wakeUpStream,
+                                                     std::unique_ptr<SharedMemorySegment> segment,
+                                                     SharedMemoryRole role)
+    : _ioContext{&ioContext}
+    , _logger{&logger}
+    , _wakeUpStream{std::move(wakeUpStream)}
+    , _segment{std::move(segment)}
+    , _sendRing{_segment->GetSendRing(role)}
+    , _receiveRing{_segment->GetReceiveRing(role)}
+    , _wakeUpReadBufferSequence{MutableBuffer{_wakeUpReadBuffer.data(), _wakeUpReadBuffer.size()}}
+    , _wakeUpWriteBufferSequence{ConstBuffer{&_wakeUpByte, sizeof(_wakeUpByte)}}
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", _segment->GetName());
+
+    _wakeUpStream->SetListener(*this);
+    _wakeUpStream->AsyncReadSome(MutableBufferSequence{_wakeUpReadBufferSequence.data(), 1});
+}
+
+
+SharedMemoryRawByteStream::~SharedMemoryRawByteStream()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+auto SharedMemoryRawByteStream::GetLocalEndpoint() const -> std::string
+{
+    return _wakeUpStream->GetLocalEndpoint();
+}
+
+
+auto SharedMemoryRawByteStream::GetRemoteEndpoint() const -> std::string
+{
+    return _wakeUpStream->GetRemoteEndpoint();
+}
+
+
+void SharedMemoryRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_shutdownRequested)
+        {
+            SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+            return;
+        }
+
+        if (_reading)
+        {
+            throw InvalidStateError{};
+        }
+
+        _reading = true;
+        _readBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+        _readPollDeadline = std::chrono::steady_clock::now() + _readPollDuration;
+    }
+
+    PostHandler([this] { TryCompleteRead(); });
+}
+
+
+void SharedMemoryRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_shutdownRequested || _wakeUpStreamShutdown)
+        {
+            SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+            return;
+        }
+
+        if (_writing)
+        {
+            throw InvalidStateError{};
+        }
+
+        _writing = true;
+        _writeBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+    }
+
+    PostHandler([this] { TryCompleteWrite(); });
+}
+
+
+void SharedMemoryRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_shutdownRequested)
+        {
+            return;
+        }
+
+        _shutdownRequested = true;
+    }
+
+    // the shutdown of the wake-up stream also terminates the connection on the other side
+    _wakeUpStream->Shutdown();
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncReadSomeDone(IRawByteStream&, size_t)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_shutdownRequested)
+        {
+            return;
+        }
+    }
+
+    // the content of the wake-up bytes is irrelevant, both rings are checked again
+    _wakeUpStream->AsyncReadSome(MutableBufferSequence{_wakeUpReadBufferSequence.data(), 1});
+
+    TryCompleteRead();
+    TryCompleteWrite();
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(..., {})", bytesTransferred);
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        _wakeUpWriting = false;
+
+        if (bytesTransferred != 0 && !_wakeUpPending)
+        {
+            return;
+        }
+
+        _wakeUpPending = false;
+    }
+
+    SendWakeUp();
+}
+
+
+void SharedMemoryRawByteStream::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _wakeUpStreamShutdown = true;
+    _writing = false;
+
+    if (!_shutdownRequested && _reading)
+    {
+        // the other side closed the connection, deliver the data it wrote before
+        lock.unlock();
+        PostHandler([this] { TryCompleteRead(); });
+        return;
+    }
+
+    TryPostShutdown(lock);
+}
+
+
+void SharedMemoryRawByteStream::TryCompleteRead()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (!_reading)
+    {
+        return;
+    }
+
+    const auto bytesTransferred{
+        _receiveRing.Read(MutableBufferSequence{_readBufferSequence.data(), _readBufferSequence.size()})};
+
+    if (bytesTransferred != 0)
+    {
+        _receiveRing.CancelReaderWait();
+        _reading = false;
+        const bool wakeUpWriter{_receiveRing.IsWriterWaiting()};
+        lock.unlock();
+
+        if (wakeUpWriter)
+        {
+            SendWakeUp();
+        }
+
+        _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+        return;
+    }
+
+    if (_wakeUpStreamShutdown)
+    {
+        _reading = false;
+        TryPostShutdown(lock);
+        return;
+    }
+
+    if (std::chrono::steady_clock::now() < _readPollDeadline || !_receiveRing.PrepareReaderWait())
+    {
+        lock.unlock();
+        PostHandler([this] { TryCompleteRead(); });
+        return;
+    }
+
+    // wait for the wake-up from the other side
+}
+
+
+void SharedMemoryRawByteStream::TryCompleteWrite()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (!_writing)
+    {
+        return;
+    }
+
+    const ConstBufferSequence bufferSequence{_writeBufferSequence.data(), _writeBufferSequence.size()};
+    const auto bytesTransferred{_sendRing.Write(bufferSequence)};
+
+    if (bytesTransferred != 0 || TotalSize(bufferSequence) == 0)
+    {
+        _sendRing.CancelWriterWait();
+        _writing = false;
+        const bool wakeUpReader{_sendRing.IsReaderWaiting()};
+        lock.unlock();
+
+        if (wakeUpReader)
+        {
+            SendWakeUp();
+        }
+
+        _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+        return;
+    }
+
+    if (!_sendRing.PrepareWriterWait())
+    {
+        lock.unlock();
+        PostHandler([this] { TryCompleteWrite(); });
+        return;
+    }
+
+    // wait for the wake-up from the other side
+}
+
+
+void SharedMemoryRawByteStream::SendWakeUp()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_shutdownRequested || _wakeUpStreamShutdown)
+        {
+            return;
+        }
+
+        if (_wakeUpWriting)
+        {
+            _wakeUpPending = true;
+            return;
+        }
+
+        _wakeUpWriting = true;
+    }
+
+    _wakeUpStream->AsyncWriteSome(ConstBufferSequence{_wakeUpWriteBufferSequence.data(), 1});
+}
+
+
+void SharedMemoryRawByteStream::PostHandler(std::function<void()> handler)
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _postedHandlers += 1;
+    }
+
+    _ioContext->Post([this, handler = std::move(handler)] {
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _postedHandlers -= 1;
+
+            if (_shutdownRequested)
+            {
+                TryPostShutdown(lock);
+                return;
+            }
+        }
+
+        handler();
+
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_wakeUpStreamShutdown)
+        {
+            TryPostShutdown(lock);
+        }
+    });
+}
+
+
+void SharedMemoryRawByteStream::TryPostShutdown(std::unique_lock<std::mutex>& lock)
+{
+    SILKIT_TRACE_METHOD_(_logger, "() [shutdownRequested={}, wakeUpStreamShutdown={}, postedHandlers={}]",
+                         _shutdownRequested, _wakeUpStreamShutdown, _postedHandlers);
+
+    // no handler referencing this stream must be pending when the listener is notified
+    if (!_wakeUpStreamShutdown || _postedHandlers != 0 || _shutdownPosted)
+    {
+        return;
+    }
+
+    // keep delivering the data written by the other side before it closed the connection
+    if (!_shutdownRequested && (_reading || !_receiveRing.IsEmpty()))
+    {
+        return;
+    }
+
+    _shutdownPosted = true;
+    lock.unlock();
+
+    _ioContext->Post([this] { _listener->OnShutdown(*this); });
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
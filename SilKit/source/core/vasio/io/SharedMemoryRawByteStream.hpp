@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "core/vasio/io/IRawByteStream.hpp"
+#include "core/vasio/io/IIoContext.hpp"
+#include "core/vasio/io/SharedMemorySegment.hpp"
+
+#include "services/logging/LoggerMessage.hpp"
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+/// Byte stream between two processes on the same host, which transfers the data through the rings of a shared memory
+/// segment.
+///
+/// The local-domain socket used to set up the segment stays connected. It only carries single-byte wake-ups when the
+/// other side announced that it waits for data (or free space), and it signals the shutdown of the connection.
+/// After a read request found the ring empty, the ring is polled for a short time before waiting for a wake-up.
+class SharedMemoryRawByteStream final
+    : public IRawByteStream
+    , private IRawByteStreamListener
+{
+    IIoContext* _ioContext{nullptr};
+    SilKit::Services::Logging::ILoggerInternal* _logger{nullptr};
+    IRawByteStreamListener* _listener{nullptr};
+
+    std::unique_ptr<IRawByteStream> _wakeUpStream;
+    std::unique_ptr<SharedMemorySegment> _segment;
+    SharedMemoryRing _sendRing;
+    SharedMemoryRing _receiveRing;
+
+    std::mutex _mutex;
+    bool _reading{false};
+    bool _writing{false};
+    std::vector<MutableBuffer> _readBufferSequence;
+    std::vector<ConstBuffer> _writeBufferSequence;
+    std::chrono::steady_clock::time_point _readPollDeadline;
+
+    bool _wakeUpWriting{false};
+    bool _wakeUpPending{false};
+    std::array<uint8_t, 64> _wakeUpReadBuffer{};
+    std::array<MutableBuffer, 1> _wakeUpReadBufferSequence;
+    uint8_t _wakeUpByte{1};
+    std::array<ConstBuffer, 1> _wakeUpWriteBufferSequence;
+
+    bool _shutdownRequested{false};
+    bool _wakeUpStreamShutdown{false};
+    bool _shutdownPosted{false};
+    size_t _postedHandlers{0};
+
+    const std::chrono::microseconds _readPollDuration{20};
+
+public:
+    SharedMemoryRawByteStream(IIoContext& ioContext, SilKit::Services::Logging::ILoggerInternal& logger,
+                              std::unique_ptr<IRawByteStream> wakeUpStream,
+                              std::unique_ptr<SharedMemorySegment> segment, SharedMemoryRole role);
+    ~SharedMemoryRawByteStream() override;
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    auto GetRemoteEndpoint() const -> std::string override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+
+private: // IRawByteStreamListener (wake-up stream)
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private:
+    void TryCompleteRead();
+    void TryCompleteWrite();
+
+    void SendWakeUp();
+    void PostHandler(std::function<void()> handler);
+    void TryPostShutdown(std::unique_lock<std::mutex>& lock);
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryRing.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+
+namespace VSilKit {
+
+
+SharedMemoryRing::SharedMemoryRing(void* memory, size_t capacity)
+    : _header{static_cast<SharedMemoryRingHeader*>(memory)}
+    , _data{static_cast<uint8_t*>(memory) + sizeof(SharedMemoryRingHeader)}
+    , _capacity{capacity}
+{
+}
+
+
+auto SharedMemoryRing::RequiredMemorySize(size_t capacity) -> size_t
+{
+    return sizeof(SharedMemoryRingHeader) + capacity;
+}
+
+
+void SharedMemoryRing::Initialize()
+{
+    new (_header) SharedMemoryRingHeader{};
+    _header->writePosition.store(0);
+    _header->readPosition.store(0);
+    _header->readerWaiting.store(0);
+    _header->writerWaiting.store(0);
+}
+
+
+auto SharedMemoryRing::Capacity() const -> size_t
+{
+    return _capacity;
+}
+
+
+auto SharedMemoryRing::Write(ConstBufferSequence bufferSequence) -> size_t
+{
+    const auto writePosition{_header->writePosition.load(std::memory_order_relaxed)};
+    const auto readPosition{_header->readPosition.load(std::memory_order_acquire)};
+
+    size_t freeSize{_capacity - static_cast<size_t>(writePosition - readPosition)};
+    size_t offset{static_cast<size_t>(writePosition % _capacity)};
+    size_t written{0};
+
+    for (auto buffer : bufferSequence)
+    {
+        while (buffer.GetSize() != 0 && freeSize != 0)
+        {
+            const auto chunkSize{std::min({buffer.GetSize(), freeSize, _capacity - offset})};
+            const auto chunk{buffer.SliceOff(chunkSize)};
+            std::memcpy(_data + offset, chunk.GetData(), chunkSize);
+
+            offset = (offset + chunkSize) % _capacity;
+            freeSize -= chunkSize;
+            written += chunkSize;
+        }
+
+        if (freeSize == 0)
+        {
+            break;
+        }
+    }
+
+    if (written != 0)
+    {
+        _header->writePosition.store(writePosition + written, std::memory_order_release);
+    }
+
+    return written;
+}
+
+
+auto SharedMemoryRing::IsReaderWaiting() const -> bool
+{
+    // pairs with the fence in PrepareReaderWait: either the reader sees the new write position, or we see its flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return _header->readerWaiting.load(std::memory_order_relaxed) != 0;
+}
+
+
+auto SharedMemoryRing::PrepareWriterWait() -> bool
+{
+    _header->writerWaiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const auto writePosition{_header->writePosition.load(std::memory_order_relaxed)};
+    const auto readPosition{_header->readPosition.load(std::memory_order_acquire)};
+    if (writePosition - readPosition < _capacity)
+    {
+        CancelWriterWait();
+        return false;
+    }
+
+    return true;
+}
+
+
+void SharedMemoryRing::CancelWriterWait()
+{
+    _header->writerWaiting.store(0, std::memory_order_relaxed);
+}
+
+
+auto SharedMemoryRing::Read(MutableBufferSequence bufferSequence) -> size_t
+{
+    const auto readPosition{_header->readPosition.load(std::memory_order_relaxed)};
+    const auto writePosition{_header->writePosition.load(std::memory_order_acquire)};
+
+    size_t availableSize{static_cast<size_t>(writePosition - readPosition)};
+    size_t offset{static_cast<size_t>(readPosition % _capacity)};
+    size_t read{0};
+
+    for (auto buffer : bufferSequence)
+    {
+        while (buffer.GetSize() != 0 && availableSize != 0)
+        {
+            const auto chunkSize{std::min({buffer.GetSize(), availableSize, _capacity - offset})};
+            const auto chunk{buffer.SliceOff(chunkSize)};
+            std::memcpy(chunk.GetData(), _data + offset, chunkSize);
+
+            offset = (offset + chunkSize) % _capacity;
+            availableSize -= chunkSize;
+            read += chunkSize;
+        }
+
+        if (availableSize == 0)
+        {
+            break;
+        }
+    }
+
+    if (read != 0)
+    {
+        _header->readPosition.store(readPosition + read, std::memory_order_release);
+    }
+
+    return read;
+}
+
+
+auto SharedMemoryRing::IsWriterWaiting() const -> bool
+{
+    // pairs with the fence in PrepareWriterWait: either the writer sees the new read position, or we see its flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return _header->writerWaiting.load(std::memory_order_relaxed) != 0;
+}
+
+
+auto SharedMemoryRing::PrepareReaderWait() -> bool
+{
+    _header->readerWaiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (!IsEmpty())
+    {
+        CancelReaderWait();
+        return false;
+    }
+
+    return true;
+}
+
+
+void SharedMemoryRing::CancelReaderWait()
+{
+    _header->readerWaiting.store(0, std::memory_order_relaxed);
+}
+
+
+auto SharedMemoryRing::IsEmpty() const -> bool
+{
+    return _header->writePosition.load(std::memory_order_acquire)
+           == _header->readPosition.load(std::memory_order_relaxed);
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "core/vasio/io/util/Buffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+/// Control block of a single-producer single-consumer byte ring placed in shared memory. The positions are
+/// monotonically increasing byte counters, the data area follows the control block directly.
+struct SharedMemoryRingHeader
+{
+    alignas(64) std::atomic<uint64_t> writePosition;
+    alignas(64) std::atomic<uint64_t> readPosition;
+    alignas(64) std::atomic<uint32_t> readerWaiting;
+    std::atomic<uint32_t> writerWaiting;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory rings require lock-free 64-bit atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shared memory rings require lock-free 32-bit atomics");
+
+
+/// View of one direction of a shared memory stream. Exactly one process writes and one process reads a ring.
+///
+/// A reader (writer) which found the ring empty (full) announces that it is waiting. The other side checks the
+/// announcement after publishing its position and requests a wake-up (see NeedsWakeUp results).
+class SharedMemoryRing
+{
+    SharedMemoryRingHeader* _header{nullptr};
+    uint8_t* _data{nullptr};
+    size_t _capacity{0};
+
+public:
+    SharedMemoryRing() = default;
+    SharedMemoryRing(void* memory, size_t capacity);
+
+    /// Number of bytes occupied by the control block and the data area of a ring with the given capacity.
+    static auto RequiredMemorySize(size_t capacity) -> size_t;
+
+    /// Initializes the control block. Must be called once by the process creating the shared memory.
+    void Initialize();
+
+    auto Capacity() const -> size_t;
+
+public: // writer side
+    /// Copies as many bytes of the buffer sequence into the ring as fit, returns the number of copied bytes.
+    auto Write(ConstBufferSequence bufferSequence) -> size_t;
+
+    /// Returns true, if the reader announced that it waits for data.
+    auto IsReaderWaiting() const -> bool;
+
+    /// Announces that the writer waits for free space. Returns false, if space became available in the meantime.
+    auto PrepareWriterWait() -> bool;
+    void CancelWriterWait();
+
+public: // reader side
+    /// Copies as many available bytes into the buffer sequence as fit, returns the number of copied bytes.
+    auto Read(MutableBufferSequence bufferSequence) -> size_t;
+
+    /// Returns true, if the writer announced that it waits for free space.
+    auto IsWriterWaiting() const -> bool;
+
+    /// Announces that the reader waits for data. Returns false, if data became available in the meantime.
+    auto PrepareReaderWait() -> bool;
+    void CancelReaderWait();
+
+    auto IsEmpty() const -> bool;
+};
+
+
+} // namespace VSilKit
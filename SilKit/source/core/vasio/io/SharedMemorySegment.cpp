@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemorySegment.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include "util/Uuid.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+
+// Rounds the ring memory up to a multiple of the cache line size
+auto AlignedRingMemorySize(size_t ringCapacity) -> size_t
+{
+    const auto size{VSilKit::SharedMemoryRing::RequiredMemorySize(ringCapacity)};
+    return (size + 63) / 64 * 64;
+}
+
+[[noreturn]] void ThrowSystemError(const char* operation, const std::string& name)
+{
+    const auto errorNumber{errno};
+    std::ostringstream ss;
+    ss << "SharedMemorySegment: " << operation << " '" << name << "' failed: " << strerror(errorNumber) << " (errno "
+       << errorNumber << ")";
+    throw SilKit::SilKitError{ss.str()};
+}
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+#if defined(__linux__)
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    if (_memory != nullptr)
+    {
+        (void)::munmap(_memory, _memorySize);
+    }
+
+    Unlink();
+}
+
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return true;
+}
+
+
+auto SharedMemorySegment::Create(size_t ringCapacity) -> std::unique_ptr<SharedMemorySegment>
+{
+    std::unique_ptr<SharedMemorySegment> segment{new SharedMemorySegment{}};
+    segment->_name = "/silkit-" + SilKit::Util::to_string(SilKit::Util::Uuid::GenerateRandom());
+    segment->_ringCapacity = ringCapacity;
+    segment->_memorySize = 2 * AlignedRingMemorySize(ringCapacity);
+
+    const int fd{::shm_open(segment->_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)};
+    if (fd == -1)
+    {
+        ThrowSystemError("shm_open", segment->_name);
+    }
+    segment->_isLinked = true;
+
+    if (::ftruncate(fd, static_cast<off_t>(segment->_memorySize)) == -1)
+    {
+        (void)::close(fd);
+        ThrowSystemError("ftruncate", segment->_name);
+    }
+
+    void* memory{::mmap(nullptr, segment->_memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+    (void)::close(fd);
+    if (memory == MAP_FAILED)
+    {
+        ThrowSystemError("mmap", segment->_name);
+    }
+    segment->_memory = memory;
+
+    segment->GetRing(0).Initialize();
+    segment->GetRing(1).Initialize();
+
+    return segment;
+}
+
+
+auto SharedMemorySegment::Open(const std::string& name, size_t ringCapacity) -> std::unique_ptr<SharedMemorySegment>
+{
+    std::unique_ptr<SharedMemorySegment> segment{new SharedMemorySegment{}};
+    segment->_name = name;
+    segment->_ringCapacity = ringCapacity;
+    segment->_memorySize = 2 * AlignedRingMemorySize(ringCapacity);
+
+    const int fd{::shm_open(segment->_name.c_str(), O_RDWR, 0)};
+    if (fd == -1)
+    {
+        ThrowSystemError("shm_open", segment->_name);
+    }
+
+    struct stat status{};
+    if (::fstat(fd, &status) == -1 || static_cast<size_t>(status.st_size) != segment->_memorySize)
+    {
+        (void)::close(fd);
+        throw SilKit::SilKitError{"SharedMemorySegment: segment '" + name + "' has an unexpected size"};
+    }
+
+    void* memory{::mmap(nullptr, segment->_memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+    (void)::close(fd);
+    if (memory == MAP_FAILED)
+    {
+        ThrowSystemError("mmap", segment->_name);
+    }
+    segment->_memory = memory;
+
+    return segment;
+}
+
+
+void SharedMemorySegment::Unlink()
+{
+    if (_isLinked)
+    {
+        _isLinked = false;
+        (void)::shm_unlink(_name.c_str());
+    }
+}
+
+#else
+
+SharedMemorySegment::~SharedMemorySegment() = default;
+
+
+auto SharedMemorySegment::IsSupported() -> bool
+{
+    return false;
+}
+
+
+auto SharedMemorySegment::Create(size_t) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SilKit::SilKitError{"SharedMemorySegment: shared memory streams are not supported on this platform"};
+}
+
+
+auto SharedMemorySegment::Open(const std::string&, size_t) -> std::unique_ptr<SharedMemorySegment>
+{
+    throw SilKit::SilKitError{"SharedMemorySegment: shared memory streams are not supported on this platform"};
+}
+
+
+void SharedMemorySegment::Unlink()
+{
+}
+
+#endif
+
+
+auto SharedMemorySegment::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+
+auto SharedMemorySegment::GetRingCapacity() const -> size_t
+{
+    return _ringCapacity;
+}
+
+
+auto SharedMemorySegment::GetSendRing(SharedMemoryRole role) -> SharedMemoryRing
+{
+    return GetRing(role == SharedMemoryRole::Connector ? 0 : 1);
+}
+
+
+auto SharedMemorySegment::GetReceiveRing(SharedMemoryRole role) -> SharedMemoryRing
+{
+    return GetRing(role == SharedMemoryRole::Connector ? 1 : 0);
+}
+
+
+auto SharedMemorySegment::GetRing(size_t index) -> SharedMemoryRing
+{
+    auto* ringMemory{static_cast<uint8_t*>(_memory) + index * AlignedRingMemorySize(_ringCapacity)};
+    return SharedMemoryRing{ringMemory, _ringCapacity};
+}
+
+
+} // namespace VSilKit
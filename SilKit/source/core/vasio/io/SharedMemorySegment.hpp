@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "core/vasio/io/SharedMemoryRing.hpp"
+
+#include <memory>
+#include <string>
+
+
+namespace VSilKit {
+
+
+enum class SharedMemoryRole
+{
+    Connector,
+    Acceptor,
+};
+
+
+/// Named shared memory holding the two rings of a shared memory stream. The connecting side creates the segment and
+/// writes into the first ring, the accepting side opens it and writes into the second ring.
+class SharedMemorySegment
+{
+    std::string _name;
+    void* _memory{nullptr};
+    size_t _memorySize{0};
+    size_t _ringCapacity{0};
+    bool _isLinked{false};
+
+public:
+    ~SharedMemorySegment();
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+    /// Returns true, if shared memory streams are available on this platform.
+    static auto IsSupported() -> bool;
+
+    /// Creates a new segment with a unique name. Throws SilKitError on failure.
+    static auto Create(size_t ringCapacity) -> std::unique_ptr<SharedMemorySegment>;
+
+    /// Opens the segment created by the peer. Throws SilKitError on failure.
+    static auto Open(const std::string& name, size_t ringCapacity) -> std::unique_ptr<SharedMemorySegment>;
+
+    auto GetName() const -> const std::string&;
+
+    auto GetRingCapacity() const -> size_t;
+
+    /// Removes the name of the segment. The memory stays valid until both sides unmapped it.
+    void Unlink();
+
+    /// Returns the ring the given side writes into.
+    auto GetSendRing(SharedMemoryRole role) -> SharedMemoryRing;
+
+    /// Returns the ring the given side reads from.
+    auto GetReceiveRing(SharedMemoryRole role) -> SharedMemoryRing;
+
+private:
+    SharedMemorySegment() = default;
+
+    auto GetRing(size_t index) -> SharedMemoryRing;
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryRawByteStream.hpp"
+#include "core/vasio/io/SharedMemoryHandshake.hpp"
+
+#include "services/logging/MockLogger.hpp"
+
+#include "core/vasio/io/mock/MockIoContext.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <numeric>
+#include <vector>
+
+
+namespace {
+
+
+using namespace VSilKit;
+
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+
+
+// Connected pair of streams standing in for the local-domain socket used for the wake-ups
+struct FakeWakeUpStream : IRawByteStream
+{
+    IIoContext* ioContext{nullptr};
+    FakeWakeUpStream* other{nullptr};
+    IRawByteStreamListener* listener{nullptr};
+
+    bool reading{false};
+    size_t pendingBytes{0};
+    size_t writtenBytes{0};
+    bool shutdown{false};
+
+    explicit FakeWakeUpStream(IIoContext& ioContext_)
+        : ioContext{&ioContext_}
+    {
+    }
+
+    void SetListener(IRawByteStreamListener& listener_) override
+    {
+        listener = &listener_;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///fake";
+    }
+
+    auto GetRemoteEndpoint() const -> std::string override
+    {
+        return "local:///fake";
+    }
+
+    void AsyncReadSome(MutableBufferSequence) override
+    {
+        reading = true;
+        DeliverPendingBytes();
+    }
+
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override
+    {
+        const auto size{bufferSequence[0].GetSize()};
+        writtenBytes += size;
+        ioContext->Post([this, size] {
+            if (other->shutdown)
+            {
+                return;
+            }
+            other->pendingBytes += size;
+            other->DeliverPendingBytes();
+            listener->OnAsyncWriteSomeDone(*this, size);
+        });
+    }
+
+    void Shutdown() override
+    {
+        for (auto* stream : {this, other})
+        {
+            if (!stream->shutdown)
+            {
+                stream->shutdown = true;
+                ioContext->Post([stream] { stream->listener->OnShutdown(*stream); });
+            }
+        }
+    }
+
+    void DeliverPendingBytes()
+    {
+        if (!reading || pendingBytes == 0)
+        {
+            return;
+        }
+
+        reading = false;
+        const auto size{pendingBytes};
+        pendingBytes = 0;
+        ioContext->Post([this, size] { listener->OnAsyncReadSomeDone(*this, size); });
+    }
+};
+
+
+struct Listener : IRawByteStreamListener
+{
+    std::vector<size_t> reads;
+    std::vector<size_t> writes;
+    bool shutdown{false};
+
+    void OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        reads.push_back(bytesTransferred);
+    }
+
+    void OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        writes.push_back(bytesTransferred);
+    }
+
+    void OnShutdown(IRawByteStream&) override
+    {
+        shutdown = true;
+    }
+};
+
+
+struct Test_SharedMemoryRawByteStream : ::testing::Test
+{
+    static constexpr size_t ringCapacity{256};
+
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+
+    FakeWakeUpStream* connectorWakeUp{nullptr};
+    FakeWakeUpStream* acceptorWakeUp{nullptr};
+
+    std::unique_ptr<SharedMemoryRawByteStream> connector;
+    std::unique_ptr<SharedMemoryRawByteStream> acceptor;
+
+    Listener connectorListener;
+    Listener acceptorListener;
+
+    void SetUp() override
+    {
+        if (!SharedMemorySegment::IsSupported())
+        {
+            GTEST_SKIP() << "shared memory is not supported on this platform";
+        }
+
+        auto connectorSegment{SharedMemorySegment::Create(ringCapacity)};
+        auto acceptorSegment{SharedMemorySegment::Open(connectorSegment->GetName(), ringCapacity)};
+        connectorSegment->Unlink();
+
+        auto connectorWakeUpStream{std::make_unique<FakeWakeUpStream>(ioContext)};
+        auto acceptorWakeUpStream{std::make_unique<FakeWakeUpStream>(ioContext)};
+        connectorWakeUp = connectorWakeUpStream.get();
+        acceptorWakeUp = acceptorWakeUpStream.get();
+        connectorWakeUp->other = acceptorWakeUp;
+        acceptorWakeUp->other = connectorWakeUp;
+
+        connector = std::make_unique<SharedMemoryRawByteStream>(
+            ioContext, logger, std::move(connectorWakeUpStream), std::move(connectorSegment),
+            SharedMemoryRole::Connector);
+        acceptor = std::make_unique<SharedMemoryRawByteStream>(ioContext, logger, std::move(acceptorWakeUpStream),
+                                                               std::move(acceptorSegment), SharedMemoryRole::Acceptor);
+
+        connector->SetListener(connectorListener);
+        acceptor->SetListener(acceptorListener);
+    }
+
+    static auto MakeData(size_t size) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        std::iota(data.begin(), data.end(), uint8_t{1});
+        return data;
+    }
+};
+
+
+TEST_F(Test_SharedMemoryRawByteStream, data_written_on_one_side_is_read_on_the_other_side)
+{
+    const auto data{MakeData(100)};
+    ConstBuffer constBuffer{data.data(), data.size()};
+    connector->AsyncWriteSome(ConstBufferSequence{&constBuffer, 1});
+
+    std::vector<uint8_t> received(data.size());
+    MutableBuffer mutableBuffer{received.data(), received.size()};
+    acceptor->AsyncReadSome(MutableBufferSequence{&mutableBuffer, 1});
+
+    ioContext.Run();
+
+    ASSERT_EQ(connectorListener.writes, std::vector<size_t>{data.size()});
+    ASSERT_EQ(acceptorListener.reads, std::vector<size_t>{data.size()});
+    ASSERT_EQ(received, data);
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, waiting_reader_is_woken_up_by_the_writer)
+{
+    std::vector<uint8_t> received(16);
+    MutableBuffer mutableBuffer{received.data(), received.size()};
+    acceptor->AsyncReadSome(MutableBufferSequence{&mutableBuffer, 1});
+
+    // the reader stops polling and waits for the wake-up
+    ioContext.Run();
+    ASSERT_TRUE(acceptorListener.reads.empty());
+
+    const auto data{MakeData(16)};
+    ConstBuffer constBuffer{data.data(), data.size()};
+    connector->AsyncWriteSome(ConstBufferSequence{&constBuffer, 1});
+    ioContext.Run();
+
+    ASSERT_EQ(connectorWakeUp->writtenBytes, 1u);
+    ASSERT_EQ(acceptorListener.reads, std::vector<size_t>{data.size()});
+    ASSERT_EQ(received, data);
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, writer_continues_after_the_reader_made_room)
+{
+    const auto data{MakeData(ringCapacity)};
+    ConstBuffer constBuffer{data.data(), data.size()};
+    connector->AsyncWriteSome(ConstBufferSequence{&constBuffer, 1});
+    ioContext.Run();
+    ASSERT_EQ(connectorListener.writes, std::vector<size_t>{ringCapacity});
+
+    // the ring is full, the second write waits
+    connector->AsyncWriteSome(ConstBufferSequence{&constBuffer, 1});
+    ioContext.Run();
+    ASSERT_EQ(connectorListener.writes.size(), 1u);
+
+    std::vector<uint8_t> received(ringCapacity);
+    MutableBuffer mutableBuffer{received.data(), received.size()};
+    acceptor->AsyncReadSome(MutableBufferSequence{&mutableBuffer, 1});
+    ioContext.Run();
+
+    ASSERT_EQ(acceptorListener.reads, std::vector<size_t>{ringCapacity});
+    ASSERT_EQ(connectorListener.writes, (std::vector<size_t>{ringCapacity, ringCapacity}));
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, remaining_data_is_delivered_before_the_remote_shutdown)
+{
+    const auto data{MakeData(32)};
+    ConstBuffer constBuffer{data.data(), data.size()};
+    connector->AsyncWriteSome(ConstBufferSequence{&constBuffer, 1});
+    ioContext.Run();
+
+    connector->Shutdown();
+    ioContext.Run();
+    ASSERT_TRUE(connectorListener.shutdown);
+    ASSERT_FALSE(acceptorListener.shutdown);
+
+    std::vector<uint8_t> received(data.size());
+    MutableBuffer mutableBuffer{received.data(), received.size()};
+    acceptor->AsyncReadSome(MutableBufferSequence{&mutableBuffer, 1});
+    ioContext.Run();
+
+    ASSERT_EQ(received, data);
+    ASSERT_TRUE(acceptorListener.shutdown);
+}
+
+TEST(Test_SharedMemoryHandshake, setup_record_round_trip)
+{
+    const auto record{SharedMemoryHandshake::EncodeSetupRecord("/silkit-segment", 4096)};
+    const auto nameAndCapacity{SharedMemoryHandshake::DecodeSetupRecord(record)};
+
+    ASSERT_EQ(nameAndCapacity.first, "/silkit-segment");
+    ASSERT_EQ(nameAndCapacity.second, 4096u);
+}
+
+TEST(Test_SharedMemoryHandshake, invalid_setup_record_is_rejected)
+{
+    std::array<uint8_t, SharedMemoryHandshake::SetupRecordSize> record{};
+    ASSERT_THROW(SharedMemoryHandshake::DecodeSetupRecord(record), SilKit::SilKitError);
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "core/vasio/io/SharedMemoryRing.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+
+namespace {
+
+
+using VSilKit::ConstBuffer;
+using VSilKit::ConstBufferSequence;
+using VSilKit::MutableBuffer;
+using VSilKit::MutableBufferSequence;
+using VSilKit::SharedMemoryRing;
+
+
+struct Test_SharedMemoryRing : ::testing::Test
+{
+    static constexpr size_t capacity{64};
+
+    std::vector<uint64_t> memory;
+    SharedMemoryRing writer;
+    SharedMemoryRing reader;
+
+    void SetUp() override
+    {
+        memory.resize(SharedMemoryRing::RequiredMemorySize(capacity) / sizeof(uint64_t) + 8);
+
+        // the header is cache-line aligned, mimic the alignment of the mapped segment
+        auto address{reinterpret_cast<uintptr_t>(memory.data())};
+        auto* aligned{reinterpret_cast<void*>((address + 63) & ~uintptr_t{63})};
+
+        writer = SharedMemoryRing{aligned, capacity};
+        writer.Initialize();
+        reader = SharedMemoryRing{aligned, capacity};
+    }
+
+    auto Write(const std::vector<uint8_t>& data) -> size_t
+    {
+        ConstBuffer buffer{data.data(), data.size()};
+        return writer.Write(ConstBufferSequence{&buffer, 1});
+    }
+
+    auto Read(size_t size) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        MutableBuffer buffer{data.data(), data.size()};
+        data.resize(reader.Read(MutableBufferSequence{&buffer, 1}));
+        return data;
+    }
+
+    static auto MakeData(size_t size, uint8_t first) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        std::iota(data.begin(), data.end(), first);
+        return data;
+    }
+};
+
+
+TEST_F(Test_SharedMemoryRing, written_bytes_are_read_in_order)
+{
+    const auto data{MakeData(10, 0)};
+
+    ASSERT_EQ(Write(data), data.size());
+    ASSERT_FALSE(reader.IsEmpty());
+    ASSERT_EQ(Read(32), data);
+    ASSERT_TRUE(reader.IsEmpty());
+}
+
+TEST_F(Test_SharedMemoryRing, write_is_truncated_when_the_ring_is_full)
+{
+    ASSERT_EQ(Write(MakeData(capacity + 10, 0)), capacity);
+    ASSERT_EQ(Write(MakeData(1, 0)), 0u);
+
+    ASSERT_EQ(Read(capacity), MakeData(capacity, 0));
+    ASSERT_EQ(Write(MakeData(1, 0)), 1u);
+}
+
+TEST_F(Test_SharedMemoryRing, data_wraps_around_the_end_of_the_ring)
+{
+    ASSERT_EQ(Write(MakeData(48, 0)), 48u);
+    ASSERT_EQ(Read(48), MakeData(48, 0));
+
+    // the second write starts at offset 48 and continues at the beginning of the data area
+    const auto data{MakeData(40, 100)};
+    ASSERT_EQ(Write(data), data.size());
+    ASSERT_EQ(Read(40), data);
+}
+
+TEST_F(Test_SharedMemoryRing, gather_write_and_scatter_read)
+{
+    const auto first{MakeData(5, 0)};
+    const auto second{MakeData(7, 50)};
+    std::array<ConstBuffer, 2> constBuffers{ConstBuffer{first.data(), first.size()},
+                                            ConstBuffer{second.data(), second.size()}};
+    ASSERT_EQ(writer.Write(ConstBufferSequence{constBuffers.data(), constBuffers.size()}), 12u);
+
+    std::vector<uint8_t> head(3);
+    std::vector<uint8_t> tail(9);
+    std::array<MutableBuffer, 2> mutableBuffers{MutableBuffer{head.data(), head.size()},
+                                                MutableBuffer{tail.data(), tail.size()}};
+    ASSERT_EQ(reader.Read(MutableBufferSequence{mutableBuffers.data(), mutableBuffers.size()}), 12u);
+
+    std::vector<uint8_t> expected{first};
+    expected.insert(expected.end(), second.begin(), second.end());
+    std::vector<uint8_t> actual{head};
+    actual.insert(actual.end(), tail.begin(), tail.end());
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(Test_SharedMemoryRing, reader_wait_is_announced_only_while_the_ring_is_empty)
+{
+    ASSERT_TRUE(reader.PrepareReaderWait());
+    ASSERT_TRUE(writer.IsReaderWaiting());
+    reader.CancelReaderWait();
+    ASSERT_FALSE(writer.IsReaderWaiting());
+
+    ASSERT_EQ(Write(MakeData(1, 0)), 1u);
+    ASSERT_FALSE(reader.PrepareReaderWait());
+}
+
+TEST_F(Test_SharedMemoryRing, writer_wait_is_announced_only_while_the_ring_is_full)
+{
+    ASSERT_FALSE(writer.PrepareWriterWait());
+
+    ASSERT_EQ(Write(MakeData(capacity, 0)), capacity);
+    ASSERT_TRUE(writer.PrepareWriterWait());
+    ASSERT_TRUE(reader.IsWriterWaiting());
+    writer.CancelWriterWait();
+    ASSERT_FALSE(reader.IsWriterWaiting());
+}
+
+
+} // anonymous namespace
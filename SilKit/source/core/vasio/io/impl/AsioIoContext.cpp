@@ -13,6 +13,7 @@
 #include "core/vasio/io/util/TracingMacros.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <regex> // IsIPv4 / IsIPv6
@@ -160,7 +161,36 @@ void AsioIoContext::Run()
         _asioIoContext->restart();
     }
 
-    _asioIoContext->run();
+    if (_socketOptions.spinWaitBudget <= std::chrono::microseconds::zero())
+    {
+        _asioIoContext->run();
+        return;
+    }
+
+    // Spin-then-block: poll the sockets and run the ready handlers without blocking, until nothing was ready for the
+    // duration of the spin budget. Only then block until the next handler is ready, which saves the wake-up latency
+    // of the IO thread if the next message (e.g., the NextSimTask of a peer) arrives within the budget.
+    auto lastActivity = std::chrono::steady_clock::now();
+    while (!_asioIoContext->stopped())
+    {
+        if (_asioIoContext->poll() != 0)
+        {
+            lastActivity = std::chrono::steady_clock::now();
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() - lastActivity < _socketOptions.spinWaitBudget)
+        {
+            continue;
+        }
+
+        // returns zero if the io_context ran out of work, like run()
+        if (_asioIoContext->run_one() == 0)
+        {
+            return;
+        }
+        lastActivity = std::chrono::steady_clock::now();
+    }
 }
 
 
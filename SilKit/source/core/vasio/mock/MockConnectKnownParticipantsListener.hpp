@@ -20,6 +20,8 @@ struct MockConnectKnownParticipantsListener : IConnectKnownParticipantsListener
     MOCK_METHOD(void, OnConnectKnownParticipantsFailure, (ConnectKnownParticipants&), (override));
     MOCK_METHOD(void, OnConnectKnownParticipantsWaitingForAllReplies, (ConnectKnownParticipants&), (override));
     MOCK_METHOD(void, OnConnectKnownParticipantsAllRepliesReceived, (ConnectKnownParticipants&), (override));
+    MOCK_METHOD(void, OnConnectKnownParticipantsDeferredPeerConnected, (ConnectKnownParticipants&, const std::string&),
+                (override));
 };
 
 
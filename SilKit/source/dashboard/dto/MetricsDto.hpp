@@ -40,6 +40,13 @@ class StatisticDataDto : public MetricDataDto
     DTO_FIELD(Vector<Float64>, mv) = Vector<Float64>::createShared();
 };
 
+class HistogramDataDto : public MetricDataDto
+{
+    DTO_INIT(HistogramDataDto, MetricDataDto)
+
+    DTO_FIELD(Vector<Int64>, mv) = Vector<Int64>::createShared();
+};
+
 
 class MetricsUpdateDto : public oatpp::DTO
 {
@@ -48,6 +55,7 @@ class MetricsUpdateDto : public oatpp::DTO
     DTO_FIELD(Vector<Object<AttributeDataDto>>, attributes) = Vector<Object<AttributeDataDto>>::createShared();
     DTO_FIELD(Vector<Object<CounterDataDto>>, counters) = Vector<Object<CounterDataDto>>::createShared();
     DTO_FIELD(Vector<Object<StatisticDataDto>>, statistics) = Vector<Object<StatisticDataDto>>::createShared();
+    DTO_FIELD(Vector<Object<HistogramDataDto>>, histograms) = Vector<Object<HistogramDataDto>>::createShared();
 };
 
 } // namespace Dashboard
@@ -428,6 +428,14 @@ auto SilKitToOatppMapper::CreateMetricsUpdateDto(
             dto->statistics->emplace_back(std::move(dataDto));
             break;
         }
+        case VSilKit::MetricKind::HISTOGRAM:
+        {
+            auto dataDto = HistogramDataDto::createShared();
+            setValues(dataDto, metricData);
+            dataDto->mv = objectMapper->readFromString<oatpp::Vector<oatpp::Int64>>(metricData.value);
+            dto->histograms->emplace_back(std::move(dataDto));
+            break;
+        }
         case VSilKit::MetricKind::ATTRIBUTE:
         case VSilKit::MetricKind::STRING_LIST:
         {
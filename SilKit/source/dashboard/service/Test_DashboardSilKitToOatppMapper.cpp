@@ -456,5 +456,37 @@ TEST_F(Test_DashboardSilKitToOatppMapper, CreateBulkSimulationDto)
     ASSERT_NE(cParticipantDto.getPtr(), nullptr);
 }
 
+
+TEST_F(Test_DashboardSilKitToOatppMapper, CreateMetricsUpdateDto_MapHistogram)
+{
+    // Arrange
+    VSilKit::MetricsUpdate metricsUpdate;
+    metricsUpdate.metrics.emplace_back(
+        VSilKit::MetricData{1234, "Link/Latency", VSilKit::MetricKind::HISTOGRAM, "[10,200,900,950,1000]"});
+
+    // Act
+    const auto dataMapper = CreateService();
+    const auto dto = dataMapper->CreateMetricsUpdateDto("A", metricsUpdate);
+
+    // Assert
+    ASSERT_EQ(dto->attributes->size(), 0u);
+    ASSERT_EQ(dto->counters->size(), 0u);
+    ASSERT_EQ(dto->statistics->size(), 0u);
+    ASSERT_EQ(dto->histograms->size(), 1u);
+
+    const auto& histogramDto = dto->histograms[0];
+    ASSERT_EQ(histogramDto->pn, "A");
+    ASSERT_EQ(histogramDto->ts, 1234);
+    ASSERT_EQ(histogramDto->mn->size(), 2u);
+    ASSERT_EQ(histogramDto->mn[0], "Link");
+    ASSERT_EQ(histogramDto->mn[1], "Latency");
+    ASSERT_EQ(histogramDto->mv->size(), 5u);
+    ASSERT_EQ(histogramDto->mv[0], 10);
+    ASSERT_EQ(histogramDto->mv[1], 200);
+    ASSERT_EQ(histogramDto->mv[2], 900);
+    ASSERT_EQ(histogramDto->mv[3], 950);
+    ASSERT_EQ(histogramDto->mv[4], 1000);
+}
+
 } // namespace Dashboard
 } // namespace SilKit
@@ -26,6 +26,13 @@ void RemoveOtherSimulationStepsCompletedHandler(SilKit::Services::Orchestration:
     timeSyncService->RemoveOtherSimulationStepsCompletedHandler(handlerId);
 }
 
+void SetLookahead(SilKit::Services::Orchestration::ITimeSyncService* iTimeSyncService,
+                  std::chrono::nanoseconds lookahead)
+{
+    const auto timeSyncService = static_cast<SilKit::Services::Orchestration::TimeSyncService*>(iTimeSyncService);
+    timeSyncService->SetLookahead(lookahead);
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace Experimental
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 
 #include <cstdint>
@@ -33,6 +34,9 @@ auto AddOtherSimulationStepsCompletedHandler(SilKit::Services::Orchestration::IT
 void RemoveOtherSimulationStepsCompletedHandler(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService,
                                                 SilKit::Util::HandlerId handlerId);
 
+void SetLookahead(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService,
+                  std::chrono::nanoseconds lookahead);
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace Experimental
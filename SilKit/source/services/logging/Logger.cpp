@@ -2,13 +2,19 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "services/logging/Logger.hpp"
 
+#include "util/MpscRingBuffer.hpp"
+#include "util/SetThreadName.hpp"
 #include "util/StringHelpers.hpp"
 
 #include "fmt/chrono.h"
@@ -226,6 +232,35 @@ namespace Logging {
 
 
 namespace {
+
+auto FormatStringForSink(Config::Sink::Format format, Topic topic, const std::string& msg) -> std::string
+{
+    if (format == Config::Sink::Format::Json)
+    {
+        JsonString jsonString{msg, topic};
+        return fmt::format("{}", jsonString);
+    }
+    else
+    {
+        return fmt::format("[{}] {}", to_string(topic), msg);
+    }
+}
+
+auto FormatMessageForSink(Config::Sink::Format format, Topic topic, const std::string& msg,
+                          const std::vector<std::pair<std::string, std::string>>& keyValues) -> std::string
+{
+    if (format == Config::Sink::Format::Json)
+    {
+        JsonLogMessage myJsonMsg{msg, keyValues, topic};
+        return fmt::format("{}", myJsonMsg);
+    }
+    else
+    {
+        SimpleLogMessage myMsg{msg, keyValues, topic};
+        return fmt::format("{}", myMsg);
+    }
+}
+
 class SilKitRemoteSink : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
 {
 public:
@@ -261,6 +296,155 @@ private:
 } // anonymous namespace
 
 
+// A record for the stdout and file sinks, formatted by the AsyncWriter thread
+struct Logger::AsyncRecord
+{
+    enum class Kind : uint8_t
+    {
+        String,   // Logger::Log
+        Message,  // Logger::ProcessLoggerMessage
+        Received, // Logger::LogReceivedMsg
+    };
+
+    Kind kind{Kind::String};
+    LogMsg msg;
+};
+
+// Writes the queued records to the stdout and file sinks on a background thread. The queue is lock-free for the
+// logging threads; the mutex is only taken to wake up the writer, or producers blocked on a full queue.
+class Logger::AsyncWriter
+{
+public:
+    AsyncWriter(Logger& logger, const Config::AsyncLogging& config)
+        : _logger{logger}
+        , _overflowPolicy{config.overflowPolicy}
+        , _queue{config.queueSize}
+    {
+        _thread = std::thread{[this] { Run(); }};
+    }
+
+    ~AsyncWriter()
+    {
+        {
+            std::lock_guard<decltype(_mutex)> lock{_mutex};
+            _stopRequested = true;
+        }
+        _recordsAvailable.notify_one();
+        _thread.join();
+    }
+
+    void Push(AsyncRecord record)
+    {
+        if (!_queue.TryPush(std::move(record)))
+        {
+            if (_overflowPolicy == Config::AsyncLogging::OverflowPolicy::Drop)
+            {
+                _numberOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _numberOfBlockedProducers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            _spaceAvailable.wait(lock, [this, &record] { return _queue.TryPush(std::move(record)); });
+            _numberOfBlockedProducers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // pairs with the fence in Run: either the writer sees the record before it sleeps, or this sees it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_writerSleeping.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<decltype(_mutex)> lock{_mutex};
+            _recordsAvailable.notify_one();
+        }
+    }
+
+    auto GetNumberOfDroppedRecords() const -> uint64_t
+    {
+        return _numberOfDroppedRecords.load(std::memory_order_relaxed);
+    }
+
+private:
+    void Run()
+    {
+        SilKit::Util::SetThreadName("SK-Logging");
+
+        AsyncRecord record;
+        while (true)
+        {
+            if (!_queue.TryPop(record))
+            {
+                WriteDroppedRecordsWarning();
+
+                std::unique_lock<decltype(_mutex)> lock{_mutex};
+                _writerSleeping.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                bool popped{false};
+                _recordsAvailable.wait(lock, [this, &record, &popped] {
+                    popped = _queue.TryPop(record);
+                    return popped || _stopRequested;
+                });
+                _writerSleeping.store(false, std::memory_order_relaxed);
+
+                // the queue is drained completely before stopping
+                if (!popped)
+                {
+                    return;
+                }
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_numberOfBlockedProducers.load(std::memory_order_relaxed) != 0)
+            {
+                {
+                    std::lock_guard<decltype(_mutex)> lock{_mutex};
+                }
+                _spaceAvailable.notify_all();
+            }
+
+            _logger.WriteAsyncRecord(record);
+        }
+    }
+
+    void WriteDroppedRecordsWarning()
+    {
+        const auto numberOfDroppedRecords = GetNumberOfDroppedRecords();
+        if (numberOfDroppedRecords == _numberOfReportedDroppedRecords)
+        {
+            return;
+        }
+
+        AsyncRecord warning;
+        warning.kind = AsyncRecord::Kind::Message;
+        warning.msg.time = log_clock::now();
+        warning.msg.level = Level::Warn;
+        warning.msg.payload = fmt::format("{} log records were dropped, because the logging queue was full",
+                                          numberOfDroppedRecords - _numberOfReportedDroppedRecords);
+        _logger.WriteAsyncRecord(warning);
+
+        _numberOfReportedDroppedRecords = numberOfDroppedRecords;
+    }
+
+private:
+    Logger& _logger;
+    Config::AsyncLogging::OverflowPolicy _overflowPolicy;
+    Util::MpscRingBuffer<AsyncRecord> _queue;
+
+    std::mutex _mutex;
+    std::condition_variable _recordsAvailable;
+    std::condition_variable _spaceAvailable;
+    bool _stopRequested{false};
+    std::atomic<bool> _writerSleeping{false};
+    std::atomic<std::size_t> _numberOfBlockedProducers{0};
+
+    std::atomic<uint64_t> _numberOfDroppedRecords{0};
+    uint64_t _numberOfReportedDroppedRecords{0};
+
+    std::thread _thread;
+};
+
+
 Logger::Logger(const std::string& participantName, Config::Logging config)
     : _config{std::move(config)}
 {
@@ -356,11 +540,28 @@ Logger::Logger(const std::string& participantName, Config::Logging config)
     {
         pair.first->flush_on(to_spdlog(_config.flushLevel));
     }
+
+    // the sinks and their levels are fixed from here on
+    _logLevel = ComputeLogLevel();
+
+    if (_config.async.queueSize > 0 && !_spdlogLogger.empty())
+    {
+        _asyncWriter = std::make_unique<AsyncWriter>(*this, _config.async);
+    }
 }
 
+Logger::~Logger() = default;
+
 void Logger::DispatchToSinks(log_clock::time_point now, Level level, Topic topic,
                              const std::function<std::string(Config::Sink::Format)>& formatter,
                              const std::function<void(const std::shared_ptr<RemoteLogger>&, log_clock::time_point)>& remoteDispatcher)
+{
+    DispatchToLocalSinks(now, level, topic, formatter);
+    DispatchToRemoteSinks(now, level, topic, formatter, remoteDispatcher);
+}
+
+void Logger::DispatchToLocalSinks(log_clock::time_point now, Level level, Topic topic,
+                                  const std::function<std::string(Config::Sink::Format)>& formatter)
 {
     for (const auto& pair : _spdlogLogger)
     {
@@ -377,7 +578,12 @@ void Logger::DispatchToSinks(log_clock::time_point now, Level level, Topic topic
         auto formatted = formatter(pair.second.format);
         pair.first->log(now, spdlog::source_loc{}, to_spdlog(level), formatted);
     }
+}
 
+void Logger::DispatchToRemoteSinks(log_clock::time_point now, Level level, Topic topic,
+                                   const std::function<std::string(Config::Sink::Format)>& formatter,
+                                   const std::function<void(const std::shared_ptr<RemoteLogger>&, log_clock::time_point)>& remoteDispatcher)
+{
     for (const auto& pair : _remoteLogger)
     {
         if (!IsLevelMatching(pair.second.level, level))
@@ -401,29 +607,66 @@ void Logger::DispatchToSinks(log_clock::time_point now, Level level, Topic topic
     }
 }
 
+bool Logger::IsAnyLocalSinkMatching(Level level, Topic topic) const
+{
+    for (const auto& pair : _spdlogLogger)
+    {
+        if (IsLevelMatching(pair.second.level, level)
+            && !IsTopicDisabled(pair.second.enabledTopics, pair.second.disabledTopics, topic))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Logger::ProcessLoggerMessage(const LoggerMessage& msg)
 {
     const auto now = log_clock::now();
 
-    DispatchToSinks(now, msg.GetLevel(), msg.GetTopic(),
-        [&msg](Config::Sink::Format format) -> std::string {
-            if (format == Config::Sink::Format::Json)
-            {
-                JsonLogMessage myJsonMsg{msg.GetMsgString(), msg.GetKeyValues(), msg.GetTopic()};
-                return fmt::format("{}", myJsonMsg);
-            }
-            else
-            {
-                SimpleLogMessage myMsg{msg.GetMsgString(), msg.GetKeyValues(), msg.GetTopic()};
-                return fmt::format("{}", myMsg);
-            }
-        },
-        [&msg](const std::shared_ptr<RemoteLogger>& remote, log_clock::time_point tp) {
-            remote->Log(tp, msg);
-        });
+    const auto formatter = [&msg](Config::Sink::Format format) -> std::string {
+        return FormatMessageForSink(format, msg.GetTopic(), msg.GetMsgString(), msg.GetKeyValues());
+    };
+    const auto remoteDispatcher = [&msg](const std::shared_ptr<RemoteLogger>& remote, log_clock::time_point tp) {
+        remote->Log(tp, msg);
+    };
+
+    if (_asyncWriter == nullptr)
+    {
+        DispatchToSinks(now, msg.GetLevel(), msg.GetTopic(), formatter, remoteDispatcher);
+        return;
+    }
+
+    // the remote sinks only hand the message over to the IO thread, they are served on the calling thread
+    DispatchToRemoteSinks(now, msg.GetLevel(), msg.GetTopic(), formatter, remoteDispatcher);
+    if (IsAnyLocalSinkMatching(msg.GetLevel(), msg.GetTopic()))
+    {
+        AsyncRecord record;
+        record.kind = AsyncRecord::Kind::Message;
+        record.msg.time = now;
+        record.msg.level = msg.GetLevel();
+        record.msg.topic = msg.GetTopic();
+        record.msg.payload = msg.GetMsgString();
+        record.msg.keyValues = msg.GetKeyValues();
+        _asyncWriter->Push(std::move(record));
+    }
 }
 
 void Logger::LogReceivedMsg(const LogMsg& msg)
+{
+    if (_asyncWriter == nullptr)
+    {
+        WriteReceivedMsg(msg);
+        return;
+    }
+
+    AsyncRecord record;
+    record.kind = AsyncRecord::Kind::Received;
+    record.msg = msg;
+    _asyncWriter->Push(std::move(record));
+}
+
+void Logger::WriteReceivedMsg(const LogMsg& msg)
 {
     for (const auto& pair : _spdlogLogger)
     {
@@ -470,17 +713,54 @@ void Logger::Log(Level level, Topic topic, const std::string& msg)
 {
     const auto now = log_clock::now();
 
-    DispatchToSinks(now, level, topic, [&msg, topic](Config::Sink::Format format) -> std::string {
-        if (format == Config::Sink::Format::Json)
-        {
-            JsonString jsonString{msg, topic};
-            return fmt::format("{}", jsonString);
-        }
-        else
-        {
-            return fmt::format("[{}] {}", to_string(topic), msg);
-        }
-    });
+    const auto formatter = [&msg, topic](Config::Sink::Format format) -> std::string {
+        return FormatStringForSink(format, topic, msg);
+    };
+
+    if (_asyncWriter == nullptr)
+    {
+        DispatchToSinks(now, level, topic, formatter);
+        return;
+    }
+
+    DispatchToRemoteSinks(now, level, topic, formatter, nullptr);
+    if (IsAnyLocalSinkMatching(level, topic))
+    {
+        AsyncRecord record;
+        record.kind = AsyncRecord::Kind::String;
+        record.msg.time = now;
+        record.msg.level = level;
+        record.msg.topic = topic;
+        record.msg.payload = msg;
+        _asyncWriter->Push(std::move(record));
+    }
+}
+
+void Logger::WriteAsyncRecord(const AsyncRecord& record)
+{
+    const auto& msg = record.msg;
+
+    switch (record.kind)
+    {
+    case AsyncRecord::Kind::String:
+        DispatchToLocalSinks(msg.time, msg.level, msg.topic, [&msg](Config::Sink::Format format) -> std::string {
+            return FormatStringForSink(format, msg.topic, msg.payload);
+        });
+        break;
+    case AsyncRecord::Kind::Message:
+        DispatchToLocalSinks(msg.time, msg.level, msg.topic, [&msg](Config::Sink::Format format) -> std::string {
+            return FormatMessageForSink(format, msg.topic, msg.payload, msg.keyValues);
+        });
+        break;
+    case AsyncRecord::Kind::Received:
+        WriteReceivedMsg(msg);
+        break;
+    }
+}
+
+auto Logger::GetNumberOfDroppedRecords() const -> uint64_t
+{
+    return _asyncWriter == nullptr ? 0 : _asyncWriter->GetNumberOfDroppedRecords();
 }
 
 
@@ -501,6 +781,11 @@ void Logger::DisableRemoteLogging()
 }
 
 Level Logger::GetLogLevel() const
+{
+    return _logLevel;
+}
+
+Level Logger::ComputeLogLevel() const
 {
     auto lvl = to_spdlog(Level::Critical);
 
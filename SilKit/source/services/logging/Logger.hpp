@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <functional>
 
@@ -135,6 +136,7 @@ public:
     // ----------------------------------------
     // Constructors and Destructor
     Logger(const std::string& participantName, Config::Logging config);
+    ~Logger();
 
 
     ILogger* AsILogger() override 
@@ -198,16 +200,35 @@ public:
 
     void LogReceivedMsg(const LogMsg& msg) override;
 
+    //! Number of records that were dropped, because the queue of the asynchronous logging was full
+    auto GetNumberOfDroppedRecords() const -> uint64_t;
+
 private:
+    struct AsyncRecord;
+    class AsyncWriter;
+
     // Private members
     Config::Logging _config;
     std::map<std::shared_ptr<spdlog::logger>, Config::Sink> _spdlogLogger;
     std::map<std::shared_ptr<RemoteLogger>, Config::Sink> _remoteLogger;
+    // lowest level of all sinks, queried for every log message and every traced message
+    Level _logLevel{Level::Off};
+    // writes the records of the stdout and file sinks if the asynchronous logging is enabled; must be destroyed first
+    std::unique_ptr<AsyncWriter> _asyncWriter;
 
     // Private methods
     void DispatchToSinks(log_clock::time_point now, Level level, Topic topic,
                          const std::function<std::string(Config::Sink::Format)>& formatter,
                          const std::function<void(const std::shared_ptr<RemoteLogger>&, log_clock::time_point)>& remoteDispatcher = nullptr);
+    void DispatchToLocalSinks(log_clock::time_point now, Level level, Topic topic,
+                              const std::function<std::string(Config::Sink::Format)>& formatter);
+    void DispatchToRemoteSinks(log_clock::time_point now, Level level, Topic topic,
+                               const std::function<std::string(Config::Sink::Format)>& formatter,
+                               const std::function<void(const std::shared_ptr<RemoteLogger>&, log_clock::time_point)>& remoteDispatcher);
+    bool IsAnyLocalSinkMatching(Level level, Topic topic) const;
+    auto ComputeLogLevel() const -> Level;
+    void WriteReceivedMsg(const LogMsg& msg);
+    void WriteAsyncRecord(const AsyncRecord& record);
 
     bool IsTopicEnabled(const std::vector<Services::Logging::Topic>& enabledTopics,
                         const std::vector<Services::Logging::Topic>& disabledTopics,
@@ -12,18 +12,35 @@
 
 #include "config/YamlParser.hpp"
 
+// Message tracing can be compiled out completely with the CMake option SILKIT_ENABLE_MESSAGE_TRACING=OFF
+#ifndef SILKIT_ENABLE_MESSAGE_TRACING
+#define SILKIT_ENABLE_MESSAGE_TRACING 1
+#endif
+
 
 namespace SilKit {
 namespace Services {
 
+//! \brief True if sent and received messages are traced by the logger. The log level of a logger does not change after
+//!        its creation, so callers on hot paths can evaluate this once and keep the result.
+inline bool IsMessageTracingEnabled(Logging::ILoggerInternal* logger)
+{
+#if SILKIT_ENABLE_MESSAGE_TRACING
+    return logger != nullptr && logger->GetLogLevel() == Logging::Level::Trace;
+#else
+    SILKIT_UNUSED_ARG(logger);
+    return false;
+#endif
+}
+
 namespace Detail {
 template <class SilKitMessageT>
 void TraceMessageCommon(Logging::ILoggerInternal* logger, const char* messageString, const Core::IServiceEndpoint* addr,
                         const SilKitMessageT& msg, std::string_view keyString = {}, std::string_view valueString = {})
 {
-    if constexpr (std::is_same_v<SilKitMessageT, SilKit::Services::Logging::LogMsg>)
+    if constexpr (std::is_same_v<SilKitMessageT, SilKit::Services::Logging::LogMsg> || !SILKIT_ENABLE_MESSAGE_TRACING)
     {
-        // Don't trace LogMessages - this could cause cycles!
+        // Don't trace LogMessages - this could cause cycles! Also used if message tracing is compiled out.
         SILKIT_UNUSED_ARG(logger);
         SILKIT_UNUSED_ARG(messageString);
         SILKIT_UNUSED_ARG(addr);
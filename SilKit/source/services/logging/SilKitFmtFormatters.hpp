@@ -105,7 +105,9 @@ MAKE_FORMATTER(SilKit::Config::V1::Label);
 MAKE_FORMATTER(SilKit::Core::ServiceDescriptor);
 MAKE_FORMATTER(SilKit::Core::ProtocolVersion);
 MAKE_FORMATTER(SilKit::Core::Discovery::ParticipantDiscoveryEvent);
+MAKE_FORMATTER(SilKit::Core::Discovery::CompactParticipantDiscoveryEvent);
 MAKE_FORMATTER(SilKit::Core::Discovery::ServiceDiscoveryEvent);
 MAKE_FORMATTER(SilKit::Core::Tests::TestMessage);
+MAKE_FORMATTER(SilKit::Core::Tests::TestFrameEvent);
 MAKE_FORMATTER(SilKit::Core::RequestReply::RequestReplyCall);
 MAKE_FORMATTER(SilKit::Core::RequestReply::RequestReplyCallReturn);
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <string>
 
@@ -61,6 +63,55 @@ auto ALogMsgWith(std::string loggerName, Level level, Topic topic, std::string p
                  Field(&LogMsg::payload, payload), Field(&LogMsg::keyValues, keyValues));
 }
 
+// The file sinks append the participant name and a timestamp to the log name, so the files are found by their prefix
+auto FindLogFiles(const std::string& logName) -> std::vector<std::filesystem::path>
+{
+    const auto prefix = logName + "_";
+
+    std::vector<std::filesystem::path> logFiles;
+    for (const auto& entry : std::filesystem::directory_iterator{std::filesystem::current_path()})
+    {
+        if (entry.is_regular_file() && entry.path().filename().string().compare(0, prefix.size(), prefix) == 0)
+        {
+            logFiles.push_back(entry.path());
+        }
+    }
+    return logFiles;
+}
+
+auto ReadAndRemoveLogFile(const std::string& logName) -> std::vector<std::string>
+{
+    std::vector<std::string> lines;
+    for (const auto& logFile : FindLogFiles(logName))
+    {
+        {
+            std::ifstream stream{logFile};
+            for (std::string line; std::getline(stream, line);)
+            {
+                lines.push_back(line);
+            }
+        }
+        std::error_code ec;
+        std::filesystem::remove(logFile, ec);
+    }
+    return lines;
+}
+
+auto MakeAsyncFileLoggingConfig(const std::string& logName, size_t queueSize,
+                                Config::AsyncLogging::OverflowPolicy overflowPolicy) -> Config::Logging
+{
+    Config::Logging config;
+    auto sink = Config::Sink{};
+    sink.level = Level::Trace;
+    sink.type = Config::Sink::Type::File;
+    sink.format = Config::Sink::Format::Simple;
+    sink.logName = logName;
+    config.sinks.push_back(sink);
+    config.async.queueSize = queueSize;
+    config.async.overflowPolicy = overflowPolicy;
+    return config;
+}
+
 TEST(Test_Logger, log_level_conversion)
 {
     Level in{Level::Critical};
@@ -249,4 +300,74 @@ TEST(Test_Logger, send_loggermessage_from_logger)
         .Dispatch();
 }
 
+TEST(Test_Logger, async_logging_writes_all_records_in_order_if_blocking)
+{
+    const std::string logName{"Test_Logger_AsyncBlock"};
+    ReadAndRemoveLogFile(logName);
+
+    {
+        Logger logger{"AsyncLogger", MakeAsyncFileLoggingConfig(logName, 4, Config::AsyncLogging::OverflowPolicy::Block)};
+        for (int i = 0; i < 1000; ++i)
+        {
+            logger.Debug("Record " + std::to_string(i));
+        }
+        logger.MakeMessage(Level::Info, Topic::None).SetMessage("Last record").AddKeyValue("Key", "Value").Dispatch();
+
+        EXPECT_EQ(logger.GetNumberOfDroppedRecords(), 0u);
+    }
+    // the logger writes all queued records before it is destroyed
+
+    const auto lines = ReadAndRemoveLogFile(logName);
+    ASSERT_EQ(lines.size(), 1001u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_THAT(lines[i], EndsWith("[User] Record " + std::to_string(i)));
+    }
+    EXPECT_THAT(lines.back(), EndsWith("Last record, Key: Value"));
+}
+
+TEST(Test_Logger, async_logging_counts_dropped_records)
+{
+    const std::string logName{"Test_Logger_AsyncDrop"};
+    ReadAndRemoveLogFile(logName);
+
+    constexpr int numberOfRecords{10000};
+    uint64_t numberOfDroppedRecords{0};
+    {
+        Logger logger{"AsyncLogger", MakeAsyncFileLoggingConfig(logName, 2, Config::AsyncLogging::OverflowPolicy::Drop)};
+        for (int i = 0; i < numberOfRecords; ++i)
+        {
+            logger.Debug("Record " + std::to_string(i));
+        }
+        numberOfDroppedRecords = logger.GetNumberOfDroppedRecords();
+    }
+
+    // every record is either written or counted as dropped
+    const auto lines = ReadAndRemoveLogFile(logName);
+    const auto numberOfWrittenRecords =
+        std::count_if(lines.begin(), lines.end(), [](const std::string& line) { return line.find("Record ") != std::string::npos; });
+    EXPECT_EQ(static_cast<uint64_t>(numberOfWrittenRecords) + numberOfDroppedRecords, static_cast<uint64_t>(numberOfRecords));
+}
+
+TEST(Test_Logger, async_logging_serves_remote_sinks_on_the_calling_thread)
+{
+    std::string loggerName{"ParticipantAndLogger"};
+
+    Config::Logging config;
+    auto sink1 = Config::Sink{};
+    sink1.level = Level::Debug;
+    sink1.type = Config::Sink::Type::Remote;
+    config.sinks.push_back(sink1);
+    config.async.queueSize = 16;
+
+    Logger logger{loggerName, config};
+
+    std::vector<LogMsg> sentMessages;
+    logger.RegisterRemoteLogging([&sentMessages](LogMsg logMsg) { sentMessages.push_back(std::move(logMsg)); });
+
+    logger.Info("Test log message");
+    ASSERT_EQ(sentMessages.size(), 1u);
+    EXPECT_THAT(sentMessages.front(), ALogMsgWith(loggerName, Level::Info, Topic::User, "[User] Test log message"));
+}
+
 } // anonymous namespace
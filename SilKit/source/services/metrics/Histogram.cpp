@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "services/metrics/Histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+auto MostSignificantBit(std::uint64_t value) -> unsigned
+{
+    unsigned result{0};
+    for (unsigned shift : {32u, 16u, 8u, 4u, 2u, 1u})
+    {
+        if (value >= (std::uint64_t{1} << shift))
+        {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+namespace VSilKit {
+
+void Histogram::Record(std::uint64_t value)
+{
+    // the histogram is written by a single thread, relaxed ordering is sufficient for consistent snapshots
+    _buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+
+    if (value > _maximum.load(std::memory_order_relaxed))
+    {
+        _maximum.store(value, std::memory_order_relaxed);
+    }
+}
+
+auto Histogram::GetCount() const -> std::uint64_t
+{
+    return _count.load(std::memory_order_relaxed);
+}
+
+auto Histogram::GetMaximum() const -> std::uint64_t
+{
+    return _maximum.load(std::memory_order_relaxed);
+}
+
+auto Histogram::GetValueAtPercentile(double percentile) const -> std::uint64_t
+{
+    const auto count = GetCount();
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(percentile, 0.0, 1.0) * count));
+    const auto targetRank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t cumulativeCount{0};
+    for (std::size_t bucketIndex = 0; bucketIndex != BucketCount; ++bucketIndex)
+    {
+        cumulativeCount += _buckets[bucketIndex].load(std::memory_order_relaxed);
+        if (cumulativeCount >= targetRank)
+        {
+            return std::min(GetBucketHighestValue(bucketIndex), GetMaximum());
+        }
+    }
+
+    // a concurrent Record updated the count before the bucket
+    return GetMaximum();
+}
+
+auto Histogram::GetBucketIndex(std::uint64_t value) -> std::size_t
+{
+    if (value < 2 * SubBucketCount)
+    {
+        return static_cast<std::size_t>(value);
+    }
+
+    // the top SubBucketBits + 1 bits of the value select the bucket, the remaining bits are dropped
+    const auto shift = MostSignificantBit(value) - SubBucketBits;
+    const auto subBucket = (value >> shift) - SubBucketCount;
+    return static_cast<std::size_t>(2 * SubBucketCount + (shift - 1) * SubBucketCount + subBucket);
+}
+
+auto Histogram::GetBucketLowestValue(std::size_t bucketIndex) -> std::uint64_t
+{
+    if (bucketIndex < 2 * SubBucketCount)
+    {
+        return bucketIndex;
+    }
+
+    const auto offset = bucketIndex - 2 * SubBucketCount;
+    const auto shift = offset / SubBucketCount + 1;
+    const auto subBucket = offset % SubBucketCount + SubBucketCount;
+    return std::uint64_t{subBucket} << shift;
+}
+
+auto Histogram::GetBucketHighestValue(std::size_t bucketIndex) -> std::uint64_t
+{
+    if (bucketIndex + 1 == BucketCount)
+    {
+        return UINT64_MAX;
+    }
+
+    return GetBucketLowestValue(bucketIndex + 1) - 1;
+}
+
+} // namespace VSilKit
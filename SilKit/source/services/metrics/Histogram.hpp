@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace VSilKit {
+
+//! \brief Histogram over the full uint64_t range with a bounded relative error (HDR-style log-linear buckets).
+//!
+//! Values below 2 * SubBucketCount are counted exactly. Above, every power-of-two range is split into SubBucketCount
+//! linear sub-buckets, which bounds the relative error of the reported values by 1 / SubBucketCount.
+//! Values are recorded by a single thread, which may run concurrently with threads reading the percentiles.
+class Histogram
+{
+public:
+    static constexpr unsigned SubBucketBits{5};
+    static constexpr std::uint64_t SubBucketCount{std::uint64_t{1} << SubBucketBits};
+    static constexpr std::size_t BucketCount{2 * SubBucketCount + (64 - SubBucketBits - 1) * SubBucketCount};
+
+public:
+    void Record(std::uint64_t value);
+
+    auto GetCount() const -> std::uint64_t;
+    auto GetMaximum() const -> std::uint64_t;
+    //! \brief Returns the highest value equivalent to the value at the given percentile (in [0, 1]), or zero if empty.
+    auto GetValueAtPercentile(double percentile) const -> std::uint64_t;
+
+    static auto GetBucketIndex(std::uint64_t value) -> std::size_t;
+    static auto GetBucketLowestValue(std::size_t bucketIndex) -> std::uint64_t;
+    static auto GetBucketHighestValue(std::size_t bucketIndex) -> std::uint64_t;
+
+private:
+    std::array<std::atomic<std::uint64_t>, BucketCount> _buckets{};
+    std::atomic<std::uint64_t> _count{0};
+    std::atomic<std::uint64_t> _maximum{0};
+};
+
+} // namespace VSilKit
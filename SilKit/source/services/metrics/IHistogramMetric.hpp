@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+
+namespace VSilKit {
+
+struct IHistogramMetric
+{
+    virtual ~IHistogramMetric() = default;
+    virtual void Take(std::uint64_t value) = 0;
+};
+
+} // namespace VSilKit
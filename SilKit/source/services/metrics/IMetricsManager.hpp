@@ -12,6 +12,7 @@ struct ICounterMetric;
 struct IStatisticMetric;
 struct IStringListMetric;
 struct IAttributeMetric;
+struct IHistogramMetric;
 
 
 struct IMetricsManager
@@ -22,6 +23,7 @@ struct IMetricsManager
     virtual auto GetStatistic(MetricName name) -> IStatisticMetric* = 0;
     virtual auto GetStringList(MetricName name) -> IStringListMetric* = 0;
     virtual auto GetAttribute(MetricName name) -> IAttributeMetric* = 0;
+    virtual auto GetHistogram(MetricName name) -> IHistogramMetric* = 0;
 };
 
 } // namespace VSilKit
\ No newline at end of file
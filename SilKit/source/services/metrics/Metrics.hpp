@@ -11,6 +11,7 @@
 #include "services/metrics/IStatisticMetric.hpp"
 #include "services/metrics/IStringListMetric.hpp"
 #include "services/metrics/IAttributeMetric.hpp"
+#include "services/metrics/IHistogramMetric.hpp"
 #include "services/metrics/IMetricsManager.hpp"
 #include "services/metrics/IMetricsSender.hpp"
 #include "services/metrics/IMetricsProcessor.hpp"
@@ -22,6 +23,7 @@ using VSilKit::ICounterMetric;
 using VSilKit::IStatisticMetric;
 using VSilKit::IStringListMetric;
 using VSilKit::IAttributeMetric;
+using VSilKit::IHistogramMetric;
 using VSilKit::IMetricsManager;
 using VSilKit::IMetricsProcessor;
 using VSilKit::IMetricsSender;
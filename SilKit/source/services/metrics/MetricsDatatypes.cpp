@@ -54,6 +54,8 @@ auto operator<<(std::ostream& os, const MetricKind& metricKind) -> std::ostream&
         return os << "MetricKind::STRING_LIST";
     case MetricKind::ATTRIBUTE:
         return os << "MetricKind::ATTRIBUTE";
+    case MetricKind::HISTOGRAM:
+        return os << "MetricKind::HISTOGRAM";
     default:
         return os << "MetricKind(" << static_cast<std::underlying_type_t<MetricKind>>(metricKind) << ")";
     }
@@ -26,6 +26,7 @@ enum struct MetricKind
     STATISTIC,
     STRING_LIST,
     ATTRIBUTE,
+    HISTOGRAM,
 };
 
 
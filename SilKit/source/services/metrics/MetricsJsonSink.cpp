@@ -26,6 +26,8 @@ struct MetricKindString
             return ostream << "STATISTIC";
         case VSilKit::MetricKind::STRING_LIST:
             return ostream << "STRING_LIST";
+        case VSilKit::MetricKind::HISTOGRAM:
+            return ostream << "HISTOGRAM";
         default:
             return ostream << static_cast<std::underlying_type_t<VSilKit::MetricKind>>(self.kind);
         }
@@ -6,6 +6,7 @@
 
 #include "util/Assert.hpp"
 #include "services/metrics/MetricsProcessor.hpp"
+#include "services/metrics/Histogram.hpp"
 
 #include <string>
 #include <sstream>
@@ -137,6 +138,27 @@ private:
 };
 
 
+class MetricsManager::HistogramMetric
+    : public IHistogramMetric
+    , public IMetric
+{
+public:
+    HistogramMetric();
+
+public: // IHistogramMetric
+    void Take(uint64_t value) override;
+
+public: // MetricsManager::IMetric
+    auto GetMetricKind() const -> MetricKind override;
+    auto GetUpdateTime() const -> MetricTimePoint override;
+    auto FormatValue() const -> std::string override;
+
+private:
+    MetricTimePoint _timestamp;
+    Histogram _histogram;
+};
+
+
 MetricsManager::MetricsManager(std::string participantName, IMetricsProcessor& processor)
     : _participantName{std::move(participantName)}
     , _processor{&processor}
@@ -212,6 +234,11 @@ auto MetricsManager::GetAttribute(MetricName name) -> IAttributeMetric*
     return &dynamic_cast<IAttributeMetric&>(*GetOrCreateMetric(name, MetricKind::ATTRIBUTE));
 }
 
+auto MetricsManager::GetHistogram(MetricName name) -> IHistogramMetric*
+{
+    return &dynamic_cast<IHistogramMetric&>(*GetOrCreateMetric(name, MetricKind::HISTOGRAM));
+}
+
 
 // MetricsManager
 
@@ -238,6 +265,9 @@ auto MetricsManager::GetOrCreateMetric(MetricName nameList, MetricKind kind) ->
         case MetricKind::ATTRIBUTE:
             it = _metrics.emplace(name, std::make_unique<AttributeMetric>()).first;
             break;
+        case MetricKind::HISTOGRAM:
+            it = _metrics.emplace(name, std::make_unique<HistogramMetric>()).first;
+            break;
         default:
             throw SilKit::SilKitError{fmt::format("Invalid MetricKind ({})", kind)};
         }
@@ -418,4 +448,32 @@ auto MetricsManager::AttributeMetric::FormatValue() const -> std::string
 }
 
 
+// HistogramMetric
+
+MetricsManager::HistogramMetric::HistogramMetric() = default;
+
+void MetricsManager::HistogramMetric::Take(uint64_t value)
+{
+    _timestamp = MetricClockNow();
+    _histogram.Record(value);
+}
+
+auto MetricsManager::HistogramMetric::GetMetricKind() const -> MetricKind
+{
+    return MetricKind::HISTOGRAM;
+}
+
+auto MetricsManager::HistogramMetric::GetUpdateTime() const -> MetricTimePoint
+{
+    return _timestamp;
+}
+
+auto MetricsManager::HistogramMetric::FormatValue() const -> std::string
+{
+    return fmt::format(R"([{},{},{},{},{}])", _histogram.GetCount(), _histogram.GetValueAtPercentile(0.5),
+                       _histogram.GetValueAtPercentile(0.99), _histogram.GetValueAtPercentile(0.999),
+                       _histogram.GetMaximum());
+}
+
+
 } // namespace VSilKit
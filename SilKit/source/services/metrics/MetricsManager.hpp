@@ -48,6 +48,7 @@ private:
     class StatisticMetric;
     class StringListMetric;
     class AttributeMetric;
+    class HistogramMetric;
 
 public:
     MetricsManager(std::string participantName, IMetricsProcessor& processor);
@@ -60,6 +61,7 @@ public: // IMetricsManager
     auto GetStatistic(MetricName name) -> IStatisticMetric* override;
     auto GetStringList(MetricName name) -> IStringListMetric* override;
     auto GetAttribute(MetricName name) -> IAttributeMetric* override;
+    auto GetHistogram(MetricName name) -> IHistogramMetric* override;
 
 private:
     auto GetOrCreateMetric(MetricName name, MetricKind kind) -> IMetric*;
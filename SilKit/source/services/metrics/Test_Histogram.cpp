@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+
+#include "services/metrics/Histogram.hpp"
+
+#include <cstdint>
+
+namespace {
+
+using VSilKit::Histogram;
+
+TEST(Test_Histogram, small_values_are_counted_exactly)
+{
+    for (std::uint64_t value = 0; value != 2 * Histogram::SubBucketCount; ++value)
+    {
+        const auto bucketIndex = Histogram::GetBucketIndex(value);
+        ASSERT_EQ(Histogram::GetBucketLowestValue(bucketIndex), value);
+        ASSERT_EQ(Histogram::GetBucketHighestValue(bucketIndex), value);
+    }
+}
+
+TEST(Test_Histogram, buckets_cover_the_full_range_with_bounded_relative_error)
+{
+    ASSERT_EQ(Histogram::GetBucketIndex(UINT64_MAX), Histogram::BucketCount - 1);
+    ASSERT_EQ(Histogram::GetBucketHighestValue(Histogram::BucketCount - 1), UINT64_MAX);
+
+    for (std::size_t bucketIndex = 0; bucketIndex + 1 != Histogram::BucketCount; ++bucketIndex)
+    {
+        const auto lowest = Histogram::GetBucketLowestValue(bucketIndex);
+        const auto highest = Histogram::GetBucketHighestValue(bucketIndex);
+
+        // adjacent buckets must neither overlap nor leave gaps
+        ASSERT_EQ(highest + 1, Histogram::GetBucketLowestValue(bucketIndex + 1));
+        ASSERT_EQ(Histogram::GetBucketIndex(lowest), bucketIndex);
+        ASSERT_EQ(Histogram::GetBucketIndex(highest), bucketIndex);
+        ASSERT_LE(highest - lowest, lowest / Histogram::SubBucketCount);
+    }
+}
+
+TEST(Test_Histogram, empty_histogram_reports_zero)
+{
+    Histogram histogram;
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetMaximum(), 0u);
+    EXPECT_EQ(histogram.GetValueAtPercentile(0.5), 0u);
+}
+
+TEST(Test_Histogram, percentiles_expose_the_tail)
+{
+    Histogram histogram;
+
+    // 990 fast values and 10 outliers, which vanish in the mean but dominate the p99.9
+    for (std::uint64_t i = 0; i != 990; ++i)
+    {
+        histogram.Record(1'000 + i);
+    }
+    for (std::uint64_t i = 0; i != 10; ++i)
+    {
+        histogram.Record(1'000'000);
+    }
+
+    EXPECT_EQ(histogram.GetCount(), 1000u);
+    EXPECT_EQ(histogram.GetMaximum(), 1'000'000u);
+
+    const auto p50 = histogram.GetValueAtPercentile(0.5);
+    EXPECT_GE(p50, 1'499u);
+    EXPECT_LE(p50, 1'499u + 1'499u / Histogram::SubBucketCount);
+
+    const auto p99 = histogram.GetValueAtPercentile(0.99);
+    EXPECT_GE(p99, 1'989u);
+    EXPECT_LE(p99, 1'989u + 1'989u / Histogram::SubBucketCount);
+
+    EXPECT_EQ(histogram.GetValueAtPercentile(0.999), 1'000'000u);
+    EXPECT_EQ(histogram.GetValueAtPercentile(1.0), 1'000'000u);
+}
+
+} // anonymous namespace
@@ -43,6 +43,13 @@ static bool read(const ryml::ConstNodeRef& node, MetricData* obj)
         node["mv"] >> stringList;
         obj->value = SilKit::Config::SerializeAsJson(stringList);
     }
+    else if (kind == "HISTOGRAM")
+    {
+        obj->kind = MetricKind::HISTOGRAM;
+        std::vector<std::string> histogram;
+        node["mv"] >> histogram;
+        obj->value = SilKit::Config::SerializeAsJson(histogram);
+    }
     else if (kind == "ATTRIBUTE")
     {
         obj->kind = MetricKind::ATTRIBUTE;
@@ -92,6 +99,11 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
     const auto mk4 = MetricKind::ATTRIBUTE;
     const std::string mv4{"Attribute\tValue\nWith\"Special\\Characters"};
 
+    const MetricTimestamp ts5{5};
+    const std::string mn5{"Metric\rName\n5"};
+    const auto mk5 = MetricKind::HISTOGRAM;
+    const std::string mv5{"[1000,10,20,30,40]"};
+
 
     MetricsUpdate update;
     update.metrics.emplace_back(MetricData{
@@ -118,6 +130,12 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
         mk4,
         mv4,
     });
+    update.metrics.emplace_back(MetricData{
+        ts5,
+        mn5,
+        mk5,
+        mv5,
+    });
 
     auto ownedOstream = std::make_unique<std::ostringstream>();
     auto& ostream = *ownedOstream;
@@ -146,7 +164,7 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
 
     // checks
 
-    ASSERT_EQ(nodes.size(), 4u);
+    ASSERT_EQ(nodes.size(), 5u);
 
     ASSERT_EQ(nodes[0].timestamp, ts1);
     ASSERT_EQ(nodes[0].name, mn1);
@@ -167,6 +185,11 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
     ASSERT_EQ(nodes[3].name, mn4);
     ASSERT_EQ(nodes[3].kind, MetricKind::ATTRIBUTE);
     ASSERT_EQ(nodes[3].value, mv4);
+
+    ASSERT_EQ(nodes[4].timestamp, ts5);
+    ASSERT_EQ(nodes[4].name, mn5);
+    ASSERT_EQ(nodes[4].kind, MetricKind::HISTOGRAM);
+    ASSERT_EQ(nodes[4].value, mv5);
 }
 
 
@@ -148,4 +148,33 @@ TEST(Test_MetricsManager, attribute_metric_create_and_update_only_submits_after_
 }
 
 
+TEST(Test_MetricsManager, histogram_metric_create_and_update_only_submits_after_change)
+{
+    const std::string participantName{"Participant Name"};
+    const MetricName metricName{"Histogram Metric"};
+
+    MockMetricsProcessor mockMetricsProcessor;
+    EXPECT_CALL(mockMetricsProcessor, Process(participantName, MetricsUpdateWithSingleMetricWithNameAndKind(
+                                                                   metricName, MetricKind::HISTOGRAM)))
+        .WillOnce([](const std::string&, const MetricsUpdate& update) {
+        // count, p50, p99, p999, max
+        ASSERT_EQ(update.metrics.front().value, "[3,20,30,30,30]");
+    });
+
+    MetricsManager metricsManager{participantName, mockMetricsProcessor};
+    // no metrics to report, no Process call should be made
+    metricsManager.SubmitUpdates();
+
+    auto metric = metricsManager.GetHistogram(metricName);
+    // no metric value to report, no Process call should be made
+    metricsManager.SubmitUpdates();
+
+    metric->Take(10);
+    metric->Take(20);
+    metric->Take(30);
+    // metric value to report, single Process call
+    metricsManager.SubmitUpdates();
+}
+
+
 } // anonymous namespace
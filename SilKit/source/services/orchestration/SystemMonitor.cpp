@@ -30,6 +30,13 @@ void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/,
                                const Orchestration::WorkflowConfiguration& workflowConfiguration)
 {
     UpdateRequiredParticipantNames(workflowConfiguration.requiredParticipantNames);
+
+    // the states of all required participants are needed, even if they share no network with this participant
+    for (const auto& participantName : workflowConfiguration.requiredParticipantNames)
+    {
+        _participant->ConnectParticipantOnDemand(participantName);
+    }
+
     dynamic_cast<LifecycleService*>(_participant->GetLifecycleService())
         ->SetWorkflowConfiguration(workflowConfiguration);
 }
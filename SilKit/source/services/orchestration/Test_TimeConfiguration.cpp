@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "services/logging/MockLogger.hpp"
+#include "services/orchestration/TimeConfiguration.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace testing;
+
+using namespace SilKit::Services::Orchestration;
+
+auto MakeTask(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = duration;
+    return task;
+}
+
+class Test_TimeConfiguration : public testing::Test
+{
+protected:
+    NiceMock<SilKit::Services::Logging::MockLogger> logger;
+    TimeConfiguration timeConfiguration{&logger};
+};
+
+TEST_F(Test_TimeConfiguration, waits_for_the_participant_with_the_lowest_timepoint)
+{
+    timeConfiguration.SetStepDuration(1ms);
+    timeConfiguration.AddSynchronizedParticipant("P1");
+    timeConfiguration.AddSynchronizedParticipant("P2");
+    timeConfiguration.AddSynchronizedParticipant("P3");
+
+    timeConfiguration.OnReceiveNextSimStep("P1", MakeTask(0ms, 1ms));
+    timeConfiguration.OnReceiveNextSimStep("P2", MakeTask(0ms, 1ms));
+    timeConfiguration.OnReceiveNextSimStep("P3", MakeTask(0ms, 1ms));
+    ASSERT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.AdvanceTimeStep();
+    ASSERT_EQ(timeConfiguration.NextSimStep().timePoint, 1ms);
+    ASSERT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.OnReceiveNextSimStep("P1", MakeTask(1ms, 1ms));
+    timeConfiguration.OnReceiveNextSimStep("P3", MakeTask(1ms, 1ms));
+    ASSERT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.OnReceiveNextSimStep("P2", MakeTask(1ms, 1ms));
+    ASSERT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST_F(Test_TimeConfiguration, lookahead_allows_running_ahead_of_the_participant)
+{
+    timeConfiguration.SetStepDuration(1ms);
+    timeConfiguration.AddSynchronizedParticipant("Lookahead", TimeSyncRelation::Peer, 3ms);
+    timeConfiguration.AddSynchronizedParticipant("Lockstep");
+
+    // the initial time point of a participant is not extended by its lookahead
+    timeConfiguration.OnReceiveNextSimStep("Lockstep", MakeTask(10ms, 1ms));
+    ASSERT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    // steps at 0ms, 1ms, 2ms and 3ms can run before the participant with the lookahead advances
+    timeConfiguration.OnReceiveNextSimStep("Lookahead", MakeTask(0ms, 1ms));
+    for (auto step = 0; step < 4; ++step)
+    {
+        ASSERT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+        timeConfiguration.AdvanceTimeStep();
+    }
+    ASSERT_EQ(timeConfiguration.NextSimStep().timePoint, 4ms);
+    ASSERT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    timeConfiguration.OnReceiveNextSimStep("Lookahead", MakeTask(1ms, 1ms));
+    ASSERT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST_F(Test_TimeConfiguration, huge_lookahead_saturates_instead_of_overflowing)
+{
+    timeConfiguration.SetStepDuration(1ms);
+    timeConfiguration.AddSynchronizedParticipant("Lookahead", TimeSyncRelation::Peer,
+                                                 std::chrono::nanoseconds::max());
+
+    timeConfiguration.OnReceiveNextSimStep("Lookahead", MakeTask(5ms, 1ms));
+    for (auto step = 0; step < 10; ++step)
+    {
+        ASSERT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+        timeConfiguration.AdvanceTimeStep();
+    }
+}
+
+TEST_F(Test_TimeConfiguration, removed_participants_are_no_longer_waited_for)
+{
+    timeConfiguration.SetStepDuration(1ms);
+    timeConfiguration.AddSynchronizedParticipant("P1");
+    timeConfiguration.AddSynchronizedParticipant("P2");
+    timeConfiguration.OnReceiveNextSimStep("P1", MakeTask(5ms, 1ms));
+    timeConfiguration.OnReceiveNextSimStep("P2", MakeTask(0ms, 1ms));
+
+    timeConfiguration.AdvanceTimeStep();
+    ASSERT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+
+    ASSERT_TRUE(timeConfiguration.RemoveSynchronizedParticipant("P2"));
+    ASSERT_FALSE(timeConfiguration.RemoveSynchronizedParticipant("P2"));
+    ASSERT_FALSE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+    ASSERT_THAT(timeConfiguration.GetSynchronizedParticipantNames(), ElementsAre("P1"));
+
+    // the slot of a removed participant is reused and starts at the initial time again
+    timeConfiguration.AddSynchronizedParticipant("P3");
+    ASSERT_TRUE(timeConfiguration.OtherParticipantHasLowerTimepoint());
+    ASSERT_THAT(timeConfiguration.GetSynchronizedParticipantNames(), UnorderedElementsAre("P1", "P3"));
+}
+
+TEST_F(Test_TimeConfiguration, dynamic_step_is_aligned_to_the_earliest_other_step_boundary)
+{
+    timeConfiguration.SetStepDuration(10ms);
+    timeConfiguration.AddSynchronizedParticipant("P1");
+    timeConfiguration.AddSynchronizedParticipant("P2");
+    timeConfiguration.OnReceiveNextSimStep("P1", MakeTask(0ms, 3ms));
+    timeConfiguration.OnReceiveNextSimStep("P2", MakeTask(0ms, 7ms));
+
+    // boundaries received before enabling dynamic step sizes are taken into account
+    timeConfiguration.SetDynamicStepSizeEnabled(true);
+
+    timeConfiguration.AdvanceTimeStep();
+    ASSERT_EQ(timeConfiguration.CurrentSimStep().duration, 3ms);
+    ASSERT_EQ(timeConfiguration.NextSimStep().timePoint, 3ms);
+
+    timeConfiguration.OnReceiveNextSimStep("P1", MakeTask(3ms, 3ms));
+    timeConfiguration.AdvanceTimeStep();
+    ASSERT_EQ(timeConfiguration.CurrentSimStep().timePoint, 3ms);
+    ASSERT_EQ(timeConfiguration.CurrentSimStep().duration, 3ms);
+
+    // the end of P1's step is no longer a boundary once P1 is removed
+    ASSERT_TRUE(timeConfiguration.RemoveSynchronizedParticipant("P1"));
+    timeConfiguration.AdvanceTimeStep();
+    ASSERT_EQ(timeConfiguration.CurrentSimStep().timePoint, 6ms);
+    ASSERT_EQ(timeConfiguration.CurrentSimStep().duration, 1ms);
+}
+
+} // anonymous namespace
@@ -49,4 +49,27 @@ TEST(Test_TimeProvider, check_handlers)
     timeProvider.SetTime(2ms, 0ms); //implicitly invoke handler
     ASSERT_EQ(invocationCount, 1) << "Only the first SetTime should trigger the handler";
 }
+
+TEST(Test_TimeProvider, now_follows_the_configured_time_provider)
+{
+    TimeProvider timeProvider{};
+    ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+    ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+    timeProvider.SetTime(5ms, 1ms);
+    ASSERT_EQ(timeProvider.Now(), 5ms);
+
+    // the virtual time of a newly configured provider starts over
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::SyncTime);
+    ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::WallClock);
+    ASSERT_GT(timeProvider.Now(), 0ns);
+
+    // SetTime is ignored by providers without synchronized virtual time
+    timeProvider.ConfigureTimeProvider(TimeProviderKind::NoSync);
+    timeProvider.SetTime(10ms, 1ms);
+    ASSERT_EQ(timeProvider.Now(), std::chrono::nanoseconds::min());
+}
 } // namespace
@@ -40,6 +40,11 @@ public:
     MOCK_METHOD(void, SendMsg,
                 (const SilKit::Core::IServiceEndpoint* from, const SilKit::Services::Orchestration::NextSimTask& msg),
                 (override));
+    MOCK_METHOD(void, SendMsg,
+                (const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                 const SilKit::Services::Orchestration::NextSimTask& msg),
+                (override));
+    MOCK_METHOD(void, ExecuteDeferred, (std::function<void()> callback), (override));
 };
 
 
@@ -58,6 +63,14 @@ protected: // CTor
             .WillByDefault(
                 [this](const SilKit::Core::IServiceEndpoint* /* from */,
                        const Services::Orchestration::NextSimTask& msg) { sentNextSimTasks.emplace_back(msg); });
+        ON_CALL(participant, SendMsg(An<const SilKit::Core::IServiceEndpoint*>(), An<const std::string&>(),
+                                     An<const Services::Orchestration::NextSimTask&>()))
+            .WillByDefault([this](const SilKit::Core::IServiceEndpoint* /* from */, const std::string& target,
+                                  const Services::Orchestration::NextSimTask& msg) {
+            sentTargetedNextSimTasks.emplace_back(target, msg.timePoint);
+        });
+
+        ON_CALL(participant, ExecuteDeferred(_)).WillByDefault([](std::function<void()> callback) { callback(); });
 
         // this CTor calls CreateTimeSyncService implicitly
         lifecycleService = std::make_unique<LifecycleService>(&participant);
@@ -68,13 +81,16 @@ protected: // CTor
     }
 
 protected: // Methods
-    void PrepareLifecycle()
+    void PrepareLifecycle(bool addOtherParticipant = true)
     {
         lifecycleService->SetTimeSyncActive(true);
         (void)lifecycleService->StartLifecycle();
 
-        // Add other participant to lookup
-        timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1");
+        if (addOtherParticipant)
+        {
+            // Add other participant to lookup
+            timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1");
+        }
 
         // skip uninteresting states
         lifecycleService->NewSystemState(SystemState::ServicesCreated);
@@ -94,6 +110,7 @@ protected:
 
     std::vector<SilKit::Core::Discovery::ServiceDiscoveryHandler> serviceDiscoveryHandlers;
     std::vector<SilKit::Services::Orchestration::NextSimTask> sentNextSimTasks;
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> sentTargetedNextSimTasks;
 
     std::unique_ptr<LifecycleService> lifecycleService;
     TimeProvider timeProvider{};
@@ -133,6 +150,33 @@ TEST_F(Test_TimeSyncService, async_simtask_complete_lockstep)
         << "SimulationStepHandlerAsync should be called in lockstep with calls to CompleteSimulationStep().";
 }
 
+TEST_F(Test_TimeSyncService, async_simtask_unblocked_step_starts_directly_with_spin_wait_budget)
+{
+    participant._participantConfiguration.experimental.timeSynchronization.spinWaitBudget = 10us;
+    timeSyncService =
+        std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig, lifecycleService.get());
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    auto numAsyncTaskCalled{0};
+    timeSyncService->SetSimulationStepHandlerAsync([&](auto, auto) { numAsyncTaskCalled++; }, 1ms);
+
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+    ASSERT_EQ(numAsyncTaskCalled, 1);
+
+    // the next step is unblocked already when the current one is completed
+    timeSyncService->ReceiveMsg(&endpoint, {5ms});
+    ASSERT_EQ(numAsyncTaskCalled, 1);
+
+    // only the completion itself is handed to the IO thread
+    EXPECT_CALL(participant, ExecuteDeferred(_)).Times(1).WillOnce([](std::function<void()> callback) {
+        callback();
+    });
+    timeSyncService->CompleteSimulationStep();
+    ASSERT_EQ(numAsyncTaskCalled, 2);
+}
+
 TEST_F(Test_TimeSyncService, async_simtask_mismatching_number_of_complete_calls)
 {
     // What happens when the User calls CompleteSimulationStep() multiple times?
@@ -331,4 +375,107 @@ TEST_F(Test_TimeSyncService, dynamic_step_driver_enables_without_peers)
     EXPECT_TRUE(timeSyncService->GetTimeConfiguration()->IsDynamicStepSizeEnabled());
 }
 
+auto MakeTimeSyncDescriptor(const std::string& participantName, const std::string& aggregator)
+    -> SilKit::Core::ServiceDescriptor
+{
+    auto sd = MakeDynamicStepDescriptor(participantName, false);
+    sd.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncActive, "1");
+    sd.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncAggregator, aggregator);
+    return sd;
+}
+
+TEST_F(Test_TimeSyncService, hierarchical_sync_exchanges_aggregated_next_sim_tasks_with_parent_and_children)
+{
+    using SilKit::Core::Discovery::ServiceDiscoveryEvent;
+    using Tasks = std::vector<std::pair<std::string, std::chrono::nanoseconds>>;
+
+    // this participant ("MockParticipant") is aggregated by "Hub" and aggregates "C1" and "C2"
+    participant._participantConfiguration.experimental.timeSynchronization.aggregator = "Hub";
+    serviceDiscoveryHandlers.clear();
+    timeSyncService =
+        std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig, lifecycleService.get());
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    std::vector<std::chrono::nanoseconds> simTaskTimePoints;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto) { simTaskTimePoints.push_back(now); }, 1ms);
+
+    ASSERT_EQ(serviceDiscoveryHandlers.size(), 1u);
+    const std::vector<std::pair<std::string, std::string>> participantsAndAggregators{
+        {"Hub", ""}, {"C1", "MockParticipant"}, {"C2", "MockParticipant"}, {"Sibling", "Hub"}, {"Root2", ""}};
+    for (const auto& participantAndAggregator : participantsAndAggregators)
+    {
+        serviceDiscoveryHandlers[0](ServiceDiscoveryEvent::Type::ServiceCreated,
+                                    MakeTimeSyncDescriptor(participantAndAggregator.first,
+                                                           participantAndAggregator.second));
+    }
+
+    // the sibling and the other root are synchronized via the hub
+    auto* timeConfiguration = timeSyncService->GetTimeConfiguration();
+    ASSERT_TRUE(timeConfiguration->IsHierarchical());
+    ASSERT_THAT(timeConfiguration->GetSynchronizedParticipantNames(), UnorderedElementsAre("Hub", "C1", "C2"));
+
+    PrepareLifecycle(false);
+
+    NiceMock<MockServiceEndpoint> hub{"Hub", "N1", "TimeSyncService"};
+    NiceMock<MockServiceEndpoint> c1{"C1", "N1", "TimeSyncService"};
+    NiceMock<MockServiceEndpoint> c2{"C2", "N1", "TimeSyncService"};
+
+    // nothing is sent before the time point of a participant is known
+    timeSyncService->ReceiveMsg(&hub, {0ms, 1ms});
+    timeSyncService->ReceiveMsg(&c1, {0ms, 1ms});
+    ASSERT_EQ(sentTargetedNextSimTasks, (Tasks{{"C2", 0ms}}));
+    ASSERT_TRUE(simTaskTimePoints.empty());
+
+    // the hub gets the earliest time point of the subtree, and C1 everything except its own subtree
+    timeSyncService->ReceiveMsg(&c2, {0ms, 1ms});
+    ASSERT_EQ(sentTargetedNextSimTasks, (Tasks{{"C2", 0ms}, {"Hub", 0ms}, {"C1", 0ms}}));
+    ASSERT_EQ(simTaskTimePoints, (std::vector<std::chrono::nanoseconds>{0ms}));
+
+    // once C1 as the last one of the subtree reaches 1ms, only the hub is notified, the children still wait for it
+    sentTargetedNextSimTasks.clear();
+    timeSyncService->ReceiveMsg(&c2, {1ms, 1ms});
+    timeSyncService->ReceiveMsg(&c1, {1ms, 1ms});
+    ASSERT_EQ(sentTargetedNextSimTasks, (Tasks{{"Hub", 1ms}}));
+    ASSERT_EQ(simTaskTimePoints, (std::vector<std::chrono::nanoseconds>{0ms}));
+
+    // the hub reports that the rest of the simulation reached 1ms as well
+    sentTargetedNextSimTasks.clear();
+    timeSyncService->ReceiveMsg(&hub, {1ms, 1ms});
+    ASSERT_EQ(sentTargetedNextSimTasks, (Tasks{{"C1", 1ms}, {"C2", 1ms}}));
+    ASSERT_EQ(simTaskTimePoints, (std::vector<std::chrono::nanoseconds>{0ms, 1ms}));
+
+    // NextSimTasks are never broadcast
+    ASSERT_TRUE(sentNextSimTasks.empty());
+}
+
+TEST_F(Test_TimeSyncService, lookahead_of_a_peer_allows_running_several_steps_ahead)
+{
+    using SilKit::Core::Discovery::ServiceDiscoveryEvent;
+
+    std::vector<std::chrono::nanoseconds> simTaskTimePoints;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto) { simTaskTimePoints.push_back(now); }, 1ms);
+    timeSyncService->SetLookahead(2ms);
+
+    auto descriptor = MakeTimeSyncDescriptor("Bus", "");
+    descriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncLookahead, "3000000");
+    serviceDiscoveryHandlers[0](ServiceDiscoveryEvent::Type::ServiceCreated, descriptor);
+
+    PrepareLifecycle(false);
+
+    // the own lookahead is announced, and can no longer be changed
+    std::string announcedLookahead;
+    ASSERT_TRUE(timeSyncService->GetServiceDescriptor().GetSupplementalDataItem(
+        SilKit::Core::Discovery::timeSyncLookahead, announcedLookahead));
+    ASSERT_EQ(announcedLookahead, "2000000");
+    ASSERT_THROW(timeSyncService->SetLookahead(1ms), SilKit::StateError);
+
+    // a single NextSimTask of the peer allows the steps up to its time point plus its lookahead
+    NiceMock<MockServiceEndpoint> bus{"Bus", "N1", "TimeSyncService"};
+    timeSyncService->ReceiveMsg(&bus, {0ms, 1ms});
+    ASSERT_EQ(simTaskTimePoints, (std::vector<std::chrono::nanoseconds>{0ms, 1ms, 2ms, 3ms}));
+
+    timeSyncService->ReceiveMsg(&bus, {1ms, 1ms});
+    ASSERT_EQ(simTaskTimePoints.back(), 4ms);
+}
+
 } // namespace
@@ -32,15 +32,28 @@ bool TimeConfiguration::IsDynamicStepSizeEnabled() const
     return _dynamicStepSizeEnabled;
 }
 
+void TimeConfiguration::SetLookahead(std::chrono::nanoseconds lookahead)
+{
+    Lock lock{_mx};
+    _lookahead = lookahead;
+}
+
+auto TimeConfiguration::GetLookahead() const -> std::chrono::nanoseconds
+{
+    Lock lock{_mx};
+    return _lookahead;
+}
+
 void TimeConfiguration::SetBlockingMode(bool blocking)
 {
     _blocking = blocking;
 }
 
-void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName)
+void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                                   TimeSyncRelation relation, std::chrono::nanoseconds lookahead)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_slotByParticipantName.find(otherParticipantName) != _slotByParticipantName.end())
     {
         // ignore already known participants
         return;
@@ -48,26 +61,48 @@ void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParti
     NextSimTask task;
     task.timePoint = -1ns;
     task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+
+    std::size_t slot;
+    if (_freeSlots.empty())
+    {
+        slot = _otherParticipants.size();
+        _otherParticipants.push_back(OtherParticipant{otherParticipantName, task, relation, lookahead, std::nullopt});
+    }
+    else
+    {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        _otherParticipants[slot] = OtherParticipant{otherParticipantName, task, relation, lookahead, std::nullopt};
+    }
+
+    _slotByParticipantName.emplace(otherParticipantName, slot);
+    _otherTimePoints.Set(slot, task.timePoint);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    auto it = _slotByParticipantName.find(otherParticipantName);
+    if (it == _slotByParticipantName.end())
     {
-        _otherNextTasks.erase(it);
-        return true;
+        return false;
     }
-    return false;
+
+    const auto slot = it->second;
+    _slotByParticipantName.erase(it);
+    _otherTimePoints.Erase(slot);
+    _otherParticipants[slot].name.clear();
+    _freeSlots.push_back(slot);
+    return true;
 }
 
 auto TimeConfiguration::GetSynchronizedParticipantNames() -> std::vector<std::string>
 {
+    Lock lock{_mx};
     std::vector<std::string> participantNames;
-    for (const auto& it : _otherNextTasks)
+    participantNames.reserve(_slotByParticipantName.size());
+    for (const auto& it : _slotByParticipantName)
     {
         participantNames.push_back(it.first);
     }
@@ -78,8 +113,8 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 {
     Lock lock{_mx};
 
-    auto&& itOtherNextTask = _otherNextTasks.find(participantName);
-    if (itOtherNextTask == _otherNextTasks.end())
+    auto itSlot = _slotByParticipantName.find(participantName);
+    if (itSlot == _slotByParticipantName.end())
     {
         _logger->MakeMessage(Logging::Level::Error, TopicOf(*this))
             .SetMessage("Received NextSimTask from unknown participant {}", participantName)
@@ -87,24 +122,148 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
         return;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    const auto slot = itSlot->second;
+    auto& otherNextTask = _otherParticipants[slot].nextTask;
+    if (nextStep.timePoint < otherNextTask.timePoint)
     {
         _logger->MakeMessage(Logging::Level::Error, TopicOf(*this))
             .SetMessage("Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
                 "known timePoint {}",
-                participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count())
+                participantName, nextStep.timePoint.count(), otherNextTask.timePoint.count())
             .Dispatch();
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
+    otherNextTask = nextStep;
+    // the participant does not affect this participant before the end of its lookahead, which saturates instead of
+    // overflowing for a huge lookahead
+    const auto lookahead = _otherParticipants[slot].lookahead;
+    const auto maxTimePoint = std::chrono::nanoseconds::max();
+    _otherTimePoints.Set(slot, nextStep.timePoint > maxTimePoint - lookahead ? maxTimePoint
+                                                                              : nextStep.timePoint + lookahead);
 
     _logger->MakeMessage(Logging::Level::Debug, TopicOf(*this))
-        .SetMessage("Updated _otherNextTasks for participant {} with time {}", participantName,
-                    nextStep.timePoint.count())
+        .SetMessage("Updated next task of participant {} with time {}", participantName, nextStep.timePoint.count())
         .Dispatch();
 }
 
 
+void TimeConfiguration::SetAggregator(const std::string& aggregatorParticipantName)
+{
+    Lock lock{_mx};
+    _aggregator = aggregatorParticipantName;
+    if (!_aggregator.empty())
+    {
+        _hierarchical = true;
+    }
+}
+
+auto TimeConfiguration::GetAggregator() const -> std::string
+{
+    Lock lock{_mx};
+    return _aggregator;
+}
+
+void TimeConfiguration::SetHierarchical()
+{
+    Lock lock{_mx};
+    _hierarchical = true;
+}
+
+bool TimeConfiguration::IsHierarchical() const
+{
+    Lock lock{_mx};
+    return _hierarchical;
+}
+
+bool TimeConfiguration::OnReceiveAggregatedNextSimStep(const std::string& participantName, NextSimTask nextStep)
+{
+    Lock lock{_mx};
+
+    auto itSlot = _slotByParticipantName.find(participantName);
+    if (itSlot == _slotByParticipantName.end())
+    {
+        // participants that are neither parent, child, nor peer of this participant are synchronized via the hierarchy
+        return false;
+    }
+
+    const auto slot = itSlot->second;
+    _otherParticipants[slot].nextTask = nextStep;
+    _otherTimePoints.Set(slot, nextStep.timePoint);
+    return true;
+}
+
+auto TimeConfiguration::UpdateAggregatedNextSimTasks(const NextSimTask& ownNextTask) -> AggregatedNextSimTasks
+{
+    Lock lock{_mx};
+
+    // the earliest task of the subtree is sent to the parent and the peers. Each child gets the earliest task of
+    // everybody except its own subtree, which is the earliest of all tasks, or the second earliest for the child
+    // providing the earliest one.
+    NextSimTask subtreeTask = ownNextTask;
+    NextSimTask earliestTask = ownNextTask;
+    NextSimTask secondEarliestTask{std::chrono::nanoseconds::max(), 0ns};
+    auto earliestSlot = _otherParticipants.size();
+
+    for (std::size_t slot = 0; slot < _otherParticipants.size(); ++slot)
+    {
+        if (!_otherTimePoints.Contains(slot))
+        {
+            continue;
+        }
+        const auto& other = _otherParticipants[slot];
+
+        if (other.relation == TimeSyncRelation::Child && other.nextTask.timePoint < subtreeTask.timePoint)
+        {
+            subtreeTask = other.nextTask;
+        }
+
+        if (other.nextTask.timePoint < earliestTask.timePoint)
+        {
+            secondEarliestTask = earliestTask;
+            earliestTask = other.nextTask;
+            earliestSlot = slot;
+        }
+        else if (other.nextTask.timePoint < secondEarliestTask.timePoint)
+        {
+            secondEarliestTask = other.nextTask;
+        }
+    }
+
+    AggregatedNextSimTasks tasksToSend;
+    for (std::size_t slot = 0; slot < _otherParticipants.size(); ++slot)
+    {
+        if (!_otherTimePoints.Contains(slot))
+        {
+            continue;
+        }
+        auto& other = _otherParticipants[slot];
+
+        NextSimTask task = subtreeTask;
+        if (other.relation == TimeSyncRelation::Child)
+        {
+            task = (slot == earliestSlot) ? secondEarliestTask : earliestTask;
+        }
+
+        if (other.lastSentTask.has_value())
+        {
+            if (other.lastSentTask->timePoint == task.timePoint && other.lastSentTask->duration == task.duration)
+            {
+                continue;
+            }
+        }
+        else if (task.timePoint < 0ns)
+        {
+            // the receiver still has the initial time point of this participant
+            continue;
+        }
+
+        other.lastSentTask = task;
+        tasksToSend.emplace_back(other.name, task);
+    }
+
+    return tasksToSend;
+}
+
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 {
     Lock lock{_mx};
@@ -119,17 +278,25 @@ void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 
 auto TimeConfiguration::GetMinimalAlignedDuration() const -> std::chrono::nanoseconds
 {
-    if (_otherNextTasks.empty())
+    if (_slotByParticipantName.empty())
     {
         return std::chrono::nanoseconds::max();
     }
 
+    // Only done once per step, so a scan over the (densely stored) next tasks is cheaper than maintaining an index of
+    // the step boundaries on each received NextSimTask
     auto earliestOtherTimepoint = std::chrono::nanoseconds::max();
-    for (const auto& entry : _otherNextTasks)
+    for (std::size_t slot = 0; slot < _otherParticipants.size(); ++slot)
     {
+        if (!_otherTimePoints.Contains(slot))
+        {
+            continue;
+        }
+        const auto& otherTask = _otherParticipants[slot].nextTask;
+
         // Both start and end of other participant's step could be the earliest next timepoint
-        auto nextStepStart = entry.second.timePoint;
-        auto nextStepEnd = entry.second.timePoint + entry.second.duration;
+        auto nextStepStart = otherTask.timePoint;
+        auto nextStepEnd = otherTask.timePoint + otherTask.duration;
 
         if (nextStepStart > _currentTask.timePoint)
         {
@@ -195,18 +362,17 @@ bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    if (_otherTimePoints.Empty() || !(_myNextTask.timePoint > _otherTimePoints.TopKey()))
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
-        {
-            _logger->MakeMessage(Logging::Level::Debug, TopicOf(*this))
-                .SetMessage("Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                            otherTask.second.timePoint.count())
-                .Dispatch();
-            return true;
-        }
+        return false;
     }
-    return false;
+
+    const auto& otherParticipant = _otherParticipants[_otherTimePoints.Top()];
+    _logger->MakeMessage(Logging::Level::Debug, TopicOf(*this))
+        .SetMessage("Not advancing because participant \'{}\' has lower timepoint {}", otherParticipant.name,
+                    otherParticipant.nextTask.timePoint.count())
+        .Dispatch();
+    return true;
 }
 
 void TimeConfiguration::Initialize()
@@ -235,15 +401,16 @@ bool TimeConfiguration::IsHopOn()
     if (_currentTask.timePoint == -1ns) // On initial time
     {
         std::chrono::nanoseconds minimalOtherTime = std::chrono::nanoseconds::max();
-        for (const auto& otherTask : _otherNextTasks)
+        for (const auto& it : _slotByParticipantName)
         {
+            const auto& otherTask = _otherParticipants[it.second].nextTask;
             // Any other participant has already advanced further that its duration -> HopOn
-            if (otherTask.second.timePoint > otherTask.second.duration)
+            if (otherTask.timePoint > otherTask.duration)
             {
                 _hoppedOn = true;
-                if (otherTask.second.timePoint < minimalOtherTime)
+                if (otherTask.timePoint < minimalOtherTime)
                 {
-                    minimalOtherTime = otherTask.second.timePoint;
+                    minimalOtherTime = otherTask.timePoint;
                 }
             }
         }
@@ -2,27 +2,50 @@
 //
 // SPDX-License-Identifier: MIT
 
+#pragma once
+
 #include <string>
 #include <chrono>
-#include <map>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "core/internal/OrchestrationDatatypes.hpp"
 #include "services/logging/LoggerMessage.hpp"
+#include "util/IndexedMinHeap.hpp"
 
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
 using namespace std::chrono_literals;
+
+//! Relation of another synchronized participant to this participant in the hierarchical time synchronization
+enum class TimeSyncRelation
+{
+    //! Exchanges its own (or its subtree's) next task with this participant as an equal, as in the full mesh
+    Peer,
+    //! Aggregates the next tasks of this participant's subtree (configured as this participant's aggregator)
+    Parent,
+    //! Part of the subtree of this participant, i.e., this participant is its aggregator
+    Child,
+};
+
 class TimeConfiguration
 {
+public: //Types
+    using AggregatedNextSimTasks = std::vector<std::pair<std::string, NextSimTask>>;
+
 public: //Ctor
     TimeConfiguration(Logging::ILoggerInternal* logger);
 
 public: //Methods
     void SetBlockingMode(bool blocking);
-    void AddSynchronizedParticipant(const std::string& otherParticipantName);
+    void AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                    TimeSyncRelation relation = TimeSyncRelation::Peer,
+                                    std::chrono::nanoseconds lookahead = 0ns);
     bool RemoveSynchronizedParticipant(const std::string& otherParticipantName);
     auto GetSynchronizedParticipantNames() -> std::vector<std::string>;
     void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep);
@@ -44,18 +67,58 @@ public: //Methods
     void SetDynamicStepSizeEnabled(bool enabled);
     bool IsDynamicStepSizeEnabled() const;
 
+    // Lookahead: a participant declaring a lookahead does not affect others before its next time point plus the
+    // lookahead, so they may advance up to there without waiting for its next NextSimTask.
+    void SetLookahead(std::chrono::nanoseconds lookahead);
+    auto GetLookahead() const -> std::chrono::nanoseconds;
+
+    // Hierarchical time synchronization: instead of broadcasting its next task, each participant sends the earliest
+    // next task of its subtree to its parent (and to its peers), and the earliest next task of everybody else to each
+    // of its children.
+    void SetAggregator(const std::string& aggregatorParticipantName);
+    auto GetAggregator() const -> std::string;
+    void SetHierarchical();
+    bool IsHierarchical() const;
+
+    //! Like OnReceiveNextSimStep, but the time point may decrease (e.g., if a participant joins a subtree) and
+    //! unknown senders are ignored. Returns false if the sender is not a synchronized participant.
+    bool OnReceiveAggregatedNextSimStep(const std::string& participantName, NextSimTask nextStep);
+    //! Computes the aggregated next tasks for the parent, peers and children, given the last next task this
+    //! participant announced. Only returns the ones that changed since they were last returned.
+    auto UpdateAggregatedNextSimTasks(const NextSimTask& ownNextTask) -> AggregatedNextSimTasks;
+
 private: //Methods
     // Computes the minimal step duration that keeps this participant aligned with the earliest next
     // timepoint among all other synchronized participants. The caller must already hold _mx (this is
     // only invoked from AdvanceTimeStep); it deliberately does not lock so it stays reentrant there.
     auto GetMinimalAlignedDuration() const -> std::chrono::nanoseconds;
 
+private: //Types
+    struct OtherParticipant
+    {
+        std::string name;
+        NextSimTask nextTask;
+        TimeSyncRelation relation{TimeSyncRelation::Peer};
+        // The lookahead declared by this participant, added to the time points of its next tasks in the heap
+        std::chrono::nanoseconds lookahead{0ns};
+        // The aggregated next task that was last sent to this participant (hierarchical time synchronization only)
+        std::optional<NextSimTask> lastSentTask;
+    };
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+
+    // The next tasks of the other synchronized participants are stored in slots, which are reused after a participant
+    // was removed. The heap orders the occupied slots by the time point of their next task (plus their lookahead), so
+    // checking whether this participant may advance is O(1) and updating a next task is O(log N), even for large
+    // numbers of participants.
+    std::vector<OtherParticipant> _otherParticipants;
+    std::vector<std::size_t> _freeSlots;
+    std::unordered_map<std::string, std::size_t> _slotByParticipantName;
+    Util::IndexedMinHeap<std::chrono::nanoseconds> _otherTimePoints;
     bool _blocking;
 
     bool _hoppedOn = false;
@@ -65,6 +128,11 @@ private: //Members
     // synchronized participants (see GetMinimalAlignedDuration / AdvanceTimeStep). Disabled by default;
     // can be turned on via Experimental.TimeSynchronization.DynamicSimulationStep.
     bool _dynamicStepSizeEnabled{false};
+
+    std::string _aggregator;
+    bool _hierarchical{false};
+
+    std::chrono::nanoseconds _lookahead{0ns};
 };
 
 } // namespace Orchestration
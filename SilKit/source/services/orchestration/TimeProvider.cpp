@@ -7,14 +7,6 @@
 #include <mutex>
 
 
-namespace {
-
-// The 'default' value for timestamps on participants without time-sync is the minimum duration in nanoseconds.
-constexpr auto DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC = std::chrono::nanoseconds::min();
-
-} // namespace
-
-
 using namespace std::chrono_literals;
 
 
@@ -79,12 +71,6 @@ public:
         _timer.WithPeriod(_tickPeriod, [this](const auto& now) { NotifyListenerAboutTick(now, _tickPeriod); });
     }
 
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        const auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-        return now;
-    }
-
     void SetTime(std::chrono::nanoseconds, std::chrono::nanoseconds) override {}
 
 private:
@@ -106,11 +92,6 @@ public:
         _timer.WithPeriod(_tickPeriod, [this](const auto& now) { NotifyListenerAboutTick(now, _tickPeriod); });
     }
 
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        return DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC;
-    }
-
     void SetTime(std::chrono::nanoseconds, std::chrono::nanoseconds) override {}
 
 private:
@@ -119,8 +100,9 @@ private:
 };
 
 
-/// A caching time provider: we update its internal state whenever the controller's simulation time changes.
-/// This ensures that the our time provider is available even after the TimeSyncService gets destructed.
+/// A synchronized time provider: the current simulation time is cached by the TimeProvider whenever the controller's
+/// simulation time changes. This ensures that the our time provider is available even after the TimeSyncService gets
+/// destructed.
 class SynchronizedVirtualTimeProvider final : public ProviderBase
 {
 public:
@@ -131,20 +113,11 @@ public:
 
     void OnHandlerAdded() override {}
 
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        return _now;
-    }
-
     void SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) override
     {
-        _now = now;
         // tell our users about the next simulation step
         NotifyListenerAboutTick(now, duration);
     }
-
-private:
-    std::chrono::nanoseconds _now{DEFAULT_NOW_TIMESTAMP_WITHOUT_SYNC};
 };
 
 
@@ -191,6 +164,10 @@ void TimeProvider::ConfigureTimeProvider(Orchestration::TimeProviderKind timePro
             // swap the newly created provider with the current provider
             swap(_currentProvider, providerPtr);
 
+            // publish the kind of the new provider for the lock-free Now()
+            _virtualNow.store(std::chrono::nanoseconds::min().count(), std::memory_order_relaxed);
+            _currentProviderKind.store(timeProviderKind, std::memory_order_release);
+
             _currentProvider->SetActive(true);
         }
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <string>
 #include <memory>
@@ -29,8 +30,6 @@ struct ITimeProviderImpl
 
     virtual void OnHandlerAdded() = 0;
 
-    virtual auto Now() const -> std::chrono::nanoseconds = 0;
-
     virtual void SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration) = 0;
 };
 
@@ -69,6 +68,11 @@ private: //Members
     Util::Handlers<NextSimStepHandler> _handlers;
     bool _isSynchronizingVirtualTime{false};
     std::unique_ptr<ITimeProviderImpl> _currentProvider;
+
+    // Snapshot of the current provider's time, read by Now() without taking the mutex.
+    // The kind is published (release) after the virtual time was reset for a newly configured provider.
+    std::atomic<TimeProviderKind> _currentProviderKind{TimeProviderKind::NoSync};
+    std::atomic<std::chrono::nanoseconds::rep> _virtualNow{std::chrono::nanoseconds::min().count()};
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -78,8 +82,16 @@ private: //Members
 
 auto TimeProvider::Now() const -> std::chrono::nanoseconds
 {
-    std::unique_lock<decltype(_mutex)> lock{_mutex};
-    return _currentProvider->Now();
+    switch (_currentProviderKind.load(std::memory_order_acquire))
+    {
+    case TimeProviderKind::SyncTime:
+        return std::chrono::nanoseconds{_virtualNow.load(std::memory_order_acquire)};
+    case TimeProviderKind::WallClock:
+        return std::chrono::high_resolution_clock::now().time_since_epoch();
+    default:
+        // The 'default' value for timestamps on participants without time-sync is the minimum duration
+        return std::chrono::nanoseconds::min();
+    }
 }
 
 auto TimeProvider::TimeProviderName() const -> const std::string&
@@ -105,6 +117,10 @@ void TimeProvider::RemoveNextSimStepHandler(HandlerId handlerId)
 void TimeProvider::SetTime(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
 {
     std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (_currentProviderKind.load(std::memory_order_relaxed) == TimeProviderKind::SyncTime)
+    {
+        _virtualNow.store(now.count(), std::memory_order_release);
+    }
     _currentProvider->SetTime(now, duration);
 }
 
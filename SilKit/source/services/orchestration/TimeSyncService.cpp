@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <future>
 #include <functional>
 #include <atomic>
@@ -42,10 +43,14 @@ public:
     virtual ~ITimeSyncPolicy() = default;
     virtual void Initialize() = 0;
     virtual void RequestNextStep() = 0;
+    // Requests the next step and starts it right away if it is unblocked already. Must be called on the IO thread.
+    virtual void RequestAndProcessNextStep() = 0;
     virtual void SetSimStepCompleted() = 0;
     virtual auto IsExecutingSimStep() -> bool = 0;
     virtual void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) = 0;
     virtual void ProcessSimulationTimeUpdate() = 0;
+    // Sends the aggregated next tasks to new or changed parents, peers and children (hierarchical mode only)
+    virtual void SynchronizedParticipantsChanged() = 0;
 };
 
 //! brief Synchronization policy for unsynchronized participants
@@ -55,6 +60,7 @@ public:
     UnsynchronizedPolicy() {}
     void Initialize() override {}
     void RequestNextStep() override {}
+    void RequestAndProcessNextStep() override {}
     void SetSimStepCompleted() override {}
     auto IsExecutingSimStep() -> bool override
     {
@@ -62,6 +68,7 @@ public:
     }
     void ReceiveNextSimTask(const Core::IServiceEndpoint* /*from*/, const NextSimTask& /*task*/) override {}
     void ProcessSimulationTimeUpdate() override {};
+    void SynchronizedParticipantsChanged() override {}
 };
 
 //! brief Synchronization policy of the VAsio middleware
@@ -94,25 +101,39 @@ public:
 
     void RequestNextStep() override
     {
-        // ensure that calls to Stop()/Pause() in a SimTask won't send out a new step and eventually call the SimTask again
-        if (_controller.State() == ParticipantState::Running && !_controller.StopRequested()
-            && !_controller.PauseRequested())
+        if (AnnounceNextStep())
         {
-            if (_lastSentNextSimTask
-                != _configuration->NextSimStep().timePoint) // Prevent sending same step more than once
-            {
-                _lastSentNextSimTask = _configuration->NextSimStep().timePoint;
-                _controller.SendMsg(_configuration->NextSimStep());
-            }
             // Bootstrap checked execution, in case there is no other participant.
             // Else, checked execution is initiated when we receive their NextSimTask messages.
             _participant->ExecuteDeferred([this]() { this->ProcessSimulationTimeUpdate(); });
         }
     }
 
+    void RequestAndProcessNextStep() override
+    {
+        // The NextSimTasks which unblock the step were processed after the messages their senders sent before them,
+        // so starting the step without another round trip through the IO thread does not overtake any of them.
+        if (AnnounceNextStep())
+        {
+            ProcessSimulationTimeUpdate();
+        }
+    }
+
     void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
     {
-        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        if (_configuration->IsHierarchical())
+        {
+            if (!_configuration->OnReceiveAggregatedNextSimStep(from->GetServiceDescriptor().GetParticipantName(),
+                                                                task))
+            {
+                return;
+            }
+            SendAggregatedNextSimTasks();
+        }
+        else
+        {
+            _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        }
 
         switch (_controller.State())
         {
@@ -148,6 +169,14 @@ public:
         }
     }
 
+    void SynchronizedParticipantsChanged() override
+    {
+        if (_configuration->IsHierarchical())
+        {
+            SendAggregatedNextSimTasks();
+        }
+    }
+
     void ProcessSimulationTimeUpdate() override
     {
         // Check if we meet the conditions to trigger our local time advancement
@@ -165,6 +194,48 @@ public:
     }
 
 private:
+    //! Announces the next step once, returns false if no step must be requested anymore.
+    bool AnnounceNextStep()
+    {
+        // ensure that calls to Stop()/Pause() in a SimTask won't send out a new step and eventually call the SimTask again
+        if (_controller.State() != ParticipantState::Running || _controller.StopRequested()
+            || _controller.PauseRequested())
+        {
+            return false;
+        }
+
+        if (_lastSentNextSimTask
+            != _configuration->NextSimStep().timePoint) // Prevent sending same step more than once
+        {
+            _lastSentNextSimTask = _configuration->NextSimStep().timePoint;
+            AnnounceNextSimTask(_configuration->NextSimStep());
+        }
+        return true;
+    }
+
+    void AnnounceNextSimTask(const NextSimTask& task)
+    {
+        _announcedNextSimTask = task;
+        if (_configuration->IsHierarchical())
+        {
+            SendAggregatedNextSimTasks();
+        }
+        else
+        {
+            _controller.SendMsg(task);
+        }
+    }
+
+    // Instead of broadcasting to all participants, only the parent, the peers and the children receive a message,
+    // and only if the earliest next task they depend on has changed.
+    void SendAggregatedNextSimTasks()
+    {
+        for (auto&& participantAndTask : _configuration->UpdateAggregatedNextSimTasks(_announcedNextSimTask))
+        {
+            _controller.SendMsg(participantAndTask.first, participantAndTask.second);
+        }
+    }
+
     bool IsSimStepSync() const
     {
         return _configuration->IsBlocking();
@@ -281,6 +352,7 @@ private:
     std::atomic<bool> _isExecutingSimStep{false};
     TimeSyncService& _controller;
     std::chrono::nanoseconds _lastSentNextSimTask{-1ns};
+    NextSimTask _announcedNextSimTask{-1ns, 0ns};
     Core::IParticipantInternal* _participant;
     TimeConfiguration* _configuration;
     bool _hopOnEvaluated = false;
@@ -303,6 +375,8 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
           {"SimStep", "waiting_duration", "[s]"})}
     , _watchDog{healthCheckConfig}
     , _animationFactor{animationFactor}
+    , _startUnblockedStepsDirectly{
+          participant->GetParticipantConfiguration().experimental.timeSynchronization.spinWaitBudget.count() > 0}
 {
     _isCoupledToWallClock = _animationFactor != 0.0;
     if (_isCoupledToWallClock)
@@ -329,6 +403,9 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
 
     ConfigureTimeProvider(TimeProviderKind::NoSync);
 
+    _timeConfiguration.SetAggregator(
+        participant->GetParticipantConfiguration().experimental.timeSynchronization.aggregator);
+
     participant->GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
         [&](auto discoveryEventType, const Core::ServiceDescriptor& descriptor) {
         if (descriptor.GetServiceType() == Core::ServiceType::InternalController)
@@ -378,15 +455,31 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                             return;
                         }
 
+                        const auto relation = GetTimeSyncRelation(descriptor);
+                        if (!relation.has_value())
+                        {
+                            // synchronized indirectly via the aggregators of the hierarchical time synchronization
+                            return;
+                        }
+
                         _logger->MakeMessage(Logging::Level::Debug, TopicOf(*this))
                             .SetMessage("Participant is added to the distributed time synchronization")
                             .AddKeyValue(Logging::Keys::participantName, descriptorParticipantName)
                             .Dispatch();
 
-                        _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
+                        _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName, *relation,
+                                                                      GetLookahead(descriptor));
 
+                        if (_timeConfiguration.IsHierarchical())
+                        {
+                            // The new participant receives the aggregated next task it depends on (if any is known)
+                            if (_timeSyncPolicy)
+                            {
+                                GetTimeSyncPolicy()->SynchronizedParticipantsChanged();
+                            }
+                        }
                         // If our time has advanced, we just added a late-joining participant.
-                        if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
+                        else if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
                         {
                             // Resend our NextSimTask again because it is not assured that the late-joiner has seen our last update.
                             // At this point, the late-joiner will receive it because its TimeSyncPolicy is configured when the
@@ -423,7 +516,8 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
 
                             if (_timeSyncPolicy)
                             {
-                                // _otherNextTasks has changed, check if our sim task is due
+                                // the next tasks of the other participants have changed, check if our sim task is due
+                                GetTimeSyncPolicy()->SynchronizedParticipantsChanged();
                                 GetTimeSyncPolicy()->ProcessSimulationTimeUpdate();
                             }
                         }
@@ -621,7 +715,15 @@ void TimeSyncService::CompleteSimulationStep()
         if (!_isCoupledToWallClock || _wallClockReachedBeforeCompletion)
         {
             _wallClockReachedBeforeCompletion = false;
-            GetTimeSyncPolicy()->RequestNextStep();
+            if (_startUnblockedStepsDirectly)
+            {
+                // this task already runs on the IO thread, an unblocked step is started without queueing another one
+                GetTimeSyncPolicy()->RequestAndProcessNextStep();
+            }
+            else
+            {
+                GetTimeSyncPolicy()->RequestNextStep();
+            }
         }
     });
 }
@@ -653,6 +755,14 @@ void TimeSyncService::InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime)
         }
         _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncDynamicStepSize,
                                                    advertiseDynamicStep ? "1" : "0");
+        _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncAggregator,
+                                                   _timeConfiguration.GetAggregator());
+        const auto lookahead = _timeConfiguration.GetLookahead();
+        if (lookahead > 0ns)
+        {
+            _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncLookahead,
+                                                       std::to_string(lookahead.count()));
+        }
         ResetTime();
     }
     catch (const std::exception& e)
@@ -739,6 +849,61 @@ bool TimeSyncService::ParticipantHasAutonomousSynchronousCapability(const std::s
     return true;
 }
 
+auto TimeSyncService::GetLookahead(const Core::ServiceDescriptor& descriptor) const -> std::chrono::nanoseconds
+{
+    std::string lookahead;
+    if (!descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncLookahead, lookahead) || lookahead.empty())
+    {
+        return 0ns;
+    }
+
+    try
+    {
+        return std::max(std::chrono::nanoseconds{std::stoll(lookahead)}, 0ns);
+    }
+    catch (const std::out_of_range&)
+    {
+        // a lookahead beyond the representable range never constrains this participant
+        return lookahead.front() == '-' ? 0ns : std::chrono::nanoseconds::max();
+    }
+    catch (const std::exception&)
+    {
+        _logger->MakeMessage(Logging::Level::Warn, TopicOf(*this))
+            .SetMessage("Ignoring the invalid lookahead '{}' of the time synchronization", lookahead)
+            .AddKeyValue(Logging::Keys::participantName, descriptor.GetParticipantName())
+            .Dispatch();
+        return 0ns;
+    }
+}
+
+auto TimeSyncService::GetTimeSyncRelation(const Core::ServiceDescriptor& descriptor)
+    -> std::optional<TimeSyncRelation>
+{
+    std::string peerAggregator;
+    descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncAggregator, peerAggregator);
+    if (!peerAggregator.empty())
+    {
+        // from now on, the NextSimTasks are exchanged along the hierarchy
+        _timeConfiguration.SetHierarchical();
+    }
+
+    const auto aggregator = _timeConfiguration.GetAggregator();
+    if (descriptor.GetParticipantName() == aggregator)
+    {
+        return TimeSyncRelation::Parent;
+    }
+    if (peerAggregator == _participant->GetParticipantName())
+    {
+        return TimeSyncRelation::Child;
+    }
+    if (peerAggregator.empty() && aggregator.empty())
+    {
+        // both are roots of the hierarchy (or there is no hierarchy at all)
+        return TimeSyncRelation::Peer;
+    }
+    return std::nullopt;
+}
+
 bool TimeSyncService::AbortHopOnForCoordinatedParticipants() const
 {
     if (_lifecycleService)
@@ -852,6 +1017,21 @@ void TimeSyncService::InvokeOtherSimulationStepsCompletedHandlers()
     _otherSimulationStepsCompletedHandlers.InvokeAll();
 }
 
+void TimeSyncService::SetLookahead(std::chrono::nanoseconds lookahead)
+{
+    if (lookahead < 0ns)
+    {
+        throw SilKitError("The lookahead of the time synchronization must not be negative.");
+    }
+
+    std::lock_guard<decltype(_timeSyncPolicyMx)> lock{_timeSyncPolicyMx};
+    if (_timeSyncPolicy != nullptr)
+    {
+        throw StateError("The lookahead of the time synchronization must be declared before the lifecycle is started.");
+    }
+    _timeConfiguration.SetLookahead(lookahead);
+}
+
 void TimeSyncService::StopWallClockCouplingThread()
 {
     if (_wallClockCouplingThreadRunning)
@@ -66,6 +66,8 @@ public:
     // Used by Policies
     template <class MsgT>
     void SendMsg(MsgT&& msg) const;
+    template <class MsgT>
+    void SendMsg(const std::string& targetParticipantName, MsgT&& msg) const;
     void ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration);
 
     // Get the instance of the internal ITimeProvider that is updated with our simulation time
@@ -85,6 +87,9 @@ public:
     auto GetTimeConfiguration() -> TimeConfiguration*;
 
     bool ParticipantHasAutonomousSynchronousCapability(const std::string& participantName) const;
+    //! Determines how a discovered time synchronization service is synchronized with this participant. Returns
+    //! std::nullopt if it is only synchronized indirectly, via the aggregators of the hierarchical time synchronization.
+    auto GetTimeSyncRelation(const Core::ServiceDescriptor& descriptor) -> std::optional<TimeSyncRelation>;
     bool AbortHopOnForCoordinatedParticipants() const;
 
     auto StopRequested() const -> bool;
@@ -102,6 +107,10 @@ public:
     void RemoveOtherSimulationStepsCompletedHandler(HandlerId handlerId);
     void InvokeOtherSimulationStepsCompletedHandlers();
 
+    //! Declares the lookahead of this participant, which is announced with the service descriptor. Must be called
+    //! before the time synchronization policy is initialized, i.e., before the lifecycle is started.
+    void SetLookahead(std::chrono::nanoseconds lookahead);
+
     //! Configure the tri-state dynamic-step-size preference from participant configuration:
     //! true = enable locally and advertise the request to peers; false = hard opt-out;
     //! std::nullopt (default) = follow the network (enable if any peer advertises the request).
@@ -115,6 +124,9 @@ private:
     //! peers currently advertising the request, and pushes the result into the TimeConfiguration.
     void RecomputeDynamicStepEnabled();
 
+    //! The lookahead a discovered time synchronization service announced, or zero if it declared none.
+    auto GetLookahead(const Core::ServiceDescriptor& descriptor) const -> std::chrono::nanoseconds;
+
     //! Creates the _timeSyncPolicy. Returns true if the call assigned the _timeSyncPolicy, and false if it was already
     //! assigned before.
     bool SetupTimeSyncPolicy(bool isSynchronizingVirtualTime);
@@ -164,6 +176,9 @@ private:
     double _animationFactor{0};
     std::atomic<bool> _wallClockCouplingThreadRunning{false};
     std::atomic<bool> _wallClockReachedBeforeCompletion{false};
+    // Set with Experimental.TimeSynchronization.SpinWaitBudget: the completion of an asynchronous step starts the next
+    // step directly if it is unblocked already
+    bool _startUnblockedStepsDirectly{false};
 
     Util::SynchronizedHandlers<std::function<void()>> _otherSimulationStepsCompletedHandlers;
 
@@ -187,6 +202,12 @@ void TimeSyncService::SendMsg(MsgT&& msg) const
     _participant->SendMsg(this, std::forward<MsgT>(msg));
 }
 
+template <class MsgT>
+void TimeSyncService::SendMsg(const std::string& targetParticipantName, MsgT&& msg) const
+{
+    _participant->SendMsg(this, targetParticipantName, std::forward<MsgT>(msg));
+}
+
 void TimeSyncService::SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor)
 {
     _serviceDescriptor = serviceDescriptor;
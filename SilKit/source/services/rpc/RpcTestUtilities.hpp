@@ -106,6 +106,13 @@ struct MockConnection
     }
 
     void RegisterPeerShutdownCallback(std::function<void(SilKit::Core::IVAsioPeer* peer)> /*callback*/) {}
+    void RegisterDeferredPeerConnectedCallback(std::function<void(SilKit::Core::IVAsioPeer* peer)> /*callback*/) {}
+
+    void ConnectPeersOnDemand(const SilKit::Core::ServiceDescriptor& /*serviceDescriptor*/) {}
+    void ConnectPeerOnDemand(const std::string& /*participantName*/) {}
+
+    void StartPipelinedSubscriptions() {}
+    void WaitForPipelinedSubscriptions() {}
 
     void AddAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/){};
 
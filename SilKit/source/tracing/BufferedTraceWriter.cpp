@@ -0,0 +1,268 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "tracing/BufferedTraceWriter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "util/SetThreadName.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+namespace {
+// one block is filled while the other one is written
+constexpr size_t minimumNumberOfBlocks{2};
+} // namespace
+
+BufferedTraceWriter::BufferedTraceWriter(const Config::TraceSinkBuffering& config, WriteFunction write)
+    : _config{config}
+    , _write{std::move(write)}
+{
+    if (_config.blockSize == 0)
+    {
+        throw SilKitError("BufferedTraceWriter: the block size must not be zero");
+    }
+
+    _currentBlock.reserve(_config.blockSize);
+    _hasCurrentBlock = true;
+    _numberOfAllocatedBlocks = 1;
+
+    _thread = std::thread{[this] { WriterLoop(); }};
+}
+
+BufferedTraceWriter::~BufferedTraceWriter()
+{
+    Close();
+}
+
+bool BufferedTraceWriter::Append(std::initializer_list<Chunk> record)
+{
+    size_t recordSize{0};
+    for (const auto& chunk : record)
+    {
+        recordSize += chunk.size;
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    while (true)
+    {
+        if (_closed)
+        {
+            _numberOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (_hasCurrentBlock)
+        {
+            // records larger than a block get a block of their own, which grows beyond the configured size
+            if (_currentBlock.empty() || _currentBlock.size() + recordSize <= _config.blockSize)
+            {
+                break;
+            }
+            SealCurrentBlock();
+        }
+
+        if (!AcquireCurrentBlock(lock))
+        {
+            _numberOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    if (_currentBlock.empty())
+    {
+        // the writer thread has to know when the block is due, even if it is never filled
+        _currentBlockDeadline = std::chrono::steady_clock::now() + _config.flushInterval;
+        _writerCv.notify_one();
+    }
+
+    const auto offset = _currentBlock.size();
+    _currentBlock.resize(offset + recordSize);
+    auto* destination = _currentBlock.data() + offset;
+    for (const auto& chunk : record)
+    {
+        std::memcpy(destination, chunk.data, chunk.size);
+        destination += chunk.size;
+    }
+
+    if (_currentBlock.size() >= _config.blockSize)
+    {
+        SealCurrentBlock();
+    }
+
+    return true;
+}
+
+void BufferedTraceWriter::Flush()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_hasCurrentBlock && !_currentBlock.empty())
+    {
+        SealCurrentBlock();
+    }
+
+    _spaceCv.wait(lock, [this] { return _sealedBlocks.empty() && _numberOfBlocksInWrite == 0; });
+}
+
+void BufferedTraceWriter::Close()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_closed)
+        {
+            return;
+        }
+
+        if (_hasCurrentBlock && !_currentBlock.empty())
+        {
+            SealCurrentBlock();
+        }
+
+        _closed = true;
+        _stopRequested = true;
+    }
+
+    _writerCv.notify_one();
+    _spaceCv.notify_all();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool BufferedTraceWriter::HasFailed() const
+{
+    return _failed.load(std::memory_order_relaxed);
+}
+
+auto BufferedTraceWriter::GetNumberOfDroppedRecords() const -> uint64_t
+{
+    return _numberOfDroppedRecords.load(std::memory_order_relaxed);
+}
+
+void BufferedTraceWriter::SealCurrentBlock()
+{
+    _sealedBlocks.emplace_back(std::move(_currentBlock));
+    _currentBlock = {};
+    _hasCurrentBlock = false;
+    _writerCv.notify_one();
+}
+
+bool BufferedTraceWriter::AcquireCurrentBlock(std::unique_lock<std::mutex>& lock)
+{
+    const auto maxBlocks = std::max(_config.maxBlocks, minimumNumberOfBlocks);
+
+    while (true)
+    {
+        if (_closed)
+        {
+            return false;
+        }
+
+        // another thread acquired a block while this one was waiting
+        if (_hasCurrentBlock)
+        {
+            return true;
+        }
+
+        if (!_freeBlocks.empty())
+        {
+            _currentBlock = std::move(_freeBlocks.back());
+            _freeBlocks.pop_back();
+            _hasCurrentBlock = true;
+            return true;
+        }
+
+        if (_numberOfAllocatedBlocks < maxBlocks)
+        {
+            _currentBlock.reserve(_config.blockSize);
+            _hasCurrentBlock = true;
+            ++_numberOfAllocatedBlocks;
+            return true;
+        }
+
+        if (_config.overflowPolicy == Config::TraceSinkBuffering::OverflowPolicy::Drop)
+        {
+            return false;
+        }
+
+        _spaceCv.wait(lock);
+    }
+}
+
+void BufferedTraceWriter::WriterLoop()
+{
+    SilKit::Util::SetThreadName("SK-TraceWriter");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    while (true)
+    {
+        if (_sealedBlocks.empty())
+        {
+            // all blocks are sealed before stopping, so nothing is left behind
+            if (_stopRequested)
+            {
+                return;
+            }
+
+            if (_hasCurrentBlock && !_currentBlock.empty())
+            {
+                if (std::chrono::steady_clock::now() >= _currentBlockDeadline)
+                {
+                    SealCurrentBlock();
+                }
+                else
+                {
+                    _writerCv.wait_until(lock, _currentBlockDeadline);
+                }
+            }
+            else
+            {
+                _writerCv.wait(lock);
+            }
+            continue;
+        }
+
+        auto block = std::move(_sealedBlocks.front());
+        _sealedBlocks.pop_front();
+        ++_numberOfBlocksInWrite;
+
+        lock.unlock();
+
+        // after a failure the output is corrupt anyway, the blocks are only recycled
+        if (!_failed.load(std::memory_order_relaxed))
+        {
+            bool ok{false};
+            try
+            {
+                ok = _write(block.data(), block.size());
+            }
+            catch (const std::exception&)
+            {
+                ok = false;
+            }
+
+            if (!ok)
+            {
+                _failed.store(true, std::memory_order_relaxed);
+            }
+        }
+        block.clear();
+
+        lock.lock();
+
+        --_numberOfBlocksInWrite;
+        _freeBlocks.emplace_back(std::move(block));
+        _spaceCv.notify_all();
+    }
+}
+
+} // namespace Tracing
+} // namespace SilKit
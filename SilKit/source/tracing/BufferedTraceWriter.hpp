@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "config/Configuration.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+//! \brief Collects trace records in preallocated blocks and writes the blocks on a background thread.
+//!
+//! A block is handed to the background thread when the next record does not fit into it anymore, or when its first
+//! record is older than the flush interval. At most maxBlocks blocks are held in memory. If all of them are in use,
+//! records are either dropped or the appending thread waits, depending on the overflow policy.
+class BufferedTraceWriter
+{
+public:
+    //! Writes the data to the output and returns false on failure. Only called by the background thread.
+    using WriteFunction = std::function<bool(const char* data, size_t size)>;
+
+    struct Chunk
+    {
+        const void* data;
+        size_t size;
+    };
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    BufferedTraceWriter(const Config::TraceSinkBuffering& config, WriteFunction write);
+    BufferedTraceWriter(const BufferedTraceWriter&) = delete;
+    BufferedTraceWriter& operator=(const BufferedTraceWriter&) = delete;
+    ~BufferedTraceWriter();
+
+    // ----------------------------------------
+    // Public methods
+
+    //! Appends a record consisting of the given chunks. A record is never split across blocks. Returns false if the
+    //! record was dropped.
+    bool Append(std::initializer_list<Chunk> record);
+
+    //! Writes all records appended so far and waits until they have been written.
+    void Flush();
+
+    //! Writes all pending records and stops the background thread. Further records are dropped.
+    void Close();
+
+    //! True if a write of the background thread failed. The failed block and all later blocks are discarded.
+    bool HasFailed() const;
+
+    auto GetNumberOfDroppedRecords() const -> uint64_t;
+
+private:
+    // ----------------------------------------
+    // Private methods
+    void SealCurrentBlock();
+    bool AcquireCurrentBlock(std::unique_lock<std::mutex>& lock);
+    void WriterLoop();
+
+private:
+    // ----------------------------------------
+    // Private members
+    const Config::TraceSinkBuffering _config;
+    WriteFunction _write;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _writerCv;
+    std::condition_variable _spaceCv;
+
+    std::vector<char> _currentBlock;
+    bool _hasCurrentBlock{false};
+    std::chrono::steady_clock::time_point _currentBlockDeadline;
+    std::deque<std::vector<char>> _sealedBlocks;
+    std::vector<std::vector<char>> _freeBlocks;
+    size_t _numberOfAllocatedBlocks{0};
+    size_t _numberOfBlocksInWrite{0};
+
+    bool _stopRequested{false};
+    bool _closed{false};
+    std::atomic<bool> _failed{false};
+    std::atomic<uint64_t> _numberOfDroppedRecords{0};
+
+    std::thread _thread;
+};
+
+} // namespace Tracing
+} // namespace SilKit
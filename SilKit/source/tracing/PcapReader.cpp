@@ -4,12 +4,20 @@
 
 #include "tracing/PcapReader.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
 
 #include "wire/ethernet/WireEthernetMessages.hpp"
 #include "tracing/Pcap.hpp"
 #include "util/Assert.hpp"
 #include "services/logging/LoggerMessage.hpp"
+#include "util/SetThreadName.hpp"
 
 namespace SilKit {
 namespace Tracing {
@@ -68,6 +76,153 @@ auto PcapMessage::Type() const -> TraceMessageType
     return TraceMessageType::EthernetFrame;
 }
 
+namespace {
+
+auto ToTimestamp(const Pcap::PacketHeader& hdr) -> std::chrono::nanoseconds
+{
+    return std::chrono::nanoseconds{((uint64_t)hdr.ts_sec * 1000000000u) + ((uint64_t)hdr.ts_usec * 1000u)};
+}
+
+auto ReadPacketHeader(const Detail::MappedFile& mappedFile, size_t offset) -> Pcap::PacketHeader
+{
+    Pcap::PacketHeader hdr;
+    memcpy(&hdr, mappedFile.Data() + offset, sizeof(hdr));
+    return hdr;
+}
+
+// The frame references the mapped file instead of a copy of it
+auto DecodeRecord(const Detail::MappedFile::Ptr& mappedFile, size_t offset) -> std::shared_ptr<PcapMessage>
+{
+    const auto hdr = ReadPacketHeader(*mappedFile, offset);
+
+    auto msg = std::make_shared<PcapMessage>();
+    msg->raw = Util::SharedVector<uint8_t>{
+        mappedFile, Util::Span<const uint8_t>{mappedFile->Data() + offset + sizeof(hdr), hdr.incl_len}};
+    msg->SetTimestamp(ToTimestamp(hdr));
+    return msg;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////
+// PcapReader::Prefetcher -- decodes the upcoming records on a worker thread
+//////////////////////////////////////////////////////////////////////
+
+class PcapReader::Prefetcher
+{
+public:
+    Prefetcher(Detail::MappedFile::Ptr mappedFile, std::shared_ptr<const std::vector<size_t>> recordOffsets,
+               size_t firstRecord)
+        : _mappedFile{std::move(mappedFile)}
+        , _recordOffsets{std::move(recordOffsets)}
+        , _nextRecord{firstRecord}
+    {
+        _thread = std::thread{[this] { Run(); }};
+    }
+
+    ~Prefetcher()
+    {
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _stopRequested = true;
+        }
+        _spaceAvailable.notify_one();
+        _thread.join();
+    }
+
+    //! Returns the next record, or nullptr after the last one
+    auto Next() -> std::shared_ptr<PcapMessage>
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _messagesAvailable.wait(lock, [this] { return !_messages.empty() || _isDone; });
+        if (_messages.empty())
+        {
+            return nullptr;
+        }
+
+        auto msg = std::move(_messages.front());
+        _messages.pop_front();
+        if (_messages.size() == prefetchDepth - batchSize)
+        {
+            _spaceAvailable.notify_one();
+        }
+        return msg;
+    }
+
+private:
+    // number of decoded records held ahead of the reader
+    static constexpr size_t prefetchDepth{1024};
+    static constexpr size_t batchSize{64};
+    static constexpr size_t pageSize{4096};
+
+    void Run()
+    {
+        SilKit::Util::SetThreadName("SK-PcapPrefetch");
+
+        std::vector<std::shared_ptr<PcapMessage>> batch;
+        batch.reserve(batchSize);
+
+        while (true)
+        {
+            const auto endRecord = (std::min)(_nextRecord + batchSize, _recordOffsets->size());
+            for (; _nextRecord < endRecord; ++_nextRecord)
+            {
+                auto msg = DecodeRecord(_mappedFile, (*_recordOffsets)[_nextRecord]);
+                TouchPages(msg->raw.AsSpan());
+                batch.emplace_back(std::move(msg));
+            }
+
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            for (auto&& msg : batch)
+            {
+                _messages.emplace_back(std::move(msg));
+            }
+            batch.clear();
+
+            if (_nextRecord == _recordOffsets->size())
+            {
+                _isDone = true;
+                _messagesAvailable.notify_one();
+                return;
+            }
+            _messagesAvailable.notify_one();
+
+            _spaceAvailable.wait(lock, [this] {
+                return _messages.size() <= prefetchDepth - batchSize || _stopRequested;
+            });
+            if (_stopRequested)
+            {
+                return;
+            }
+        }
+    }
+
+    // Reading one byte per page faults the page in on this thread instead of the simulation thread
+    static void TouchPages(Util::Span<const uint8_t> data)
+    {
+        volatile uint8_t sink{0};
+        for (size_t i = 0; i < data.size(); i += pageSize)
+        {
+            sink = data[i];
+        }
+        (void)sink;
+    }
+
+private:
+    const Detail::MappedFile::Ptr _mappedFile;
+    const std::shared_ptr<const std::vector<size_t>> _recordOffsets;
+    size_t _nextRecord;
+
+    std::mutex _mutex;
+    std::condition_variable _messagesAvailable;
+    std::condition_variable _spaceAvailable;
+    std::deque<std::shared_ptr<PcapMessage>> _messages;
+    bool _isDone{false};
+    bool _stopRequested{false};
+
+    std::thread _thread;
+};
+
 //////////////////////////////////////////////////////////////////////
 // PcapReader
 //////////////////////////////////////////////////////////////////////
@@ -82,6 +237,18 @@ PcapReader::PcapReader(const std::string& filePath, ILogger* logger)
     : _filePath{filePath}
     , _log{logger}
 {
+    try
+    {
+        _mappedFile = Detail::MappedFile::Open(_filePath);
+    }
+    catch (const SilKitError& err)
+    {
+        _log->Error(err.what());
+        throw SilKitError("Cannot open file " + _filePath);
+    }
+
+    ReadGlobalHeader();
+    IndexRecords();
     Reset();
 }
 
@@ -95,46 +262,59 @@ PcapReader::PcapReader(PcapReader& other)
     _startTime = other._startTime;
     _endTime = other._endTime;
     _stream = other._stream;
+    _mappedFile = other._mappedFile;
+    _recordOffsets = other._recordOffsets;
     Reset();
 }
 
+PcapReader::~PcapReader() = default;
+
 void PcapReader::Reset()
 {
-    if (_filePath.empty() && _stream == nullptr)
+    if (_mappedFile)
     {
-        _log->Error("PcapReader::Reset(): no input file or stream pointer given!");
-        throw SilKitError("PcapReader::Reset(): no input file or stream pointer given!");
-    }
-
-    if (!_filePath.empty())
-    {
-        if (!_file.is_open())
-        {
-            _file.open(_filePath, std::ios::binary | std::ios::in);
-            _stream = &_file;
-        }
-        if (!_file.good())
+        // the first record is decoded directly, the prefetcher is only started once the reader advances
+        _prefetcher.reset();
+        _currentMessage.reset();
+        _nextRecord = 0;
+        if (!_recordOffsets->empty())
         {
-            _log->Error(fmt::format("Cannot open file {}", _filePath));
-            throw SilKitError("Cannot open file " + _filePath);
+            _currentMessage = DecodeRecord(_mappedFile, _recordOffsets->front());
+            _nextRecord = 1;
         }
+        return;
     }
 
-    SILKIT_ASSERT(_stream != nullptr);
+    if (_stream == nullptr)
+    {
+        _log->Error("PcapReader::Reset(): no input file or stream pointer given!");
+        throw SilKitError("PcapReader::Reset(): no input file or stream pointer given!");
+    }
 
     //seek stream to first packet and cache first message
     ReadGlobalHeader();
-    Seek(1);
+    SeekStream(1);
 }
 
 void PcapReader::ReadGlobalHeader()
 {
     std::array<char, sizeof(Pcap::GlobalHeader)> buf{};
-    _stream->seekg(0);
-    _stream->read(buf.data(), buf.size());
-    if (!_stream->good())
+    if (_mappedFile)
+    {
+        if (_mappedFile->Size() < buf.size())
+        {
+            throw SilKitError("PCAP file cannot be opened: global header short read");
+        }
+        memcpy(buf.data(), _mappedFile->Data(), buf.size());
+    }
+    else
     {
-        throw SilKitError("PCAP file cannot be opened: global header short read");
+        _stream->seekg(0);
+        _stream->read(buf.data(), buf.size());
+        if (!_stream->good())
+        {
+            throw SilKitError("PCAP file cannot be opened: global header short read");
+        }
     }
     auto* hdr = reinterpret_cast<Pcap::GlobalHeader*>(buf.data());
     if (hdr->magic_number != Pcap::NativeMagic)
@@ -155,17 +335,87 @@ auto PcapReader::StartTime() const -> std::chrono::nanoseconds
     return _startTime;
 }
 
+void PcapReader::IndexRecords()
+{
+    // Only the packet headers are read, but they are spread over the whole file: records smaller than a page put
+    // several headers on each page, so the whole file is paged in here, before the prefetching worker runs. Only the
+    // pages of records larger than a page are skipped.
+    auto recordOffsets = std::make_shared<std::vector<size_t>>();
+    auto offset = Pcap::GlobalHeaderSize;
+    while (offset + Pcap::PacketHeaderSize <= _mappedFile->Size())
+    {
+        const auto hdr = ReadPacketHeader(*_mappedFile, offset);
+        const auto nextOffset = offset + Pcap::PacketHeaderSize + hdr.incl_len;
+        if (nextOffset > _mappedFile->Size())
+        {
+            _log->Warn(fmt::format("PCAP file: {}: Cannot read packet at offset {}", _filePath, offset));
+            break;
+        }
+
+        recordOffsets->push_back(offset);
+        offset = nextOffset;
+    }
+
+    if (!recordOffsets->empty())
+    {
+        _endTime = ToTimestamp(ReadPacketHeader(*_mappedFile, recordOffsets->back()));
+    }
+    _recordOffsets = std::move(recordOffsets);
+}
+
 auto PcapReader::EndTime() const -> std::chrono::nanoseconds
 {
-    throw SilKitError("PcapReader::EndTime(): Not Implemented");
+    if (!_recordOffsets)
+    {
+        throw SilKitError("PcapReader::EndTime(): Not Implemented");
+    }
+    return _endTime;
 }
 
 auto PcapReader::NumberOfMessages() const -> uint64_t
 {
+    if (_recordOffsets)
+    {
+        return _recordOffsets->size();
+    }
     return _numMessages;
 }
 
 bool PcapReader::Seek(size_t messageNumber)
+{
+    if (!_mappedFile)
+    {
+        return SeekStream(messageNumber);
+    }
+
+    if (messageNumber > 1)
+    {
+        // the records in between are skipped using the index, the prefetcher restarts at the target
+        _prefetcher.reset();
+        _nextRecord = (std::min)(_nextRecord + messageNumber - 1, _recordOffsets->size());
+        messageNumber = 1;
+    }
+
+    //seek number of messages relative to current position
+    for (auto i = 0u; i < messageNumber; i++)
+    {
+        if (!_prefetcher)
+        {
+            _prefetcher = std::make_unique<Prefetcher>(_mappedFile, _recordOffsets, _nextRecord);
+        }
+
+        auto msg = _prefetcher->Next();
+        if (!msg)
+        {
+            return false;
+        }
+        ++_nextRecord;
+        _currentMessage = std::move(msg);
+    }
+    return true;
+}
+
+bool PcapReader::SeekStream(size_t messageNumber)
 {
     //seek number of messages relative to current position
     for (auto i = 0u; i < messageNumber; i++)
@@ -181,7 +431,7 @@ bool PcapReader::Seek(size_t messageNumber)
         }
         auto msg = std::make_shared<PcapMessage>();
         auto* hdr = reinterpret_cast<Pcap::PacketHeader*>(buf.data());
-        std::chrono::nanoseconds timeStamp{((uint64_t)hdr->ts_sec * 1000000000u) + ((uint64_t)hdr->ts_usec * 1000u)};
+        const auto timeStamp = ToTimestamp(*hdr);
 
         std::vector<uint8_t> msgBuf{};
         msgBuf.resize(hdr->incl_len);
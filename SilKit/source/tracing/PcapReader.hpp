@@ -5,9 +5,11 @@
 #pragma once
 
 #include <istream>
-#include <fstream>
+#include <memory>
+#include <vector>
 
 #include "tracing/IReplay.hpp"
+#include "tracing/detail/MappedFile.hpp"
 #include "services/logging/ILoggerInternal.hpp"
 
 namespace SilKit {
@@ -17,10 +19,12 @@ class PcapReader final : public SilKit::IReplayChannelReader
 {
 public:
     // Constructors
+    //! The file is memory mapped and the offsets of its records are indexed up front
     PcapReader(const std::string& filePath, SilKit::Services::Logging::ILogger* logger);
     //This CTor is for testing purposes only:
     PcapReader(std::istream* stream, SilKit::Services::Logging::ILogger* logger);
     PcapReader(PcapReader& other);
+    ~PcapReader();
 
 public:
     // Methods
@@ -38,11 +42,19 @@ private:
     //Methods
     void Reset();
     void ReadGlobalHeader();
+    void IndexRecords();
+    bool SeekStream(size_t messageNumber);
+
+    class Prefetcher;
 
 private:
     std::string _filePath;
-    std::ifstream _file;
     std::istream* _stream{nullptr};
+    // shared by the copies of a reader
+    Detail::MappedFile::Ptr _mappedFile;
+    std::shared_ptr<const std::vector<size_t>> _recordOffsets;
+    size_t _nextRecord{0};
+    std::unique_ptr<Prefetcher> _prefetcher;
     std::map<std::string, std::string> _metaInfos;
     std::shared_ptr<IReplayMessage> _currentMessage;
     uint64_t _numMessages{0};
@@ -33,6 +33,20 @@ PcapSink::PcapSink(Services::Logging::ILoggerInternal* logger, std::string name)
 {
 }
 
+PcapSink::PcapSink(Services::Logging::ILoggerInternal* logger, std::string name,
+                   const Config::TraceSinkBuffering& buffering)
+    : _buffering{buffering}
+    , _name{std::move(name)}
+    , _logger{logger}
+{
+}
+
+PcapSink::~PcapSink()
+{
+    // the writer thread accesses the file and the pipe, stop it before they are destroyed
+    _writer.reset();
+}
+
 void PcapSink::Open(SinkType outputType, const std::string& outputPath)
 {
     if (outputPath.empty())
@@ -40,6 +54,9 @@ void PcapSink::Open(SinkType outputType, const std::string& outputPath)
         throw SilKitError("PcapSink::Open: outputPath must not be empty!");
     }
 
+    // records of a previous output are written to it, before it is replaced
+    _writer.reset();
+
     switch (outputType)
     {
     case SilKit::SinkType::PcapFile:
@@ -49,12 +66,25 @@ void PcapSink::Open(SinkType outputType, const std::string& outputPath)
         }
         _file.open(outputPath, std::ios::out | std::ios::binary);
         _file.write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
+        if (_buffering.blockSize != 0)
+        {
+            _writer = std::make_unique<BufferedTraceWriter>(_buffering, [this](const char* data, size_t size) {
+                _file.write(data, size);
+                return _file.good();
+            });
+        }
         break;
 
     case SilKit::SinkType::PcapNamedPipe:
         _pipe = Detail::NamedPipe::Create(outputPath);
         _headerWritten = false;
         _outputPath = outputPath;
+        if (_buffering.blockSize != 0)
+        {
+            // connecting the reader blocks, which happens on the writer thread now
+            _writer = std::make_unique<BufferedTraceWriter>(
+                _buffering, [this](const char* data, size_t size) { return WriteToPipe(data, size); });
+        }
         break;
     default:
         throw SilKitError("PcapSink::Open: specified SinkType not implemented");
@@ -73,6 +103,21 @@ auto PcapSink::Name() const -> const std::string&
 
 void PcapSink::Close()
 {
+    if (_writer)
+    {
+        _writer->Close();
+
+        const auto numberOfDroppedRecords = _writer->GetNumberOfDroppedRecords();
+        if (numberOfDroppedRecords != 0)
+        {
+            _logger->MakeMessage(Level::Warn, TopicOf(*this))
+                .SetMessage("Sink {}: {} PCAP records were dropped, because all buffer blocks were in use", _name,
+                            numberOfDroppedRecords)
+                .Dispatch();
+        }
+        _writer.reset();
+    }
+
     if (_file)
     {
         _file.flush();
@@ -107,8 +152,6 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
     }
     const auto& message = traceMessage.Get<Services::Ethernet::EthernetFrame>();
 
-    std::unique_lock<decltype(_lock)> lock;
-
     const auto tosec = 1000'000ull;
     const auto usec = std::chrono::duration_cast<std::chrono::microseconds>(timestamp);
 
@@ -118,6 +161,19 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
     pcapPacketHeader.ts_sec = static_cast<uint32_t>(usec.count() / tosec);
     pcapPacketHeader.ts_usec = static_cast<uint32_t>(usec.count() % tosec);
 
+    if (_writer)
+    {
+        // a dropped record is only counted, the output stays a valid PCAP stream
+        _writer->Append({{&pcapPacketHeader, sizeof(pcapPacketHeader)}, {message.raw.data(), message.raw.size()}});
+        if (_writer->HasFailed())
+        {
+            throw SilKitError("Failed to write trace message to PCAP sink");
+        }
+        return;
+    }
+
+    std::unique_lock<decltype(_lock)> lock{_lock};
+
     bool ok = true;
     if (_file.is_open())
     {
@@ -128,22 +184,8 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
 
     if (_pipe)
     {
-        if (!_headerWritten)
-        {
-            _logger->MakeMessage(Level::Info, TopicOf(*this))
-                .SetMessage("Sink {}: Waiting for a reader to connect to PCAP pipe {} ... ", _name, _outputPath)
-                .Dispatch();
-
-            ok &= _pipe->Write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
-            _logger->MakeMessage(Level::Debug, TopicOf(*this))
-                .SetMessage("Sink {}: PCAP pipe: {} is connected successfully", _name, _outputPath)
-                .Dispatch();
-
-            _headerWritten = true;
-        }
-
-        ok &= _pipe->Write(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
-        ok &= _pipe->Write(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
+        ok &= WriteToPipe(reinterpret_cast<const char*>(&pcapPacketHeader), sizeof(pcapPacketHeader));
+        ok &= WriteToPipe(reinterpret_cast<const char*>(&message.raw.at(0)), message.raw.size());
     }
 
     if (!ok)
@@ -152,5 +194,26 @@ void PcapSink::Trace(SilKit::Services::TransmitDirection /*unused*/,
     }
 }
 
+bool PcapSink::WriteToPipe(const char* data, size_t size)
+{
+    bool ok = true;
+    if (!_headerWritten)
+    {
+        _logger->MakeMessage(Level::Info, TopicOf(*this))
+            .SetMessage("Sink {}: Waiting for a reader to connect to PCAP pipe {} ... ", _name, _outputPath)
+            .Dispatch();
+
+        ok &= _pipe->Write(reinterpret_cast<const char*>(&g_pcapGlobalHeader), sizeof(g_pcapGlobalHeader));
+        _logger->MakeMessage(Level::Debug, TopicOf(*this))
+            .SetMessage("Sink {}: PCAP pipe: {} is connected successfully", _name, _outputPath)
+            .Dispatch();
+
+        _headerWritten = true;
+    }
+
+    ok &= _pipe->Write(data, size);
+    return ok;
+}
+
 } // namespace Tracing
 } // namespace SilKit
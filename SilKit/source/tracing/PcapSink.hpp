@@ -9,7 +9,9 @@
 #include <memory>
 
 #include "tracing/ITraceMessageSink.hpp"
+#include "tracing/BufferedTraceWriter.hpp"
 
+#include "config/Configuration.hpp"
 #include "core/internal/EndpointAddress.hpp"
 #include "tracing/detail/NamedPipe.hpp"
 #include "services/logging/ILoggerInternal.hpp"
@@ -25,7 +27,10 @@ public:
     PcapSink() = delete;
     PcapSink(const PcapSink&) = delete;
     PcapSink(Services::Logging::ILoggerInternal* logger, std::string name);
-    ~PcapSink() = default;
+    //! The records are written by a background thread, if the block size of the buffering is not zero
+    PcapSink(Services::Logging::ILoggerInternal* logger, std::string name,
+             const Config::TraceSinkBuffering& buffering);
+    ~PcapSink();
 
     // ----------------------------------------
     // Public methods
@@ -40,9 +45,16 @@ public:
 
     auto Name() const -> const std::string& override;
 
+private:
+    // ----------------------------------------
+    // Private methods
+    bool WriteToPipe(const char* data, size_t size);
+
 private:
     // ----------------------------------------
     // Private members
+    Config::TraceSinkBuffering _buffering;
+    std::unique_ptr<BufferedTraceWriter> _writer;
     bool _headerWritten{false};
     std::ofstream _file;
     std::unique_ptr<Detail::NamedPipe> _pipe;
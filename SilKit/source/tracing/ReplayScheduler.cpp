@@ -14,6 +14,7 @@
 
 #include "core/internal/IParticipantInternal.hpp"
 #include "tracing/IReplayDataController.hpp"
+#include "tracing/ReplayTimeIndex.hpp"
 #include "tracing/Tracing.hpp"
 #include "util/Assert.hpp"
 #include "services/logging/LoggerMessage.hpp"
@@ -300,6 +301,11 @@ ReplayScheduler::ReplayScheduler(const Config::ParticipantConfiguration& partici
 {
     _log = _participant->GetLoggerInternal();
 
+    for (const auto& source : participantConfiguration.tracing.traceSources)
+    {
+        _replayWindows[source.name] = source.replayWindow;
+    }
+
     CreateReplayFiles(participantConfiguration);
 }
 
@@ -352,12 +358,29 @@ void ReplayScheduler::ConfigureController(const std::string& controllerName, IRe
             throw SilKitError("Could not find a replay channel");
         }
 
-        task.replayReader = replayChannel->GetReader();
+        const std::chrono::nanoseconds startTime = _replayWindows[replayConfig.useTraceSource].startTime;
+        if (startTime > std::chrono::nanoseconds::zero())
+        {
+            // the index is only built once per trace file and channel, it is cached next to the file
+            const auto index = ReplayTimeIndex::LoadOrBuild(*replayFile, *replayChannel, _log);
+            task.replayReader = SeekReplayChannel(*replayChannel, index, startTime);
+            task.timeOffset = startTime;
+
+            _log->MakeMessage(Level::Debug, TopicOf(*this))
+                .SetMessage("{}: replay of channel '{}' starts at {}ns", controllerName, replayChannel->Name(),
+                            startTime.count())
+                .Dispatch();
+        }
+        else
+        {
+            task.replayReader = replayChannel->GetReader();
+        }
         task.initialTime = replayChannel->StartTime();
         task.name = replayChannel->Name();
         task.replayFile = std::move(replayFile);
 
         _replayTasks.emplace_back(std::move(task));
+        SchedulePendingMessage(_replayTasks.size() - 1);
     }
     catch (const SilKit::ConfigurationError& ex)
     {
@@ -417,44 +440,46 @@ void ReplayScheduler::ReplayMessages(std::chrono::nanoseconds now, std::chrono::
     const auto relativeNow = now - _startTime;
     SILKIT_ASSERT(relativeNow.count() >= 0);
     const auto relativeEnd = relativeNow + duration;
-    for (auto& task : _replayTasks)
+
+    // only the tasks with messages due in this step are visited, in the order of their timestamps
+    while (!_pendingTasks.Empty() && _pendingTasks.TopKey() < relativeEnd)
     {
-        if (task.doneReplaying)
+        const auto taskIndex = _pendingTasks.Top();
+        auto& task = _replayTasks[taskIndex];
+
+        //NB: Currently, the messages are batched at the beginning of the schedule.
+        //    When using wallclock time provider, the message timestamps might be off.
+        auto msg = task.replayReader->Read();
+        task.controller->ReplayMessage(msg.get());
+
+        if (!task.replayReader->Seek(1))
         {
+            // we're at the end of the replay channel
+            task.doneReplaying = true;
+            _pendingTasks.Erase(taskIndex);
             continue;
         }
 
-        while (true)
-        {
-            auto msg = task.replayReader->Read();
-            if (!msg)
-            {
-                _log->MakeMessage(Level::Trace,  TopicOf(*this))
-                    .SetMessage("ReplayTask on channel '{}' returned invalid message @{}ns", task.name, now.count())
-                    .Dispatch();
-                task.doneReplaying = true;
-                break;
-            }
-
-            const auto msgNow = msg->Timestamp();
-            if (msgNow >= relativeEnd)
-            {
-                //message is after the current schedule
-                break;
-            }
+        SchedulePendingMessage(taskIndex);
+    }
+}
 
-            //NB: Currently, the messages are batched at the beginning of the schedule.
-            //    When using wallclock time provider, the message timestamps might be off.
-            task.controller->ReplayMessage(msg.get());
+void ReplayScheduler::SchedulePendingMessage(size_t taskIndex)
+{
+    auto& task = _replayTasks[taskIndex];
 
-            if (!task.replayReader->Seek(1))
-            {
-                // we're at the end of the replay channel
-                task.doneReplaying = true;
-                break;
-            }
-        }
+    auto msg = task.replayReader ? task.replayReader->Read() : nullptr;
+    if (!msg)
+    {
+        _log->MakeMessage(Level::Trace, TopicOf(*this))
+            .SetMessage("ReplayTask on channel '{}' returned invalid message", task.name)
+            .Dispatch();
+        task.doneReplaying = true;
+        _pendingTasks.Erase(taskIndex);
+        return;
     }
+
+    _pendingTasks.Set(taskIndex, msg->Timestamp() - task.timeOffset);
 }
 
 } // namespace Tracing
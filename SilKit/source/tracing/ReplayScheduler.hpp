@@ -14,6 +14,7 @@
 #include "tracing/IReplayDataController.hpp"
 #include "core/internal/ISimulator.hpp"
 #include "services/logging/ILoggerInternal.hpp"
+#include "util/IndexedMinHeap.hpp"
 
 namespace SilKit {
 namespace Tracing {
@@ -38,6 +39,9 @@ private:
 
     void ReplayMessages(std::chrono::nanoseconds now, std::chrono::nanoseconds duration);
 
+    //! Keys the task by the time of its next message, or marks it as done
+    void SchedulePendingMessage(size_t taskIndex);
+
 private:
     // Members
     struct ReplayTask
@@ -47,6 +51,8 @@ private:
         IReplayDataController* controller{nullptr};
         std::shared_ptr<IReplayChannelReader> replayReader;
         std::chrono::nanoseconds initialTime{0};
+        // subtracted from the timestamps of the messages, if the replay starts later in the trace
+        std::chrono::nanoseconds timeOffset{0};
         bool doneReplaying{false};
     };
 
@@ -55,10 +61,13 @@ private:
     Core::IParticipantInternal* _participant{nullptr};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     std::vector<ReplayTask> _replayTasks;
+    // the tasks which have messages left, merged by the time of their next message
+    Util::IndexedMinHeap<std::chrono::nanoseconds> _pendingTasks;
     bool _isDone{false};
     std::vector<std::string> _knownSimulators;
 
     std::map<std::string, std::shared_ptr<IReplayFile>> _replayFiles;
+    std::map<std::string, Config::TraceSourceReplayWindow> _replayWindows;
 };
 
 } // namespace Tracing
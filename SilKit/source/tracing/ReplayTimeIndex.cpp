@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "tracing/ReplayTimeIndex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "services/logging/LoggerMessage.hpp"
+#include "util/Uuid.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+namespace {
+
+constexpr std::array<char, 8> cacheMagic{'S', 'K', 'T', 'I', 'D', 'X', '0', '1'};
+
+// The cache is only valid for the trace file it was built from
+struct TraceFileIdentity
+{
+    uint64_t size{0};
+    int64_t lastWriteTime{0};
+};
+
+bool GetTraceFileIdentity(const std::string& traceFilePath, TraceFileIdentity& identity)
+{
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(traceFilePath, ec);
+    if (ec)
+    {
+        return false;
+    }
+    const auto lastWriteTime = std::filesystem::last_write_time(traceFilePath, ec);
+    if (ec)
+    {
+        return false;
+    }
+
+    identity.size = static_cast<uint64_t>(size);
+    identity.lastWriteTime = static_cast<int64_t>(lastWriteTime.time_since_epoch().count());
+    return true;
+}
+
+template <typename T>
+void WriteValue(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool ReadValue(std::istream& in, T& value)
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return in.good();
+}
+
+} // namespace
+
+auto ReplayTimeIndex::Build(IReplayChannel& channel, uint64_t stride) -> ReplayTimeIndex
+{
+    ReplayTimeIndex index;
+    index._stride = (std::max)(stride, uint64_t{1});
+
+    auto reader = channel.GetReader();
+    auto maxTimestamp = std::chrono::nanoseconds::min();
+    uint64_t messageNumber{0};
+    for (auto msg = reader->Read(); msg; msg = reader->Read())
+    {
+        if (messageNumber % index._stride == 0)
+        {
+            index._entries.push_back(Entry{messageNumber, maxTimestamp});
+        }
+        maxTimestamp = (std::max)(maxTimestamp, msg->Timestamp());
+        ++messageNumber;
+
+        if (!reader->Seek(1))
+        {
+            break;
+        }
+    }
+
+    return index;
+}
+
+auto ReplayTimeIndex::LoadOrBuild(const IReplayFile& replayFile, IReplayChannel& channel,
+                                  Services::Logging::ILoggerInternal* logger) -> ReplayTimeIndex
+{
+    using Services::Logging::Level;
+    using Services::Logging::Topic;
+
+    const auto cachePath = CachePath(replayFile, channel);
+
+    ReplayTimeIndex index;
+    if (index.Load(cachePath, replayFile.FilePath()))
+    {
+        logger->MakeMessage(Level::Debug, Topic::Tracing)
+            .SetMessage("Replay: using the cached time index '{}'", cachePath)
+            .Dispatch();
+        return index;
+    }
+
+    index = Build(channel);
+    try
+    {
+        index.Store(cachePath, replayFile.FilePath());
+        logger->MakeMessage(Level::Debug, Topic::Tracing)
+            .SetMessage("Replay: cached the time index of channel '{}' in '{}'", channel.Name(), cachePath)
+            .Dispatch();
+    }
+    catch (const SilKitError& err)
+    {
+        logger->MakeMessage(Level::Debug, Topic::Tracing)
+            .SetMessage("Replay: cannot cache the time index of channel '{}': {}", channel.Name(), err.what())
+            .Dispatch();
+    }
+    return index;
+}
+
+auto ReplayTimeIndex::CachePath(const IReplayFile& replayFile, const IReplayChannel& channel) -> std::string
+{
+    auto channelName = channel.Name();
+    std::replace_if(
+        channelName.begin(), channelName.end(),
+        [](char c) { return !std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_'; }, '_');
+    return replayFile.FilePath() + "." + channelName + ".silkit-index";
+}
+
+auto ReplayTimeIndex::FindMessageNumber(std::chrono::nanoseconds timestamp) const -> uint64_t
+{
+    // the first entry, before which a message is not earlier than the timestamp
+    auto it = std::lower_bound(_entries.begin(), _entries.end(), timestamp,
+                               [](const Entry& entry, std::chrono::nanoseconds value) {
+                                   return entry.maxTimestampBefore < value;
+                               });
+    if (it == _entries.begin())
+    {
+        return 0;
+    }
+    return std::prev(it)->messageNumber;
+}
+
+auto ReplayTimeIndex::GetEntries() const -> const std::vector<Entry>&
+{
+    return _entries;
+}
+
+bool ReplayTimeIndex::Load(const std::string& path, const std::string& traceFilePath)
+{
+    TraceFileIdentity expectedIdentity;
+    if (!GetTraceFileIdentity(traceFilePath, expectedIdentity))
+    {
+        return false;
+    }
+
+    std::ifstream in{path, std::ios::binary};
+    if (!in.good())
+    {
+        return false;
+    }
+
+    std::array<char, cacheMagic.size()> magic{};
+    TraceFileIdentity identity;
+    uint64_t stride{0};
+    uint64_t numEntries{0};
+    in.read(magic.data(), magic.size());
+    if (!in.good() || magic != cacheMagic || !ReadValue(in, identity.size) || !ReadValue(in, identity.lastWriteTime)
+        || !ReadValue(in, stride) || !ReadValue(in, numEntries))
+    {
+        return false;
+    }
+    if (identity.size != expectedIdentity.size || identity.lastWriteTime != expectedIdentity.lastWriteTime
+        || stride == 0)
+    {
+        return false;
+    }
+
+    std::vector<Entry> entries;
+    for (uint64_t i = 0; i < numEntries; ++i)
+    {
+        uint64_t messageNumber{0};
+        int64_t maxTimestampBefore{0};
+        if (!ReadValue(in, messageNumber) || !ReadValue(in, maxTimestampBefore))
+        {
+            return false;
+        }
+        entries.push_back(Entry{messageNumber, std::chrono::nanoseconds{maxTimestampBefore}});
+    }
+
+    _stride = stride;
+    _entries = std::move(entries);
+    return true;
+}
+
+void ReplayTimeIndex::Store(const std::string& path, const std::string& traceFilePath) const
+{
+    TraceFileIdentity identity;
+    if (!GetTraceFileIdentity(traceFilePath, identity))
+    {
+        throw SilKitError("cannot determine the size and modification time of " + traceFilePath);
+    }
+
+    // replace the cache atomically, other participants might replay the same file and store the cache concurrently
+    const auto temporaryPath = path + "." + Util::to_string(Util::Uuid::GenerateRandom()) + ".tmp";
+    {
+        std::ofstream out{temporaryPath, std::ios::binary | std::ios::trunc};
+        out.write(cacheMagic.data(), cacheMagic.size());
+        WriteValue(out, identity.size);
+        WriteValue(out, identity.lastWriteTime);
+        WriteValue(out, _stride);
+        WriteValue(out, static_cast<uint64_t>(_entries.size()));
+        for (const auto& entry : _entries)
+        {
+            WriteValue(out, entry.messageNumber);
+            WriteValue(out, static_cast<int64_t>(entry.maxTimestampBefore.count()));
+        }
+        if (!out.good())
+        {
+            throw SilKitError("cannot write " + temporaryPath);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporaryPath, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(temporaryPath, ec);
+        throw SilKitError("cannot write " + path);
+    }
+}
+
+auto SeekReplayChannel(IReplayChannel& channel, const ReplayTimeIndex& index, std::chrono::nanoseconds timestamp)
+    -> std::shared_ptr<IReplayChannelReader>
+{
+    auto reader = channel.GetReader();
+
+    const auto messageNumber = index.FindMessageNumber(timestamp);
+    if (messageNumber != 0 && !reader->Seek(messageNumber))
+    {
+        return nullptr;
+    }
+
+    // at most stride messages are skipped here
+    for (auto msg = reader->Read(); msg; msg = reader->Read())
+    {
+        if (msg->Timestamp() >= timestamp)
+        {
+            return reader;
+        }
+        if (!reader->Seek(1))
+        {
+            break;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tracing/IReplay.hpp"
+#include "services/logging/ILoggerInternal.hpp"
+
+namespace SilKit {
+namespace Tracing {
+
+//! \brief Sparse index of the timestamps of a replay channel, which allows seeking to a time in O(log n).
+//!
+//! Every stride-th message is indexed together with the largest timestamp of all messages before it. Because this
+//! maximum never decreases, the index can be searched for the last message before which all messages are earlier than
+//! a given time, even if the timestamps of the channel are not strictly ordered.
+class ReplayTimeIndex
+{
+public:
+    struct Entry
+    {
+        uint64_t messageNumber{0};
+        std::chrono::nanoseconds maxTimestampBefore{std::chrono::nanoseconds::min()};
+    };
+
+    static constexpr uint64_t defaultStride{1024};
+
+public:
+    //! Reads the whole channel once
+    static auto Build(IReplayChannel& channel, uint64_t stride = defaultStride) -> ReplayTimeIndex;
+
+    //! Loads the index cached next to the replay file, or builds and caches it, if there is no valid cache.
+    //! Failing to write the cache is not an error.
+    static auto LoadOrBuild(const IReplayFile& replayFile, IReplayChannel& channel,
+                            Services::Logging::ILoggerInternal* logger) -> ReplayTimeIndex;
+
+    //! Path of the cache file of the given channel
+    static auto CachePath(const IReplayFile& replayFile, const IReplayChannel& channel) -> std::string;
+
+    //! Number of a message before which all messages have an earlier timestamp than the given time. At most stride
+    //! messages from there are earlier than the given time, too.
+    auto FindMessageNumber(std::chrono::nanoseconds timestamp) const -> uint64_t;
+
+    auto GetEntries() const -> const std::vector<Entry>&;
+
+private:
+    bool Load(const std::string& path, const std::string& traceFilePath);
+    void Store(const std::string& path, const std::string& traceFilePath) const;
+
+private:
+    uint64_t _stride{defaultStride};
+    std::vector<Entry> _entries;
+};
+
+//! Creates a reader of the channel, which is positioned at its first message with a timestamp not earlier than the
+//! given time. Returns a reader without a message, if there is none.
+auto SeekReplayChannel(IReplayChannel& channel, const ReplayTimeIndex& index, std::chrono::nanoseconds timestamp)
+    -> std::shared_ptr<IReplayChannelReader>;
+
+} // namespace Tracing
+} // namespace SilKit
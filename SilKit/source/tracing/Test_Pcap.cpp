@@ -3,8 +3,16 @@
 // SPDX-License-Identifier: MIT
 
 #include "tracing/PcapReader.hpp"
+#include "tracing/PcapSink.hpp"
+#include "tracing/PcapReplay.hpp"
+#include "tracing/ReplayTimeIndex.hpp"
+#include "tracing/BufferedTraceWriter.hpp"
+#include "tracing/TraceMessage.hpp"
 
 #include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
 
 #include "silkit/services/ethernet/EthernetDatatypes.hpp"
 
@@ -90,4 +98,204 @@ TEST(Test_Pcap, read_from_pcap)
     EXPECT_EQ((int)numMessages, 10);
 }
 
+TEST(Test_Pcap, read_from_mapped_pcap_file)
+{
+    testing::NiceMock<MockLogger> log;
+    const std::string inputPath{"Test_Pcap_read_from_mapped_pcap_file.pcap"};
+
+    // more records than are prefetched at once
+    constexpr auto numRecords = 3000u;
+    WireEthernetFrame testInput;
+    auto raw = MakePcapTestData(testInput, numRecords);
+    {
+        std::ofstream file{inputPath, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw.data()), raw.size());
+    }
+
+    PcapReader reader{inputPath, log.AsILogger()};
+    // the records are indexed up front
+    EXPECT_EQ(reader.NumberOfMessages(), numRecords);
+    EXPECT_EQ(reader.EndTime(), std::chrono::seconds{numRecords - 1} + std::chrono::microseconds{numRecords - 1});
+
+    auto readAll = [&testInput](PcapReader& reader) {
+        auto numMessages = 0u;
+        for (auto msg = reader.Read(); msg; msg = reader.Read())
+        {
+            EXPECT_EQ(msg->Timestamp(),
+                      std::chrono::seconds{numMessages} + std::chrono::microseconds{numMessages});
+            auto ethMsg = dynamic_cast<WireEthernetFrame&>(*msg);
+            EXPECT_TRUE(ItemsAreEqual(ethMsg.raw.AsSpan(), testInput.raw.AsSpan()));
+            numMessages++;
+
+            if (!reader.Seek(1))
+            {
+                break;
+            }
+        }
+        return numMessages;
+    };
+
+    EXPECT_EQ(readAll(reader), numRecords);
+
+    // a copy starts at the first record again and shares the mapping
+    PcapReader copy{reader};
+    EXPECT_EQ(readAll(copy), numRecords);
+
+    std::remove(inputPath.c_str());
+}
+
+TEST(Test_Pcap, time_index_seeks_to_the_first_message_at_a_time)
+{
+    testing::NiceMock<MockLogger> log;
+    const std::string inputPath{"Test_Pcap_time_index_seeks_to_the_first_message_at_a_time.pcap"};
+
+    constexpr auto numRecords = 5000u;
+    WireEthernetFrame testInput;
+    auto raw = MakePcapTestData(testInput, numRecords);
+    {
+        std::ofstream file{inputPath, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw.data()), raw.size());
+    }
+
+    auto replayFile = PcapReplay{}.OpenFile({}, inputPath, log.AsILogger());
+    auto& channel = **replayFile->begin();
+
+    const auto index = ReplayTimeIndex::LoadOrBuild(*replayFile, channel, &log);
+    const auto stride = ReplayTimeIndex::defaultStride;
+    EXPECT_EQ(index.GetEntries().size(), (numRecords + stride - 1) / stride);
+
+    // the index is cached next to the trace file and reused
+    const auto cachePath = ReplayTimeIndex::CachePath(*replayFile, channel);
+    ASSERT_TRUE(std::filesystem::exists(cachePath));
+    const auto cacheFile = std::filesystem::absolute(cachePath);
+    for (const auto& entry : std::filesystem::directory_iterator{cacheFile.parent_path()})
+    {
+        const auto fileName = entry.path().filename().string();
+        EXPECT_FALSE(fileName != cacheFile.filename().string() && fileName.find(cacheFile.filename().string()) == 0)
+            << "leftover temporary file " << entry.path();
+    }
+    const auto cachedIndex = ReplayTimeIndex::LoadOrBuild(*replayFile, channel, &log);
+    ASSERT_EQ(cachedIndex.GetEntries().size(), index.GetEntries().size());
+    for (size_t i = 0; i < index.GetEntries().size(); ++i)
+    {
+        EXPECT_EQ(cachedIndex.GetEntries()[i].messageNumber, index.GetEntries()[i].messageNumber);
+        EXPECT_EQ(cachedIndex.GetEntries()[i].maxTimestampBefore, index.GetEntries()[i].maxTimestampBefore);
+    }
+
+    // record i has the timestamp i s + i us
+    auto reader = SeekReplayChannel(channel, cachedIndex, std::chrono::milliseconds{3000500});
+    ASSERT_TRUE(reader);
+    EXPECT_EQ(reader->Read()->Timestamp(), std::chrono::seconds{3001} + std::chrono::microseconds{3001});
+    ASSERT_TRUE(reader->Seek(1));
+    EXPECT_EQ(reader->Read()->Timestamp(), std::chrono::seconds{3002} + std::chrono::microseconds{3002});
+
+    reader = SeekReplayChannel(channel, cachedIndex, std::chrono::nanoseconds::zero());
+    ASSERT_TRUE(reader);
+    EXPECT_EQ(reader->Read()->Timestamp(), std::chrono::nanoseconds::zero());
+
+    EXPECT_FALSE(SeekReplayChannel(channel, cachedIndex, std::chrono::seconds{numRecords}));
+
+    replayFile.reset();
+    std::remove(cachePath.c_str());
+    std::remove(inputPath.c_str());
+}
+
+TEST(Test_Pcap, buffered_sink_writes_all_records)
+{
+    testing::NiceMock<MockLogger> log;
+    const std::string outputPath{"Test_Pcap_buffered_sink_writes_all_records.pcap"};
+
+    SilKit::Config::TraceSinkBuffering buffering;
+    // small blocks, so that records are spread over several blocks
+    buffering.blockSize = 512;
+    buffering.maxBlocks = 2;
+    buffering.overflowPolicy = SilKit::Config::TraceSinkBuffering::OverflowPolicy::Block;
+
+    WireEthernetFrame wireFrame;
+    MakePcapTestData(wireFrame, 1);
+    const auto frame = ToEthernetFrame(wireFrame);
+
+    constexpr auto numRecords = 100u;
+    {
+        PcapSink sink{&log, "BufferedSink", buffering};
+        sink.Open(SilKit::SinkType::PcapFile, outputPath);
+        for (auto i = 0u; i < numRecords; i++)
+        {
+            sink.Trace(SilKit::Services::TransmitDirection::TX, {}, std::chrono::microseconds{i},
+                       SilKit::TraceMessage{frame});
+        }
+        sink.Close();
+    }
+
+    PcapReader reader{outputPath, log.AsILogger()};
+
+    // records are written in order and none is lost or split
+    for (auto i = 0u; i < numRecords; i++)
+    {
+        auto msg = reader.Read();
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(msg->Timestamp(), std::chrono::microseconds{i});
+
+        auto ethMsg = dynamic_cast<WireEthernetFrame&>(*msg);
+        EXPECT_TRUE(ItemsAreEqual(ethMsg.raw.AsSpan(), wireFrame.raw.AsSpan()));
+        EXPECT_EQ(reader.Seek(1), i + 1 < numRecords);
+    }
+
+    std::remove(outputPath.c_str());
+}
+
+TEST(Test_Pcap, buffered_writer_drops_records_if_all_blocks_are_in_use)
+{
+    std::promise<void> writeMayContinue;
+    auto writeMayContinueFuture = writeMayContinue.get_future().share();
+    std::string output;
+
+    SilKit::Config::TraceSinkBuffering buffering;
+    buffering.blockSize = 4;
+    buffering.maxBlocks = 2;
+    buffering.overflowPolicy = SilKit::Config::TraceSinkBuffering::OverflowPolicy::Drop;
+
+    BufferedTraceWriter writer{buffering, [&output, writeMayContinueFuture](const char* data, size_t size) {
+                                   writeMayContinueFuture.wait();
+                                   output.append(data, size);
+                                   return true;
+                               }};
+
+    // each record fills a block, the writer thread is stuck on the first one
+    EXPECT_TRUE(writer.Append({{"abcd", 4}}));
+    EXPECT_TRUE(writer.Append({{"ef", 2}, {"gh", 2}}));
+    EXPECT_FALSE(writer.Append({{"ijkl", 4}}));
+    EXPECT_EQ(writer.GetNumberOfDroppedRecords(), 1u);
+
+    writeMayContinue.set_value();
+    writer.Flush();
+    EXPECT_EQ(output, "abcdefgh");
+
+    // blocks are reused after they have been written
+    EXPECT_TRUE(writer.Append({{"mnop", 4}}));
+    writer.Close();
+    EXPECT_EQ(output, "abcdefghmnop");
+    EXPECT_FALSE(writer.HasFailed());
+}
+
+TEST(Test_Pcap, buffered_writer_writes_partial_blocks_after_the_flush_interval)
+{
+    std::promise<std::string> written;
+
+    SilKit::Config::TraceSinkBuffering buffering;
+    buffering.blockSize = 1024;
+    buffering.flushInterval = std::chrono::milliseconds{10};
+
+    BufferedTraceWriter writer{buffering, [&written](const char* data, size_t size) {
+                                   written.set_value(std::string{data, size});
+                                   return true;
+                               }};
+
+    EXPECT_TRUE(writer.Append({{"record", 6}}));
+
+    auto writtenFuture = written.get_future();
+    ASSERT_EQ(writtenFuture.wait_for(std::chrono::seconds{5}), std::future_status::ready);
+    EXPECT_EQ(writtenFuture.get(), "record");
+}
+
 } // namespace
@@ -79,14 +79,14 @@ auto CreateTraceMessageSinks(Services::Logging::ILoggerInternal* logger,
         }
         case Config::TraceSink::Type::PcapFile:
         {
-            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
+            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name, sinkCfg.buffering);
             sink->Open(SinkType::PcapFile, sinkCfg.outputPath);
             newSinks.emplace_back(std::move(sink));
             break;
         }
         case Config::TraceSink::Type::PcapPipe:
         {
-            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name);
+            auto sink = std::make_unique<PcapSink>(logger, sinkCfg.name, sinkCfg.buffering);
             sink->Open(SinkType::PcapNamedPipe, sinkCfg.outputPath);
             newSinks.emplace_back(std::move(sink));
             break;
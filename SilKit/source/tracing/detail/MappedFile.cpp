@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "tracing/detail/MappedFile.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+namespace {
+
+[[noreturn]] void ThrowOpenError(const std::string& filePath, const char* operation, int error)
+{
+    std::stringstream ss;
+    ss << "Cannot map file \"" << filePath << "\": " << operation << " failed with error " << error;
+#if !defined(_WIN32)
+    ss << ": " << strerror(error);
+#endif
+    throw SilKitError(ss.str());
+}
+
+} // namespace
+
+#if defined(_WIN32)
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr)
+    {
+        ::UnmapViewOfFile(_data);
+    }
+    if (_mappingHandle != nullptr)
+    {
+        ::CloseHandle(_mappingHandle);
+    }
+}
+
+auto MappedFile::Open(const std::string& filePath) -> Ptr
+{
+    std::shared_ptr<MappedFile> mappedFile{new MappedFile{}};
+
+    HANDLE file = ::CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        ThrowOpenError(filePath, "CreateFile", static_cast<int>(::GetLastError()));
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!::GetFileSizeEx(file, &fileSize))
+    {
+        const auto error = static_cast<int>(::GetLastError());
+        ::CloseHandle(file);
+        ThrowOpenError(filePath, "GetFileSizeEx", error);
+    }
+
+    mappedFile->_size = static_cast<size_t>(fileSize.QuadPart);
+    if (mappedFile->_size == 0)
+    {
+        // empty files cannot be mapped
+        ::CloseHandle(file);
+        return mappedFile;
+    }
+
+    mappedFile->_mappingHandle = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const auto mappingError = static_cast<int>(::GetLastError());
+    // the mapping keeps the file open
+    ::CloseHandle(file);
+    if (mappedFile->_mappingHandle == nullptr)
+    {
+        ThrowOpenError(filePath, "CreateFileMapping", mappingError);
+    }
+
+    mappedFile->_data =
+        static_cast<const uint8_t*>(::MapViewOfFile(mappedFile->_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (mappedFile->_data == nullptr)
+    {
+        ThrowOpenError(filePath, "MapViewOfFile", static_cast<int>(::GetLastError()));
+    }
+
+    return mappedFile;
+}
+
+#else
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr)
+    {
+        (void)::munmap(const_cast<uint8_t*>(_data), _size);
+    }
+}
+
+auto MappedFile::Open(const std::string& filePath) -> Ptr
+{
+    std::shared_ptr<MappedFile> mappedFile{new MappedFile{}};
+
+    const int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        ThrowOpenError(filePath, "open", errno);
+    }
+
+    struct stat fileStat{};
+    if (::fstat(fd, &fileStat) == -1)
+    {
+        const auto error = errno;
+        (void)::close(fd);
+        ThrowOpenError(filePath, "fstat", error);
+    }
+
+    mappedFile->_size = static_cast<size_t>(fileStat.st_size);
+    if (mappedFile->_size == 0)
+    {
+        // empty files cannot be mapped
+        (void)::close(fd);
+        return mappedFile;
+    }
+
+    void* data = ::mmap(nullptr, mappedFile->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file open
+    (void)::close(fd);
+    if (data == MAP_FAILED)
+    {
+        ThrowOpenError(filePath, "mmap", errno);
+    }
+
+    // traces are replayed front to back, let the kernel read ahead aggressively
+    (void)::madvise(data, mappedFile->_size, MADV_SEQUENTIAL);
+
+    mappedFile->_data = static_cast<const uint8_t*>(data);
+    return mappedFile;
+}
+
+#endif
+
+auto MappedFile::Data() const -> const uint8_t*
+{
+    return _data;
+}
+
+auto MappedFile::Size() const -> size_t
+{
+    return _size;
+}
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace SilKit {
+namespace Tracing {
+namespace Detail {
+
+//! Read-only memory mapping of a whole file. The mapping stays valid as long as the object is alive.
+class MappedFile
+{
+public:
+    using Ptr = std::shared_ptr<const MappedFile>;
+
+    // ----------------------------------------
+    // Constructors and Destructor
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    // ----------------------------------------
+    // Public methods
+    auto Data() const -> const uint8_t*;
+    auto Size() const -> size_t;
+
+    // ----------------------------------------
+    // Factory method, throws SilKitError if the file cannot be mapped
+    static auto Open(const std::string& filePath) -> Ptr;
+
+private:
+    MappedFile() = default;
+
+private:
+    const uint8_t* _data{nullptr};
+    size_t _size{0};
+#if defined(_WIN32)
+    void* _mappingHandle{nullptr};
+#endif
+};
+
+} // namespace Detail
+} // namespace Tracing
+} // namespace SilKit
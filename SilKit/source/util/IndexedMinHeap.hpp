@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+/// Binary min-heap of items identified by a dense index (e.g., a slot in a vector), whose keys can be updated or
+/// removed in O(log N). The item with the smallest key is accessible in O(1).
+template <typename KeyT, typename CompareT = std::less<KeyT>>
+class IndexedMinHeap
+{
+public:
+    static constexpr std::size_t NoPosition{static_cast<std::size_t>(-1)};
+
+public:
+    bool Empty() const
+    {
+        return _heap.empty();
+    }
+
+    auto Size() const -> std::size_t
+    {
+        return _heap.size();
+    }
+
+    bool Contains(std::size_t item) const
+    {
+        return item < _positions.size() && _positions[item] != NoPosition;
+    }
+
+    /// The item with the smallest key. The heap must not be empty.
+    auto Top() const -> std::size_t
+    {
+        return _heap.front();
+    }
+
+    auto TopKey() const -> const KeyT&
+    {
+        return _keys[_heap.front()];
+    }
+
+    auto Key(std::size_t item) const -> const KeyT&
+    {
+        return _keys[item];
+    }
+
+    /// Inserts the item, or updates its key if it is already contained.
+    void Set(std::size_t item, KeyT key)
+    {
+        if (!Contains(item))
+        {
+            if (item >= _positions.size())
+            {
+                _positions.resize(item + 1, NoPosition);
+                _keys.resize(item + 1);
+            }
+
+            _keys[item] = std::move(key);
+            _positions[item] = _heap.size();
+            _heap.push_back(item);
+            SiftUp(_heap.size() - 1);
+            return;
+        }
+
+        const bool decreased = _compare(key, _keys[item]);
+        _keys[item] = std::move(key);
+        if (decreased)
+        {
+            SiftUp(_positions[item]);
+        }
+        else
+        {
+            SiftDown(_positions[item]);
+        }
+    }
+
+    void Erase(std::size_t item)
+    {
+        if (!Contains(item))
+        {
+            return;
+        }
+
+        const auto position = _positions[item];
+        const auto last = _heap.size() - 1;
+        _positions[item] = NoPosition;
+
+        if (position == last)
+        {
+            _heap.pop_back();
+            return;
+        }
+
+        const auto moved = _heap[last];
+        _heap[position] = moved;
+        _positions[moved] = position;
+        _heap.pop_back();
+
+        // the moved item can violate the heap property in either direction
+        SiftUp(position);
+        SiftDown(_positions[moved]);
+    }
+
+private:
+    bool Less(std::size_t lhsPosition, std::size_t rhsPosition) const
+    {
+        return _compare(_keys[_heap[lhsPosition]], _keys[_heap[rhsPosition]]);
+    }
+
+    void Swap(std::size_t lhsPosition, std::size_t rhsPosition)
+    {
+        std::swap(_heap[lhsPosition], _heap[rhsPosition]);
+        _positions[_heap[lhsPosition]] = lhsPosition;
+        _positions[_heap[rhsPosition]] = rhsPosition;
+    }
+
+    void SiftUp(std::size_t position)
+    {
+        while (position > 0)
+        {
+            const auto parent = (position - 1) / 2;
+            if (!Less(position, parent))
+            {
+                return;
+            }
+            Swap(position, parent);
+            position = parent;
+        }
+    }
+
+    void SiftDown(std::size_t position)
+    {
+        while (true)
+        {
+            const auto left = 2 * position + 1;
+            const auto right = left + 1;
+            auto smallest = position;
+
+            if (left < _heap.size() && Less(left, smallest))
+            {
+                smallest = left;
+            }
+            if (right < _heap.size() && Less(right, smallest))
+            {
+                smallest = right;
+            }
+            if (smallest == position)
+            {
+                return;
+            }
+
+            Swap(position, smallest);
+            position = smallest;
+        }
+    }
+
+private:
+    std::vector<std::size_t> _heap;      // items in heap order
+    std::vector<std::size_t> _positions; // position of each item in _heap, or NoPosition
+    std::vector<KeyT> _keys;             // key of each item
+    CompareT _compare;
+};
+
+} // namespace Util
+} // namespace SilKit
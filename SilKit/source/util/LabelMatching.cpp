@@ -3,30 +3,31 @@
 // SPDX-License-Identifier: MIT
 
 #include "util/LabelMatching.hpp"
-#include <optional>
+
+#include <algorithm>
 
 namespace SilKit {
 namespace Util {
 
 using namespace SilKit::Services;
 
-static std::optional<MatchingLabel> TryFindLabelByKey(const std::string& key, const std::vector<MatchingLabel>& labels)
+static const MatchingLabel* TryFindLabelByKey(const std::string& key, const std::vector<MatchingLabel>& labels)
 {
-    for (auto it : labels)
+    for (const auto& it : labels)
     {
         if (it.key == key)
         {
-            return {it};
+            return &it;
         }
     }
-    return std::optional<MatchingLabel>();
+    return nullptr;
 }
 
-static bool LabelMatchesLabelList(MatchingLabel label, const std::vector<MatchingLabel>& labels)
+static bool LabelMatchesLabelList(const MatchingLabel& label, const std::vector<MatchingLabel>& labels)
 {
-    auto foundLabel = TryFindLabelByKey(label.key, labels);
+    const auto* foundLabel = TryFindLabelByKey(label.key, labels);
 
-    if (!foundLabel.has_value()) // Key not found
+    if (foundLabel == nullptr) // Key not found
     {
         if (label.kind == MatchingLabel::Kind::Mandatory)
         {
@@ -35,7 +36,7 @@ static bool LabelMatchesLabelList(MatchingLabel label, const std::vector<Matchin
         }
         // std::optional labels that do not exist are ignored
     }
-    else if (label.value != foundLabel.value().value)
+    else if (label.value != foundLabel->value)
     {
         // Key found and value does not match -> no match
         return false;
@@ -66,5 +67,121 @@ bool MatchLabels(const std::vector<MatchingLabel>& labels1, const std::vector<Ma
     return true; // All of the labels match according to their rules -> match
 }
 
+auto LabelStringTable::Intern(const std::string& string) -> uint32_t
+{
+    return _ids.emplace(string, static_cast<uint32_t>(_ids.size())).first->second;
+}
+
+CompiledLabels::CompiledLabels(const std::vector<MatchingLabel>& labels, LabelStringTable& strings)
+{
+    std::vector<std::pair<Label, bool>> sortedLabels;
+    sortedLabels.reserve(labels.size());
+    for (const auto& label : labels)
+    {
+        sortedLabels.push_back({Label{strings.Intern(label.key), strings.Intern(label.value)},
+                                label.kind == MatchingLabel::Kind::Mandatory});
+    }
+    // MatchLabels compares against the first label of a key, so labels with the same key must stay in order
+    std::stable_sort(sortedLabels.begin(), sortedLabels.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first.key < rhs.first.key; });
+
+    _labels.reserve(sortedLabels.size());
+    _mandatoryMask.resize((sortedLabels.size() + 63) / 64);
+    for (size_t i = 0; i < sortedLabels.size(); ++i)
+    {
+        _labels.push_back(sortedLabels[i].first);
+        if (sortedLabels[i].second)
+        {
+            _mandatoryMask[i / 64] |= uint64_t{1} << (i % 64);
+        }
+    }
+}
+
+bool CompiledLabels::Empty() const
+{
+    return _labels.empty();
+}
+
+bool CompiledLabels::IsMandatory(size_t index) const
+{
+    return (_mandatoryMask[index / 64] & (uint64_t{1} << (index % 64))) != 0;
+}
+
+bool CompiledLabels::HasMandatoryFrom(size_t index) const
+{
+    if (index >= _labels.size())
+    {
+        return false;
+    }
+    const auto word = index / 64;
+    if ((_mandatoryMask[word] >> (index % 64)) != 0)
+    {
+        return true;
+    }
+    return std::any_of(_mandatoryMask.begin() + word + 1, _mandatoryMask.end(),
+                       [](uint64_t bits) { return bits != 0; });
+}
+
+auto CompiledLabels::EndOfKey(size_t index) const -> size_t
+{
+    const auto key = _labels[index].key;
+    while (index < _labels.size() && _labels[index].key == key)
+    {
+        ++index;
+    }
+    return index;
+}
+
+bool MatchLabels(const CompiledLabels& labels1, const CompiledLabels& labels2)
+{
+    // Walk both key-sorted lists at once: a key on one side only must be optional, a common key needs equal values
+    size_t i = 0;
+    size_t j = 0;
+    while (i < labels1._labels.size() && j < labels2._labels.size())
+    {
+        const auto key1 = labels1._labels[i].key;
+        const auto key2 = labels2._labels[j].key;
+        if (key1 < key2)
+        {
+            if (labels1.IsMandatory(i))
+            {
+                return false;
+            }
+            ++i;
+        }
+        else if (key2 < key1)
+        {
+            if (labels2.IsMandatory(j))
+            {
+                return false;
+            }
+            ++j;
+        }
+        else
+        {
+            const auto end1 = labels1.EndOfKey(i);
+            const auto end2 = labels2.EndOfKey(j);
+            const auto firstValue1 = labels1._labels[i].value;
+            const auto firstValue2 = labels2._labels[j].value;
+            for (; i < end1; ++i)
+            {
+                if (labels1._labels[i].value != firstValue2)
+                {
+                    return false;
+                }
+            }
+            for (; j < end2; ++j)
+            {
+                if (labels2._labels[j].value != firstValue1)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return !labels1.HasMandatoryFrom(i) && !labels2.HasMandatoryFrom(j);
+}
+
 } // namespace Util
 } // namespace SilKit
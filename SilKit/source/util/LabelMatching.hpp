@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "silkit/services/datatypes.hpp"
@@ -14,5 +17,49 @@ namespace Util {
 bool MatchLabels(const std::vector<SilKit::Services::MatchingLabel>& labels1,
                  const std::vector<SilKit::Services::MatchingLabel>& labels2);
 
+//! Assigns dense ids to label keys and values. Label sets compiled with the same table can be matched.
+class LabelStringTable
+{
+public:
+    auto Intern(const std::string& string) -> uint32_t;
+
+private:
+    std::unordered_map<std::string, uint32_t> _ids;
+};
+
+//! \brief Labels with interned keys and values, sorted by key, which are matched in a single pass.
+//!
+//! Matching gives the same result as MatchLabels on the original labels.
+class CompiledLabels
+{
+public:
+    CompiledLabels() = default;
+    CompiledLabels(const std::vector<SilKit::Services::MatchingLabel>& labels, LabelStringTable& strings);
+
+    bool Empty() const;
+
+private:
+    friend bool MatchLabels(const CompiledLabels& labels1, const CompiledLabels& labels2);
+
+    bool IsMandatory(size_t index) const;
+    bool HasMandatoryFrom(size_t index) const;
+    //! Index after the last label with the same key as the label at the given index
+    auto EndOfKey(size_t index) const -> size_t;
+
+private:
+    struct Label
+    {
+        uint32_t key;
+        uint32_t value;
+    };
+
+    //!< labels with the same key keep their original order
+    std::vector<Label> _labels;
+    //!< bit i is set, if the i-th label is mandatory
+    std::vector<uint64_t> _mandatoryMask;
+};
+
+bool MatchLabels(const CompiledLabels& labels1, const CompiledLabels& labels2);
+
 } // namespace Util
 } // namespace SilKit
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace SilKit {
+namespace Util {
+
+/// Bounded, lock-free queue for multiple producers and a single consumer. The capacity is rounded up to the next power
+/// of two. Each slot carries a sequence number, which tells the producers and the consumer whether the slot is free or
+/// holds a value of the current round, so neither side has to take a lock.
+template <typename T>
+class MpscRingBuffer
+{
+public:
+    explicit MpscRingBuffer(std::size_t capacity)
+        : _mask{RoundUpToPowerOfTwo(capacity) - 1}
+        , _slots{std::make_unique<Slot[]>(_mask + 1)}
+    {
+        for (std::size_t i = 0; i <= _mask; ++i)
+        {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    auto Capacity() const -> std::size_t
+    {
+        return _mask + 1;
+    }
+
+    /// Appends the value, if the queue is not full. The value is only moved from, if true is returned.
+    template <typename U>
+    bool TryPush(U&& value)
+    {
+        auto position = _pushPosition.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        while (true)
+        {
+            slot = &_slots[position & _mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+            if (difference == 0)
+            {
+                // the slot is free, try to claim it
+                if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // the slot still holds the value of the previous round
+                return false;
+            }
+            else
+            {
+                // another producer claimed the slot
+                position = _pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->value = std::forward<U>(value);
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Removes the oldest value, if the queue is not empty. Must only be called by the single consumer.
+    bool TryPop(T& value)
+    {
+        auto& slot = _slots[_popPosition & _mask];
+        if (slot.sequence.load(std::memory_order_acquire) != _popPosition + 1)
+        {
+            return false;
+        }
+
+        value = std::move(slot.value);
+        slot.sequence.store(_popPosition + _mask + 1, std::memory_order_release);
+        ++_popPosition;
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    static auto RoundUpToPowerOfTwo(std::size_t value) -> std::size_t
+    {
+        std::size_t result{1};
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+private:
+    const std::size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    // the positions are written by different threads, keep them on separate cache lines
+    alignas(64) std::atomic<std::size_t> _pushPosition{0};
+    alignas(64) std::size_t _popPosition{0};
+};
+
+} // namespace Util
+} // namespace SilKit
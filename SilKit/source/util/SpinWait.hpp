@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+namespace SilKit {
+namespace Util {
+
+//! Busy-waits until the predicate is true, but at most for the given budget. Returns the result of the last check of
+//! the predicate, i.e., false if the budget was exhausted. A budget of zero only checks the predicate once.
+template <typename PredicateT>
+bool SpinUntil(PredicateT&& predicate, std::chrono::nanoseconds budget)
+{
+    if (predicate())
+    {
+        return true;
+    }
+    if (budget <= std::chrono::nanoseconds::zero())
+    {
+        return false;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + budget;
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        // yielding keeps the spinning thread from starving the thread it is waiting for on loaded machines
+        std::this_thread::yield();
+
+        if (predicate())
+        {
+            return true;
+        }
+    }
+
+    return predicate();
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -2,6 +2,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <random>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -204,4 +206,59 @@ TEST_F(Test_LabelMatching, match_multiple_labels)
     }
 }
 
+TEST_F(Test_LabelMatching, compiled_labels_match_like_labels)
+{
+    std::mt19937 random{42};
+    auto makeLabels = [&random](size_t maxCount) {
+        std::vector<MatchingLabel> labels;
+        const auto count = std::uniform_int_distribution<size_t>{0, maxCount}(random);
+        for (size_t i = 0; i < count; ++i)
+        {
+            // few keys and values, so labels collide, match and repeat keys often
+            labels.push_back(MatchingLabel{"Key" + std::to_string(random() % 6), "Val" + std::to_string(random() % 2),
+                                           (random() % 2) ? MatchingLabel::Kind::Mandatory
+                                                          : MatchingLabel::Kind::Optional});
+        }
+        return labels;
+    };
+
+    LabelStringTable strings;
+    size_t numberOfMatches{0};
+    for (int n = 0; n < 10000; ++n)
+    {
+        const auto labels1 = makeLabels(4);
+        const auto labels2 = makeLabels(4);
+        const CompiledLabels compiled1{labels1, strings};
+        const CompiledLabels compiled2{labels2, strings};
+
+        const auto expected = MatchLabels(labels1, labels2);
+        EXPECT_EQ(MatchLabels(compiled1, compiled2), expected);
+        EXPECT_EQ(MatchLabels(compiled2, compiled1), MatchLabels(labels2, labels1));
+        numberOfMatches += expected ? 1 : 0;
+    }
+    // both outcomes are covered
+    EXPECT_GT(numberOfMatches, 0u);
+    EXPECT_LT(numberOfMatches, 10000u);
+}
+
+TEST_F(Test_LabelMatching, compiled_labels_more_than_64_labels)
+{
+    std::vector<MatchingLabel> labels1;
+    for (int i = 0; i < 100; ++i)
+    {
+        labels1.push_back(MatchingLabel{"Key" + std::to_string(i), "Val", MatchingLabel::Kind::Optional});
+    }
+    auto labels2 = labels1;
+    labels2.back().kind = MatchingLabel::Kind::Mandatory;
+
+    LabelStringTable strings;
+    EXPECT_TRUE(MatchLabels(CompiledLabels{labels1, strings}, CompiledLabels{labels2, strings}));
+    EXPECT_TRUE(MatchLabels(CompiledLabels{labels1, strings}, CompiledLabels{{}, strings}));
+    // the mandatory label is beyond the first word of the mask
+    EXPECT_FALSE(MatchLabels(CompiledLabels{labels2, strings}, CompiledLabels{{}, strings}));
+
+    labels2.back().value = "Other";
+    EXPECT_FALSE(MatchLabels(CompiledLabels{labels1, strings}, CompiledLabels{labels2, strings}));
+}
+
 } // anonymous namespace
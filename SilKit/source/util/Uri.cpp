@@ -79,7 +79,7 @@ auto Uri::Port() const -> uint16_t
         return *_port;
     }
     //return default value if not set
-    if (Type() == UriType::Local)
+    if (Type() == UriType::Local || Type() == UriType::SharedMemory)
     {
         return 0;
     }
@@ -153,8 +153,13 @@ auto Uri::Parse(std::string rawUri) -> Uri
     {
         uri.SetType(UriType::Local);
     }
+    else if (uri.Scheme() == "shm")
+    {
+        // local-domain socket used for setting up a shared memory segment
+        uri.SetType(UriType::SharedMemory);
+    }
 
-    if (uri.Type() == UriType::Local)
+    if (uri.Type() == UriType::Local || uri.Type() == UriType::SharedMemory)
     {
 #if defined(__QNX__)
         //must be a path, might contain ':' (currently not quoted)
@@ -252,6 +257,8 @@ auto operator<<(std::ostream& ostream, UriType uriType) -> std::ostream&
         return ostream << "UriType::Tcp";
     case UriType::Local:
         return ostream << "UriType::Local";
+    case UriType::SharedMemory:
+        return ostream << "UriType::SharedMemory";
     default:
         return ostream << "UriType(" << static_cast<std::underlying_type_t<UriType>>(uriType) << ")";
     }
@@ -28,6 +28,7 @@ public:
         SilKit,
         Tcp,
         Local,
+        SharedMemory,
     };
 
 public:
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/IndexedMinHeap.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include "gtest/gtest.h"
+
+using SilKit::Util::IndexedMinHeap;
+
+TEST(Test_IndexedMinHeap, top_is_the_item_with_the_smallest_key)
+{
+    IndexedMinHeap<int> heap;
+    ASSERT_TRUE(heap.Empty());
+
+    heap.Set(0, 30);
+    heap.Set(1, 10);
+    heap.Set(2, 20);
+    ASSERT_EQ(heap.Size(), 3u);
+    ASSERT_EQ(heap.Top(), 1u);
+    ASSERT_EQ(heap.TopKey(), 10);
+
+    // increasing the key of the top item moves it down
+    heap.Set(1, 40);
+    ASSERT_EQ(heap.Top(), 2u);
+
+    // decreasing the key of another item moves it up
+    heap.Set(0, 5);
+    ASSERT_EQ(heap.Top(), 0u);
+    ASSERT_EQ(heap.Key(1), 40);
+}
+
+TEST(Test_IndexedMinHeap, erased_items_are_no_longer_contained)
+{
+    IndexedMinHeap<int> heap;
+    heap.Set(0, 1);
+    heap.Set(5, 2);
+    heap.Set(3, 3);
+
+    heap.Erase(0);
+    ASSERT_FALSE(heap.Contains(0));
+    ASSERT_TRUE(heap.Contains(5));
+    ASSERT_EQ(heap.Top(), 5u);
+
+    heap.Erase(0);
+    heap.Erase(42);
+    ASSERT_EQ(heap.Size(), 2u);
+
+    // erased items can be inserted again
+    heap.Set(0, 0);
+    ASSERT_EQ(heap.Top(), 0u);
+}
+
+TEST(Test_IndexedMinHeap, random_operations_match_a_linear_scan)
+{
+    constexpr std::size_t numberOfItems{64};
+    IndexedMinHeap<int> heap;
+    std::vector<int> keys(numberOfItems);
+    std::vector<bool> contained(numberOfItems, false);
+
+    std::mt19937 random{1234};
+    for (int step = 0; step < 10000; ++step)
+    {
+        const auto item = static_cast<std::size_t>(random() % numberOfItems);
+        if (random() % 4 == 0)
+        {
+            heap.Erase(item);
+            contained[item] = false;
+        }
+        else
+        {
+            keys[item] = static_cast<int>(random() % 1000);
+            heap.Set(item, keys[item]);
+            contained[item] = true;
+        }
+
+        int expectedMinimum{std::numeric_limits<int>::max()};
+        std::size_t expectedSize{0};
+        for (std::size_t i = 0; i < numberOfItems; ++i)
+        {
+            if (contained[i])
+            {
+                expectedMinimum = std::min(expectedMinimum, keys[i]);
+                ++expectedSize;
+            }
+            ASSERT_EQ(heap.Contains(i), contained[i]);
+        }
+
+        ASSERT_EQ(heap.Size(), expectedSize);
+        if (expectedSize != 0)
+        {
+            ASSERT_EQ(heap.TopKey(), expectedMinimum);
+            ASSERT_EQ(keys[heap.Top()], expectedMinimum);
+        }
+    }
+}
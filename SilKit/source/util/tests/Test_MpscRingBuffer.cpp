@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/MpscRingBuffer.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using SilKit::Util::MpscRingBuffer;
+
+TEST(Test_MpscRingBuffer, values_are_popped_in_push_order_until_empty)
+{
+    MpscRingBuffer<std::string> queue{3};
+    ASSERT_EQ(queue.Capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(std::to_string(i)));
+    }
+
+    // a value is left untouched, if the queue is full
+    std::string overflow{"overflow"};
+    ASSERT_FALSE(queue.TryPush(std::move(overflow)));
+    ASSERT_EQ(overflow, "overflow");
+
+    std::string value;
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, std::to_string(i));
+    }
+    ASSERT_FALSE(queue.TryPop(value));
+
+    // slots are reused in the next round
+    ASSERT_TRUE(queue.TryPush(std::string{"next"}));
+    ASSERT_TRUE(queue.TryPop(value));
+    ASSERT_EQ(value, "next");
+}
+
+TEST(Test_MpscRingBuffer, values_of_concurrent_producers_are_popped_exactly_once_and_in_order)
+{
+    constexpr int numberOfProducers{4};
+    constexpr int valuesPerProducer{20000};
+    MpscRingBuffer<std::pair<int, int>> queue{64};
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < numberOfProducers; ++producer)
+    {
+        producers.emplace_back([&queue, producer] {
+            for (int i = 0; i < valuesPerProducer; ++i)
+            {
+                while (!queue.TryPush(std::make_pair(producer, i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextValue(numberOfProducers, 0);
+    std::pair<int, int> value;
+    for (int popped = 0; popped < numberOfProducers * valuesPerProducer;)
+    {
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ASSERT_EQ(value.second, nextValue[value.first]);
+        ++nextValue[value.first];
+        ++popped;
+    }
+
+    for (auto&& producer : producers)
+    {
+        producer.join();
+    }
+    ASSERT_FALSE(queue.TryPop(value));
+}
@@ -9,6 +9,7 @@
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -28,10 +29,17 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! View into memory which is kept alive by the owner, e.g., the received message frame the data was read from
+    SharedVector(std::shared_ptr<const void> owner, const Span<const T> view);
+
     auto AsSpan() const& -> Span<const T>;
 
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    SharedVector(std::shared_ptr<std::vector<T>> data);
+
+private:
+    std::shared_ptr<const T> _data;
+    size_t _size{0};
 };
 
 template <typename T>
@@ -49,28 +57,36 @@ SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
 
 template <typename T>
 SharedVector<T>::SharedVector(std::vector<T> vector)
-    : _data{std::make_shared<std::vector<T>>(std::move(vector))}
+    : SharedVector(std::make_shared<std::vector<T>>(std::move(vector)))
 {
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
+    auto data = std::make_shared<std::vector<T>>(span.begin(), span.end());
+    data->resize((std::max)(data->size(), minimumSize), padValue);
+    *this = SharedVector{std::move(data)};
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<const void> owner, const Span<const T> view)
+    : _data{owner, view.data()}
+    , _size{view.size()}
+{
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<std::vector<T>> data)
+    : _data{data, data->data()}
+    , _size{data->size()}
+{
 }
 
 template <typename T>
 auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {
-    if (_data)
-    {
-        return {_data->data(), _data->size()};
-    }
-    else
-    {
-        return {nullptr, 0};
-    }
+    return {_data.get(), _size};
 }
 
 template <typename T>